@@ -13,18 +13,38 @@ layout(std430, set = 3, binding = 0) readonly buffer ModelMatrices {
 	mat4 modelMatrices[];
 };
 
-layout(location = 0) in vec3 position;
-layout(location = 1) in vec3 color;
+layout (push_constant) uniform constants
+{
+	vec3 position_center;
+	uint bones_count;
+	vec3 position_half_extent;
+	uint bones_start_index;
+} pushConstants;
+
+layout(location = 0) in vec4 quantized_position; // snorm16, relative to the mesh bounds
+layout(location = 1) in vec4 color;
 layout(location = 2) in vec2 tex_coord;
-layout(location = 3) in vec3 normal;
+layout(location = 3) in vec2 octahedral_normal;
 
 layout(location = 0) out vec3 o_color;
 layout(location = 1) out vec2 o_tex_coord;
 layout(location = 2) out vec3 o_normal;
 layout(location = 3) out vec3 o_pos;
 
+vec3 decode_octahedral(vec2 e)
+{
+    vec3 n = vec3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
 void main() {
-    o_color = color;
+    vec3 position = pushConstants.position_center + quantized_position.xyz * pushConstants.position_half_extent;
+    vec3 normal = decode_octahedral(octahedral_normal);
+
+    o_color = color.rgb;
     o_tex_coord = tex_coord;
     o_normal = mat3(transpose(inverse(modelMatrices[gl_InstanceIndex]))) * normal;
 
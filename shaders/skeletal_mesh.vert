@@ -3,10 +3,10 @@
 #extension GL_EXT_debug_printf : enable
 #pragma shader_stage(vertex)
 
-layout (location = 0) in vec3 in_pos;
-layout (location = 1) in vec3 in_color;
+layout (location = 0) in vec4 in_quantized_pos; // snorm16, relative to the mesh bounds
+layout (location = 1) in vec4 in_color;
 layout (location = 2) in vec2 in_texcoord;
-layout (location = 3) in vec3 in_normal;
+layout (location = 3) in vec2 in_octahedral_normal;
 layout (location = 4) in vec4 in_weights;
 layout (location = 5) in uvec4 in_bone_indices;
 
@@ -27,7 +27,9 @@ layout(std430, set = 4, binding = 0) readonly buffer JointMatrices {
 
 layout (push_constant) uniform constants
 {
+	vec3 position_center;
 	uint bones_count;
+	vec3 position_half_extent;
 	uint bones_start_index;
 } pushConstants;
 
@@ -36,9 +38,21 @@ layout (location = 1) out vec2 out_tex_coord;
 layout (location = 2) out vec3 out_normal;
 layout (location = 3) out vec3 out_pos;
 
+vec3 decode_octahedral(vec2 e)
+{
+	vec3 n = vec3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+	float t = max(-n.z, 0.0);
+	n.x += n.x >= 0.0 ? -t : t;
+	n.y += n.y >= 0.0 ? -t : t;
+	return normalize(n);
+}
+
 void main() 
 {
-	out_color = in_color;
+	vec3 in_pos = pushConstants.position_center + in_quantized_pos.xyz * pushConstants.position_half_extent;
+	vec3 in_normal = decode_octahedral(in_octahedral_normal);
+
+	out_color = in_color.rgb;
 	out_tex_coord = in_texcoord;
 	out_normal = in_normal;
     out_pos = vec3(modelMatrices[gl_InstanceIndex] * vec4(in_pos, 1.0));
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "pose.hpp"
+#include "root_motion_track.hpp"
 #include "skeleton.hpp"
 #include "sync_track.hpp"
 #include "track.hpp"
@@ -40,7 +41,7 @@ class AnimationClip : public IAsset
   private:
     // Track components are in local bone space
     Vector<Track> m_tracks;
-    Vector<Transform> m_rootMotionTrack;
+    RootMotionTrack m_rootMotionTrack;
     Vector<AnimationEvent*> m_events;
     SyncTrack m_syncTrack;
 
@@ -56,16 +57,6 @@ class AnimationClip : public IAsset
     }
 
 
-    /// @brief Get the difference in root motion between two points in the animation (does not handle looping)
-    inline Transform GetRootMotionDeltaNoLooping(float fromPercentageThroughAnimation, float toPercentageThroughAnimation) const
-    {
-        assert(fromPercentageThroughAnimation <= toPercentageThroughAnimation);
-
-        const auto startRootMotion = GetRootMotion(GetFrameTime(fromPercentageThroughAnimation));
-        const auto endRootMotion = GetRootMotion(GetFrameTime(toPercentageThroughAnimation));
-        return Transform::Delta(startRootMotion, endRootMotion);
-    }
-
   public:
     /// @brief Sample the clip at a specific time
     /// @param time: Time to sample at
@@ -90,37 +81,10 @@ class AnimationClip : public IAsset
         }
     }
 
-    /// @brief Sample the root motion transform at a specific time
-    Transform GetRootMotion(const FrameTime& frameTime) const
-    {
-        if (m_rootMotionTrack.empty())
-        {
-            return Transform::Identity;
-        }
-
-        if (frameTime.IsOnKeyFrame())
-        {
-            return m_rootMotionTrack[frameTime.GetFrameIndex()];
-        }
-
-        const auto& frameStart = m_rootMotionTrack[frameTime.GetFrameIndex()];
-        const auto& frameEnd = m_rootMotionTrack[frameTime.GetFrameIndex() + 1];
-        return Transform::Interpolate(frameStart, frameEnd, frameTime.GetPercentageThroughFrame());
-    }
-
-    /// @brief Get the difference in root motion between two points in the animation
-    Transform GetRootMotionDelta(float fromPercentageThroughAnimation, float toPercentageThroughAnimation) const
+    /// @brief Get the difference in root motion between two points in the animation. Handles looping (from > to)
+    inline Transform GetRootMotionDelta(float fromPercentageThroughAnimation, float toPercentageThroughAnimation) const
     {
-        if (fromPercentageThroughAnimation <= toPercentageThroughAnimation)
-        {
-            return GetRootMotionDeltaNoLooping(fromPercentageThroughAnimation, toPercentageThroughAnimation);
-        }
-        else // Handle looping
-        {
-            const auto startToLoopDelta = GetRootMotionDeltaNoLooping(fromPercentageThroughAnimation, 1.0f);
-            const auto loopToEndDelta = GetRootMotionDeltaNoLooping(0.0f, toPercentageThroughAnimation);
-            return loopToEndDelta * startToLoopDelta;
-        }
+        return m_rootMotionTrack.GetDelta(fromPercentageThroughAnimation, toPercentageThroughAnimation);
     }
 
     inline Seconds GetDuration() const { return m_duration; }
@@ -130,13 +94,13 @@ class AnimationClip : public IAsset
 
     void DrawRootMotionPath(DrawingContext& drawingContext, const Transform& worldTransform) const
     {
-        assert(m_rootMotionTrack.size() > 0);
-        
-        auto transformCount = m_rootMotionTrack.size();
+        assert(!m_rootMotionTrack.IsEmpty());
+
+        auto transformCount = m_rootMotionTrack.GetFrameCount();
         for (auto transformIdx = 0; transformIdx < transformCount - 1; ++transformIdx)
         {
-            const auto startTransform = worldTransform * m_rootMotionTrack[transformIdx];    
-            const auto endTransform = worldTransform * m_rootMotionTrack[transformIdx + 1];    
+            const auto startTransform = worldTransform * m_rootMotionTrack.GetFrameTransform(transformIdx);
+            const auto endTransform = worldTransform * m_rootMotionTrack.GetFrameTransform(transformIdx + 1);
             
             drawingContext.DrawLine(startTransform.GetTranslation(), endTransform.GetTranslation(), RGBColor::Blue);
         }
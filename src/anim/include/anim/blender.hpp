@@ -6,19 +6,60 @@
 
 #include <assert.h>
 #include <common/maths/vec3.hpp>
+#include <common/memory/frame_arena.hpp>
+
+#include <initializer_list>
+#include <type_traits>
 
 namespace aln
 {
 
+/// @brief Set of flags backed by an enum's values
 template <typename T>
 class BitFlags
 {
-    // TODO
+    static_assert(std::is_enum_v<T>);
+
+  private:
+    uint32_t m_flags = 0;
+
+    static constexpr uint32_t GetMask(T flag)
+    {
+        assert((uint32_t) flag < 32);
+        return 1u << (uint32_t) flag;
+    }
+
+  public:
+    BitFlags() = default;
+    BitFlags(std::initializer_list<T> flags)
+    {
+        for (auto flag : flags)
+        {
+            SetFlag(flag);
+        }
+    }
+
+    inline bool IsFlagSet(T flag) const { return (m_flags & GetMask(flag)) != 0; }
+    inline void SetFlag(T flag, bool value = true)
+    {
+        if (value)
+        {
+            m_flags |= GetMask(flag);
+        }
+        else
+        {
+            m_flags &= ~GetMask(flag);
+        }
+    }
+    inline void ClearFlag(T flag) { m_flags &= ~GetMask(flag); }
+    inline bool IsAnyFlagSet() const { return m_flags != 0; }
 };
 
-enum class PoseBlend
+/// @brief Blend options. The default blend is an interpolative one, in local (parent) space
+enum class PoseBlend : uint8_t
 {
-    // TODO
+    Additive,    // The target pose is an additive pose applied on top of the source one
+    GlobalSpace, // Rotations are blended in character space, so that masked bones keep their orientation relative to the character. Ignored by additive blends
 };
 
 struct InterpolativeBlender
@@ -39,6 +80,7 @@ struct InterpolativeBlender
     }
 };
 
+/// @brief Apply an additive pose (quat1, trans1, scale1 are deltas) on top of a base one
 struct AdditiveBlender
 {
     inline static Quaternion BlendRotation(const Quaternion& quat0, const Quaternion& quat1, const float t)
@@ -49,83 +91,215 @@ struct AdditiveBlender
 
     inline static Vec3 BlendTranslation(const Vec3& trans0, const Vec3& trans1, const float t)
     {
-        // TODO
-        // return Vector::MultiplyAdd(trans1, Vector(t), trans0).SetW1();
+        return trans0 + (trans1 * t);
     }
 
     inline static Vec3 BlendScale(const Vec3& scale0, const Vec3& scale1, const float t)
     {
-        // TODO (same as translation (multiplyadd))
+        return scale0 + (scale1 * t);
     }
 };
 
-/// @todo : Do we actually want to use another type than float as weights ?
-struct BlendWeight
+/// @brief Same blend weight for every bone
+struct UniformBlendWeight
+{
+    const float m_blendWeight;
+
+    inline float GetBlendWeight(BoneIndex boneIdx) const { return m_blendWeight; }
+};
+
+/// @brief Per-bone blend weights, precomputed from a bone mask
+struct MaskedBlendWeight
 {
-    /// @brief
-    inline static float GetBlendWeight(float blendWeight, const BoneMask* pBoneMask, uint32_t boneIdx)
+    const float* const m_pBoneWeights;
+
+    inline float GetBlendWeight(BoneIndex boneIdx) const { return m_pBoneWeights[boneIdx]; }
+};
+
+/// @brief Pose blending kernels. Each combination of blender, weight type and blend space is a separate specialization,
+/// selected once per blend rather than branched on per bone
+struct Blender
+{
+    using BlendFunction = void (*)(const Pose* pSourcePose, const Pose* pTargetPose, const float blendWeight, const BoneMask* pBoneMask, Pose* pResultPose);
+
+  private:
+    /// @brief Blend all bones in local space
+    template <typename BlenderType, typename WeightType>
+    static void BlendLocal(const Pose* pSourcePose, const Pose* pTargetPose, const WeightType& weights, Pose* pResultPose)
     {
-        if (pBoneMask != nullptr)
+        const auto boneCount = pResultPose->m_localTransforms.size();
+        const Transform* pSourceTransforms = pSourcePose->m_localTransforms.data();
+        const Transform* pTargetTransforms = pTargetPose->m_localTransforms.data();
+        Transform* pResultTransforms = pResultPose->m_localTransforms.data();
+
+        // Uniform interpolative blends are plain transform interpolations
+        if constexpr (std::is_same_v<BlenderType, InterpolativeBlender> && std::is_same_v<WeightType, UniformBlendWeight>)
         {
-            blendWeight *= pBoneMask->GetBoneWeight(boneIdx);
+            Transform::InterpolateBatch({pSourceTransforms, boneCount}, {pTargetTransforms, boneCount}, weights.m_blendWeight, {pResultTransforms, boneCount});
         }
-        return blendWeight;
-    }
-};
+        else
+        {
+            for (BoneIndex boneIdx = 0; boneIdx < boneCount; ++boneIdx)
+            {
+                const auto boneBlendWeight = weights.GetBlendWeight(boneIdx);
+                const Transform& sourceTransform = pSourceTransforms[boneIdx];
+                const Transform& targetTransform = pTargetTransforms[boneIdx];
 
-/// @brief Blend between two poses in local bone space
-/// @tparam Blender: Blender type
-/// @tparam BlendWeight: TODO
-/// @param pSourcePose:
-/// @param pTargetPose:
-/// @param blendWeight: 0 = source pose, 1 = target pose
-/// @param pBoneMask:
-/// @param pResultPose:
-template <typename Blender>
-void BlenderLocal(const Pose* pSourcePose, const Pose* pTargetPose, const float blendWeight, const BoneMask* pBoneMask, Pose* pResultPose)
-{
-    assert(blendWeight >= 0.0f && blendWeight <= 1.0f);
-    assert(pSourcePose != nullptr && pTargetPose != nullptr && pResultPose != nullptr);
+                // Compute everything before writing, the result pose can be the source one
+                const Vec3 translation = BlenderType::BlendTranslation(sourceTransform.GetTranslation(), targetTransform.GetTranslation(), boneBlendWeight);
+                const Vec3 scale = BlenderType::BlendScale(sourceTransform.GetScale(), targetTransform.GetScale(), boneBlendWeight);
+                const Quaternion rotation = BlenderType::BlendRotation(sourceTransform.GetRotation(), targetTransform.GetRotation(), boneBlendWeight);
+
+                auto& resultTransform = pResultTransforms[boneIdx];
+                resultTransform.SetTranslation(translation);
+                resultTransform.SetScale(scale);
+                resultTransform.SetRotation(rotation);
+            }
+        }
+    }
 
-    if (pBoneMask != nullptr)
+    /// @brief Blend translations and scales in local space and rotations in character space
+    template <typename BlenderType, typename WeightType>
+    static void BlendGlobal(const Pose* pSourcePose, const Pose* pTargetPose, const WeightType& weights, Pose* pResultPose)
     {
-        assert(pBoneMask->GetNumWeights() == pSourcePose->GetSkeleton()->GetBonesCount());
+        const auto pSkeleton = pResultPose->GetSkeleton();
+        const auto boneCount = pResultPose->m_localTransforms.size();
+        const Transform* pSourceTransforms = pSourcePose->m_localTransforms.data();
+        const Transform* pTargetTransforms = pTargetPose->m_localTransforms.data();
+        Transform* pResultTransforms = pResultPose->m_localTransforms.data();
+
+        // Character-space rotations are only needed while blending
+        auto pGlobalRotations = (Quaternion*) Memory::GetFrameArena().Allocate(3 * boneCount * sizeof(Quaternion), alignof(Quaternion));
+        Quaternion* pSourceGlobalRotations = pGlobalRotations;
+        Quaternion* pTargetGlobalRotations = pGlobalRotations + boneCount;
+        Quaternion* pResultGlobalRotations = pGlobalRotations + (2 * boneCount);
+
+        for (BoneIndex boneIdx = 0; boneIdx < boneCount; ++boneIdx)
+        {
+            const auto boneBlendWeight = weights.GetBlendWeight(boneIdx);
+            const Transform& sourceTransform = pSourceTransforms[boneIdx];
+            const Transform& targetTransform = pTargetTransforms[boneIdx];
+
+            const Vec3 translation = BlenderType::BlendTranslation(sourceTransform.GetTranslation(), targetTransform.GetTranslation(), boneBlendWeight);
+            const Vec3 scale = BlenderType::BlendScale(sourceTransform.GetScale(), targetTransform.GetScale(), boneBlendWeight);
+
+            // Parents are always stored before their children
+            Quaternion rotation;
+            if (boneIdx == 0)
+            {
+                pSourceGlobalRotations[boneIdx] = sourceTransform.GetRotation();
+                pTargetGlobalRotations[boneIdx] = targetTransform.GetRotation();
+                pResultGlobalRotations[boneIdx] = BlenderType::BlendRotation(pSourceGlobalRotations[boneIdx], pTargetGlobalRotations[boneIdx], boneBlendWeight);
+                rotation = pResultGlobalRotations[boneIdx];
+            }
+            else
+            {
+                const auto parentIdx = pSkeleton->GetParentBoneIndex(boneIdx);
+                assert(parentIdx < boneIdx);
+
+                pSourceGlobalRotations[boneIdx] = pSourceGlobalRotations[parentIdx] * sourceTransform.GetRotation();
+                pTargetGlobalRotations[boneIdx] = pTargetGlobalRotations[parentIdx] * targetTransform.GetRotation();
+                pResultGlobalRotations[boneIdx] = BlenderType::BlendRotation(pSourceGlobalRotations[boneIdx], pTargetGlobalRotations[boneIdx], boneBlendWeight);
+                rotation = (pResultGlobalRotations[parentIdx].Conjugated() * pResultGlobalRotations[boneIdx]).Normalized();
+            }
+
+            auto& resultTransform = pResultTransforms[boneIdx];
+            resultTransform.SetTranslation(translation);
+            resultTransform.SetScale(scale);
+            resultTransform.SetRotation(rotation);
+        }
     }
 
-    const uint32_t numBones = pResultPose->GetBonesCount();
-    for (uint32_t boneIdx = 0; boneIdx < numBones; boneIdx++)
+    template <typename BlenderType, bool IsGlobalSpace>
+    static void BlendKernel(const Pose* pSourcePose, const Pose* pTargetPose, const float blendWeight, const BoneMask* pBoneMask, Pose* pResultPose)
     {
-        // If the bone has been masked out
-        float const boneBlendWeight = BlendWeight::GetBlendWeight(blendWeight, pBoneMask, boneIdx);
-        if (boneBlendWeight == 0.0f)
+        assert(blendWeight >= 0.0f && blendWeight <= 1.0f);
+        assert(pSourcePose != nullptr && pTargetPose != nullptr && pResultPose != nullptr);
+        assert(pSourcePose->GetBonesCount() == pResultPose->GetBonesCount() && pTargetPose->GetBonesCount() == pResultPose->GetBonesCount());
+
+        if (pBoneMask != nullptr)
         {
-            pResultPose->SetTransform(boneIdx, pSourcePose->GetTransform(boneIdx));
+            assert(pBoneMask->GetNumWeights() == pResultPose->GetBonesCount());
+
+            // Scale all the mask's weights at once, then blend without branching on the mask
+            auto pBoneWeights = (float*) Memory::GetFrameArena().Allocate(pBoneMask->GetPaddedNumWeights() * sizeof(float), 16);
+            pBoneMask->ScaleWeights(blendWeight, pBoneWeights);
+
+            const MaskedBlendWeight weights = {pBoneWeights};
+            if constexpr (IsGlobalSpace)
+            {
+                BlendGlobal<BlenderType>(pSourcePose, pTargetPose, weights, pResultPose);
+            }
+            else
+            {
+                BlendLocal<BlenderType>(pSourcePose, pTargetPose, weights, pResultPose);
+            }
         }
-        else // Perform blend
+        else
         {
-            const Transform& sourceTransform = pSourcePose->GetTransform(boneIdx);
-            const Transform& targetTransform = pTargetPose->GetTransform(boneIdx);
+            const UniformBlendWeight weights = {blendWeight};
+            if constexpr (IsGlobalSpace)
+            {
+                BlendGlobal<BlenderType>(pSourcePose, pTargetPose, weights, pResultPose);
+            }
+            else
+            {
+                BlendLocal<BlenderType>(pSourcePose, pTargetPose, weights, pResultPose);
+            }
+        }
+    }
 
-            // Blend translations
-            const Vec3 translation = Blender::BlendTranslation(sourceTransform.GetTranslation(), targetTransform.GetTranslation(), boneBlendWeight);
-            pResultPose->SetTranslation(boneIdx, translation);
+  public:
+    /// @brief Select the blend kernel matching a set of options. Call once per blend operation
+    static BlendFunction GetBlendFunction(BitFlags<PoseBlend> blendOptions)
+    {
+        // Additive poses hold local deltas, they are always applied in local space
+        if (blendOptions.IsFlagSet(PoseBlend::Additive))
+        {
+            return &BlendKernel<AdditiveBlender, false>;
+        }
+        return blendOptions.IsFlagSet(PoseBlend::GlobalSpace) ? &BlendKernel<InterpolativeBlender, true> : &BlendKernel<InterpolativeBlender, false>;
+    }
 
-            const Vec3 scale = Blender::BlendScale(sourceTransform.GetScale(), targetTransform.GetScale(), boneBlendWeight);
-            pResultPose->SetScale(boneIdx, scale);
+    /// @brief Extract the difference between a pose and a base one, to be layered on top of other poses with an additive blend
+    /// @param pResultPose: Output additive pose. Can be pPose
+    static void CreateAdditivePose(const Pose* pBasePose, const Pose* pPose, Pose* pResultPose)
+    {
+        assert(pBasePose != nullptr && pPose != nullptr && pResultPose != nullptr);
+        assert(pBasePose->GetBonesCount() == pPose->GetBonesCount() && pPose->GetBonesCount() == pResultPose->GetBonesCount());
 
-            const Quaternion rotation = Blender::BlendRotation(sourceTransform.GetRotation(), targetTransform.GetRotation(), boneBlendWeight);
-            pResultPose->SetRotation(boneIdx, rotation);
+        const auto boneCount = pResultPose->m_localTransforms.size();
+        const Transform* pBaseTransforms = pBasePose->m_localTransforms.data();
+        const Transform* pTransforms = pPose->m_localTransforms.data();
+        Transform* pResultTransforms = pResultPose->m_localTransforms.data();
+
+        for (BoneIndex boneIdx = 0; boneIdx < boneCount; ++boneIdx)
+        {
+            const Transform& baseTransform = pBaseTransforms[boneIdx];
+            const Transform& transform = pTransforms[boneIdx];
+
+            // Inverse of AdditiveBlender's operations
+            const Vec3 translation = transform.GetTranslation() - baseTransform.GetTranslation();
+            const Vec3 scale = transform.GetScale() - baseTransform.GetScale();
+            const Quaternion rotation = (baseTransform.GetRotation().Conjugated() * transform.GetRotation()).Normalized();
+
+            auto& resultTransform = pResultTransforms[boneIdx];
+            resultTransform.SetTranslation(translation);
+            resultTransform.SetScale(scale);
+            resultTransform.SetRotation(rotation);
         }
+
+        pResultPose->m_state = Pose::State::AdditivePose;
     }
-}
 
-struct Blender
-{
-    /// @brief Perform a standard interpolative blend
-    /// @todo Perform a different blend based on options. The bitmask might be a bit much ?
+    /// @brief Blend between two poses
+    /// @param blendWeight: 0 = source pose, 1 = target pose
+    /// @param blendOptions: Blend type (interpolative by default) and space (local by default)
+    /// @param pBoneMask: Optional per-bone weights
+    /// @param pResultPose: Output pose. Can be the source pose
     static void Blend(const Pose* pSourcePose, const Pose* pTargetPose, const float blendWeight, BitFlags<PoseBlend> blendOptions, const BoneMask* pBoneMask, Pose* pResultPose)
     {
-        BlenderLocal<InterpolativeBlender>(pSourcePose, pTargetPose, blendWeight, pBoneMask, pResultPose);
+        GetBlendFunction(blendOptions)(pSourcePose, pTargetPose, blendWeight, pBoneMask, pResultPose);
     }
 };
-} // namespace aln
\ No newline at end of file
+} // namespace aln
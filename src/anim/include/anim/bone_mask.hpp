@@ -4,18 +4,72 @@
 
 #include <common/containers/vector.hpp>
 
+#include <assert.h>
+
 namespace aln
 {
 /// @brief Associate a weight to each of a skeleton's bones. Used to partially blend two poses for example.
+/// Weights are packed in groups of LaneCount, padded with zeros, so that per-bone blend weights are computed with a single
+/// branchless loop the compiler can vectorize
 /// @todo Bone mask editor
 class BoneMask
 {
+  public:
+    static constexpr uint32_t LaneCount = 4;
+
   private:
-    Vector<float> boneWeights;
     // Based on animation skeleton
+    Vector<float> m_boneWeights;
+    uint32_t m_boneCount = 0;
+
+    static uint32_t GetPaddedWeightCount(uint32_t boneCount) { return (boneCount + LaneCount - 1) & ~(LaneCount - 1); }
 
   public:
-    size_t GetNumWeights() const { return boneWeights.size(); }
-    float GetBoneWeight(BoneIndex boneIdx) const { return boneWeights.at(boneIdx); }
+    BoneMask() = default;
+    BoneMask(uint32_t boneCount, float defaultWeight = 1.0f) : m_boneCount(boneCount)
+    {
+        assert(defaultWeight >= 0.0f && defaultWeight <= 1.0f);
+        m_boneWeights.resize(GetPaddedWeightCount(boneCount), 0.0f);
+        for (auto boneIdx = 0; boneIdx < boneCount; ++boneIdx)
+        {
+            m_boneWeights[boneIdx] = defaultWeight;
+        }
+    }
+
+    size_t GetNumWeights() const { return m_boneCount; }
+
+    /// @brief Number of weights including padding, i.e. the size required for the output of ScaleWeights
+    size_t GetPaddedNumWeights() const { return m_boneWeights.size(); }
+
+    float GetBoneWeight(BoneIndex boneIdx) const
+    {
+        assert(boneIdx < m_boneCount);
+        return m_boneWeights[boneIdx];
+    }
+
+    void SetBoneWeight(BoneIndex boneIdx, float weight)
+    {
+        assert(boneIdx < m_boneCount);
+        assert(weight >= 0.0f && weight <= 1.0f);
+        m_boneWeights[boneIdx] = weight;
+    }
+
+    /// @brief Compute the final blend weight of every bone
+    /// @param blendWeight: Global blend weight to scale the mask's weights with
+    /// @param pOutWeights: Output buffer of at least GetPaddedNumWeights() floats
+    void ScaleWeights(float blendWeight, float* pOutWeights) const
+    {
+        assert(pOutWeights != nullptr);
+
+        const float* pWeights = m_boneWeights.data();
+        const auto weightCount = m_boneWeights.size();
+        for (auto groupStartIdx = 0; groupStartIdx < weightCount; groupStartIdx += LaneCount)
+        {
+            for (auto laneIdx = 0; laneIdx < LaneCount; ++laneIdx)
+            {
+                pOutWeights[groupStartIdx + laneIdx] = pWeights[groupStartIdx + laneIdx] * blendWeight;
+            }
+        }
+    }
 };
-} // namespace aln
\ No newline at end of file
+} // namespace aln
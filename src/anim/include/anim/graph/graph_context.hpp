@@ -56,9 +56,40 @@ struct GraphLayerContext
     // TODO
 };
 
-struct RootMotionActionRecorder
+/// @brief Records the root motion operations performed by the graph's nodes during an update, in execution order
+class RootMotionActionRecorder
 {
-    // TODO
+  public:
+    enum class ActionType : uint8_t
+    {
+        Sample,
+        Blend,
+        Modification,
+    };
+
+    struct Action
+    {
+        NodeIndex m_nodeIdx = InvalidIndex;
+        ActionType m_actionType = ActionType::Sample;
+        Transform m_rootMotionDelta = Transform::Identity;
+    };
+
+  private:
+    Vector<Action> m_actions;
+
+  public:
+    inline void Reset() { m_actions.clear(); }
+
+    inline void RecordAction(NodeIndex nodeIdx, ActionType actionType, const Transform& rootMotionDelta)
+    {
+        assert(nodeIdx != InvalidIndex);
+        auto& action = m_actions.emplace_back();
+        action.m_nodeIdx = nodeIdx;
+        action.m_actionType = actionType;
+        action.m_rootMotionDelta = rootMotionDelta;
+    }
+
+    inline const Vector<Action>& GetActions() const { return m_actions; }
 };
 
 /// @brief Contains all the necessary data for a graph instance to execute
@@ -80,8 +111,9 @@ class GraphContext
     GraphLayerContext m_layerContext;
 
   private:
-#ifndef NDEBUG
     RootMotionActionRecorder m_rootMotionActionRecorder; // Allows nodes to record root motion ops
+
+#ifndef NDEBUG
     Vector<NodeIndex> m_activeNodes;
 #endif
 
@@ -97,7 +129,7 @@ class GraphContext
         m_pPreviousPose = pPreviousPose;
         m_pSkeleton = pPreviousPose->GetSkeleton();
 
-        // TODO: Initialize Root motion recorder
+        m_rootMotionActionRecorder.Reset();
 
         m_deltaTime = 0.0f;
         m_worldTransform = Transform::Identity;
@@ -112,20 +144,22 @@ class GraphContext
         m_pPreviousPose = nullptr;
         m_pTaskSystem = nullptr;
         m_sampledEventsBuffer.Clear();
-        // TODO
+        m_rootMotionActionRecorder.Reset();
     }
 
     inline bool IsValid() const { return m_pSkeleton != nullptr && m_pTaskSystem != nullptr && m_pPreviousPose != nullptr; }
 
     void Update(const Seconds deltaTime, const Transform& currentWorldTransform)
     {
-        // TODO
         m_deltaTime = deltaTime;
         m_worldTransform = currentWorldTransform;
         m_worldTransformInverse = currentWorldTransform.GetInverse();
         m_sampledEventsBuffer.Clear();
+        m_rootMotionActionRecorder.Reset();
     }
 
+    inline RootMotionActionRecorder* GetRootMotionActionRecorder() { return &m_rootMotionActionRecorder; }
+
 // Debugging
 #ifndef NDEBUG
     inline void TrackActiveNode(NodeIndex nodeIdx)
@@ -134,7 +168,6 @@ class GraphContext
         m_activeNodes.emplace_back(nodeIdx);
     }
     inline const Vector<NodeIndex>& GetActiveNodes() const { return m_activeNodes; }
-    inline RootMotionActionRecorder* GetRootMotionActionRecorder() { return &m_rootMotionActionRecorder; }
 #endif
 
   private:
@@ -32,7 +32,8 @@ class AnimationGraphDefinition : public IAsset
     Vector<StringID> m_controlParameterNames;
     NodeIndex m_rootNodeIndex = InvalidIndex;
 
-    // Memory info used to instanciate the runtime node array(s)
+    // Memory info used to instanciate the runtime nodes in a single block: the node pointers table comes first,
+    // then each node followed by its variable-size instance data (see RuntimeGraphNode::Settings::GetInstanceDataSize)
     Vector<uint32_t> m_nodeOffsets;
     size_t m_requiredMemorySize;
     size_t m_requiredMemoryAlignement;
@@ -31,7 +31,7 @@ class AnimationClipRuntimeNode : public PoseRuntimeNode
         NodeIndex m_playInReverseValueNodeIdx = InvalidIndex;
 
       public:
-        void InstanciateNode(const Vector<RuntimeGraphNode*>& nodePtrs, const AnimationGraphDataset* pDataSet, InitOptions options) const override
+        void InstanciateNode(const Span<RuntimeGraphNode*>& nodePtrs, const AnimationGraphDataset* pDataSet, InitOptions options) const override
         {
             auto pNode = CreateNode<AnimationClipRuntimeNode>(nodePtrs, options);
             SetOptionalNodePtrFromIndex(nodePtrs, m_playInReverseValueNodeIdx, pNode->m_pPlayInReverseValueNode);
@@ -62,6 +62,7 @@ class AnimationClipRuntimeNode : public PoseRuntimeNode
         PoseNodeResult result;
         result.m_taskIndex = context.m_pTaskSystem->RegisterTask<SampleTask>(GetNodeIndex(), m_pAnimationClip, m_currentTime);
         result.m_rootMotionDelta = m_pAnimationClip->GetRootMotionDelta(m_previousTime, m_currentTime);
+        context.GetRootMotionActionRecorder()->RecordAction(GetNodeIndex(), RootMotionActionRecorder::ActionType::Sample, result.m_rootMotionDelta);
 
         return result;
     }
@@ -76,6 +77,7 @@ class AnimationClipRuntimeNode : public PoseRuntimeNode
         PoseNodeResult result;
         result.m_taskIndex = context.m_pTaskSystem->RegisterTask<SampleTask>(GetNodeIndex(), m_pAnimationClip, m_currentTime);
         result.m_rootMotionDelta = m_pAnimationClip->GetRootMotionDelta(m_previousTime, m_currentTime);
+        context.GetRootMotionActionRecorder()->RecordAction(GetNodeIndex(), RootMotionActionRecorder::ActionType::Sample, result.m_rootMotionDelta);
         
         return result;
     }
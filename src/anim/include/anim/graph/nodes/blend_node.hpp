@@ -33,7 +33,7 @@ class BlendNode : public PoseRuntimeNode
 
   private:
     ValueNode* m_pBlendWeightValueNode = nullptr;
-    Vector<PoseRuntimeNode*> m_sourceNodes;
+    Span<PoseRuntimeNode*> m_sourceNodes; // Stored in the graph instance's memory block
 
     float m_blendWeight = 0.0;
     SyncTrack m_blendedSyncTrack;
@@ -66,19 +66,27 @@ class BlendNode : public PoseRuntimeNode
         Vector<BlendRange> m_blendRanges;
 
       public:
-        void InstanciateNode(const Vector<RuntimeGraphNode*>& nodePtrs, const AnimationGraphDataset* pDataSet, InitOptions options) const override
+        void InstanciateNode(const Span<RuntimeGraphNode*>& nodePtrs, const AnimationGraphDataset* pDataSet, InitOptions options) const override
         {
             auto pNode = CreateNode<BlendNode>(nodePtrs, options);
             SetNodePtrFromIndex(nodePtrs, m_blendWeightValueNodeIdx, pNode->m_pBlendWeightValueNode);
             
-            auto sourceNodesCount = m_sourcePoseNodeIndices.size(); 
-            pNode->m_sourceNodes.resize(sourceNodesCount, nullptr);
+            auto instanceData = GetInstanceDataBuffer(pNode);
+            auto sourceNodesCount = m_sourcePoseNodeIndices.size();
+            pNode->m_sourceNodes = instanceData.AllocateArray<PoseRuntimeNode*>(sourceNodesCount);
             for (auto sourceNodeIdx = 0; sourceNodeIdx < sourceNodesCount; ++sourceNodeIdx)
             {
                 SetNodePtrFromIndex(nodePtrs, m_sourcePoseNodeIndices[sourceNodeIdx], pNode->m_sourceNodes[sourceNodeIdx]);
             }
         }
-    
+
+        size_t GetInstanceDataSize() const override
+        {
+            NodeInstanceDataBuffer instanceData;
+            instanceData.AllocateArray<PoseRuntimeNode*>(m_sourcePoseNodeIndices.size());
+            return instanceData.GetSize();
+        }
+
         const Vector<BlendRange>& GetBlendRanges() const { return m_blendRanges; }
     };
 
@@ -98,7 +106,7 @@ class BlendNode : public PoseRuntimeNode
 
         const auto& sourceSyncTrack = pSourceNode->GetSyncTrack();
         const auto& targetSyncTrack = pTargetNode->GetSyncTrack();
-        m_blendedSyncTrack = SyncTrack::Blend(sourceSyncTrack, targetSyncTrack, scaledBlendWeight);
+        SyncTrack::Blend(sourceSyncTrack, targetSyncTrack, scaledBlendWeight, m_blendedSyncTrack);
 
         const auto deltaPercentage = context.m_deltaTime / m_duration;
         SyncTrackTimeRange timeRange;
@@ -114,6 +122,7 @@ class BlendNode : public PoseRuntimeNode
         result.m_taskIndex = context.m_pTaskSystem->RegisterTask<BlendTask>(GetNodeIndex(), sourceNodeResult.m_taskIndex, targetNodeResult.m_taskIndex, scaledBlendWeight, blendOptions, nullptr);
         // TODO: we could skip an op by not interpolating scale (which is not used by the root motion track)
         result.m_rootMotionDelta = Transform::Interpolate(sourceNodeResult.m_rootMotionDelta, targetNodeResult.m_rootMotionDelta, scaledBlendWeight);
+        context.GetRootMotionActionRecorder()->RecordAction(GetNodeIndex(), RootMotionActionRecorder::ActionType::Blend, result.m_rootMotionDelta);
 
         // Update time state
         m_duration = SyncTrack::CalculateSynchronizedTrackDuration(pSourceNode->GetDuration(), pTargetNode->GetDuration(), sourceSyncTrack, targetSyncTrack, m_blendedSyncTrack, scaledBlendWeight);
@@ -22,7 +22,7 @@ class StateMachineRuntimeNode : public PoseRuntimeNode
     struct State
     {
         StateRuntimeNode* m_pStateNode = nullptr;
-        Vector<Transition> m_transitions;
+        Span<Transition> m_transitions; // Stored in the graph instance's memory block
     };
 
     struct Settings : public PoseRuntimeNode::Settings
@@ -63,27 +63,48 @@ class StateMachineRuntimeNode : public PoseRuntimeNode
         Vector<StateSettings> m_stateSettings;
 
       public:
-        virtual void InstanciateNode(const Vector<RuntimeGraphNode*>& nodePtrs, AnimationGraphDataset const* pDataSet, InitOptions options) const override
+        virtual void InstanciateNode(const Span<RuntimeGraphNode*>& nodePtrs, AnimationGraphDataset const* pDataSet, InitOptions options) const override
         {
             auto pNode = CreateNode<StateMachineRuntimeNode>(nodePtrs, options);
 
-            for (auto& stateSettings : m_stateSettings)
+            // State and transition tables live right after the node in the instance memory
+            auto instanceData = GetInstanceDataBuffer(pNode);
+            pNode->m_states = instanceData.AllocateArray<State>(m_stateSettings.size());
+
+            const auto stateCount = m_stateSettings.size();
+            for (auto stateIdx = 0; stateIdx < stateCount; ++stateIdx)
             {
-                auto& state = pNode->m_states.emplace_back();
+                const auto& stateSettings = m_stateSettings[stateIdx];
+                auto& state = pNode->m_states[stateIdx];
                 SetNodePtrFromIndex(nodePtrs, stateSettings.m_stateNodeIndex, state.m_pStateNode);
-                for (auto& transitionSettings : stateSettings.m_transitionSettings)
+
+                state.m_transitions = instanceData.AllocateArray<Transition>(stateSettings.m_transitionSettings.size());
+                const auto transitionCount = stateSettings.m_transitionSettings.size();
+                for (auto transitionIdx = 0; transitionIdx < transitionCount; ++transitionIdx)
                 {
-                    auto& transition = state.m_transitions.emplace_back();
+                    const auto& transitionSettings = stateSettings.m_transitionSettings[transitionIdx];
+                    auto& transition = state.m_transitions[transitionIdx];
                     transition.m_endStateIndex = transitionSettings.m_endStateIndex;
                     SetNodePtrFromIndex(nodePtrs, transitionSettings.m_transitionNodeIndex, transition.m_pTransitionNode);
                     SetNodePtrFromIndex(nodePtrs, transitionSettings.m_conditionNodeIndex, transition.m_pConditionNode);
                 }
             }
         }
+
+        size_t GetInstanceDataSize() const override
+        {
+            NodeInstanceDataBuffer instanceData;
+            instanceData.AllocateArray<State>(m_stateSettings.size());
+            for (auto& stateSettings : m_stateSettings)
+            {
+                instanceData.AllocateArray<Transition>(stateSettings.m_transitionSettings.size());
+            }
+            return instanceData.GetSize();
+        }
     };
 
   private:
-    Vector<State> m_states;
+    Span<State> m_states; // Stored in the graph instance's memory block
     TransitionRuntimeNode* m_pActiveTransitionNode = nullptr;
     uint16_t m_activeStateIndex = InvalidIndex;
 
@@ -93,7 +114,7 @@ class StateMachineRuntimeNode : public PoseRuntimeNode
         return m_states[m_activeStateIndex];
     }
 
-    const Vector<Transition>& GetAvailableTransitionsFromActiveState() const
+    const Span<Transition>& GetAvailableTransitionsFromActiveState() const
     {
         assert(m_activeStateIndex != InvalidIndex);
         return m_states[m_activeStateIndex].m_transitions;
@@ -33,7 +33,7 @@ class TransitionRuntimeNode : public PoseRuntimeNode
         float m_transitionDuration = 0.0f; // How long a blend between two states will take (in seconds)
 
       public:
-        virtual void InstanciateNode(const Vector<RuntimeGraphNode*>& nodePtrs, AnimationGraphDataset const* pDataSet, InitOptions options) const override
+        virtual void InstanciateNode(const Span<RuntimeGraphNode*>& nodePtrs, AnimationGraphDataset const* pDataSet, InitOptions options) const override
         {
             auto pNode = CreateNode<TransitionRuntimeNode>(nodePtrs, options);
             SetNodePtrFromIndex(nodePtrs, m_endStateNodeIdx, pNode->m_pEndNode);
@@ -73,6 +73,7 @@ class TransitionRuntimeNode : public PoseRuntimeNode
         result.m_taskIndex = context.m_pTaskSystem->RegisterTask<BlendTask>(GetNodeIndex(), startNodeResult.m_taskIndex, endNodeResult.m_taskIndex, m_transitionProgress, blendOptions, nullptr);
         // TODO: we could skip an op by not interpolating scale (which is not used by the root motion track)
         result.m_rootMotionDelta = Transform::Interpolate(startNodeResult.m_rootMotionDelta, endNodeResult.m_rootMotionDelta, m_transitionProgress);
+        context.GetRootMotionActionRecorder()->RecordAction(GetNodeIndex(), RootMotionActionRecorder::ActionType::Blend, result.m_rootMotionDelta);
 
         // Update internal time
         m_previousTime = m_currentTime;
@@ -161,6 +162,7 @@ class TransitionRuntimeNode : public PoseRuntimeNode
             result.m_taskIndex = context.m_pTaskSystem->RegisterTask<BlendTask>(GetNodeIndex(), startNodeResult.m_taskIndex, endNodeResult.m_taskIndex, blendWeight, blendOptions, nullptr);
             // TODO: we could skip an op by not interpolating scale (which is not used by the root motion track)
             result.m_rootMotionDelta = Transform::Interpolate(startNodeResult.m_rootMotionDelta, endNodeResult.m_rootMotionDelta, blendWeight);
+            context.GetRootMotionActionRecorder()->RecordAction(GetNodeIndex(), RootMotionActionRecorder::ActionType::Blend, result.m_rootMotionDelta);
         }
         else
         {
@@ -19,7 +19,7 @@ class PassthroughRuntimeNode : public PoseRuntimeNode
         NodeIndex m_childNodeIdx = InvalidIndex;
 
       public:
-        virtual void InstanciateNode(const Vector<RuntimeGraphNode*>& nodePtrs, AnimationGraphDataset const* pDataSet, InitOptions options) const override
+        virtual void InstanciateNode(const Span<RuntimeGraphNode*>& nodePtrs, AnimationGraphDataset const* pDataSet, InitOptions options) const override
         {
             // TODO: Make sure the node has already been created
             auto pNode = reinterpret_cast<PassthroughRuntimeNode*>(nodePtrs[GetNodeIndex()]);
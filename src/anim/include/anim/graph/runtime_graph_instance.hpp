@@ -6,6 +6,8 @@
 #include "runtime_graph_node.hpp"
 #include "value_node.hpp"
 
+#include <common/memory.hpp>
+
 #include <string>
 
 namespace aln
@@ -19,9 +21,10 @@ class RuntimeAnimationGraphInstance
     const AnimationGraphDefinition* m_pGraphDefinition = nullptr;
     const AnimationGraphDataset* m_pGraphDataset = nullptr;
 
+    // Single block holding the node pointers table, then each node followed by its variable-size data
     std::byte* m_pNodeInstancesMemory = nullptr;
 
-    Vector<RuntimeGraphNode*> m_runtimeNodeInstances;
+    Span<RuntimeGraphNode*> m_runtimeNodeInstances;
 
     PoseRuntimeNode* m_pRootNode = nullptr;
 
@@ -29,12 +32,17 @@ class RuntimeAnimationGraphInstance
     RuntimeAnimationGraphInstance(const AnimationGraphDefinition* pGraphDefinition, const AnimationGraphDataset* pGraphDataset)
         : m_pGraphDefinition(pGraphDefinition), m_pGraphDataset(pGraphDataset)
     {
-        // Allocate a single block of memory for the whole graph
+        MemoryTagScope memoryTagScope(MemoryTag::Animation);
+
+        // Allocate a single block of memory for the whole graph. The layout is computed when compiling the graph
         m_pNodeInstancesMemory = (std::byte*) aln::Allocate(pGraphDefinition->m_requiredMemorySize, pGraphDefinition->m_requiredMemoryAlignement);
-        m_runtimeNodeInstances.reserve(m_pGraphDefinition->GetNumNodes());
-        for (auto& nodeOffset : pGraphDefinition->m_nodeOffsets)
+
+        const auto nodeCount = m_pGraphDefinition->GetNumNodes();
+        assert(nodeCount == 0 || pGraphDefinition->m_nodeOffsets[0] >= nodeCount * sizeof(RuntimeGraphNode*));
+        m_runtimeNodeInstances = Span<RuntimeGraphNode*>(reinterpret_cast<RuntimeGraphNode**>(m_pNodeInstancesMemory), nodeCount);
+        for (auto nodeIdx = 0; nodeIdx < nodeCount; ++nodeIdx)
         {
-            m_runtimeNodeInstances.emplace_back(reinterpret_cast<RuntimeGraphNode*>(m_pNodeInstancesMemory + nodeOffset));
+            m_runtimeNodeInstances[nodeIdx] = reinterpret_cast<RuntimeGraphNode*>(m_pNodeInstancesMemory + pGraphDefinition->m_nodeOffsets[nodeIdx]);
         }
 
         // Instanciate each node in the allocated memory
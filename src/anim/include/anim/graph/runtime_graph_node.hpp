@@ -2,6 +2,8 @@
 
 #include <assert.h>
 
+#include <common/containers/span.hpp>
+#include <common/memory.hpp>
 #include <common/serialization/binary_archive.hpp>
 #include <reflection/reflected_type.hpp>
 
@@ -22,6 +24,57 @@ enum class InitOptions : uint8_t
     None,
 }; // TODO
 
+/// @brief Linear allocator over the variable-size data (arrays, tables...) of a runtime node, which is stored right after the node in the graph instance's memory block.
+/// Constructed without memory, it only measures the required size so that the graph compiler can reserve it
+class NodeInstanceDataBuffer
+{
+  public:
+    static constexpr size_t Alignment = alignof(std::max_align_t);
+
+    /// @brief Offset of the data from the start of a node of the given size
+    static constexpr size_t GetDataOffset(size_t nodeSize) { return (nodeSize + Alignment - 1) & ~(Alignment - 1); }
+
+  private:
+    std::byte* m_pMemory = nullptr;
+    size_t m_capacity = 0;
+    size_t m_size = 0;
+
+  public:
+    NodeInstanceDataBuffer() = default;
+    NodeInstanceDataBuffer(std::byte* pMemory, size_t capacity) : m_pMemory(pMemory), m_capacity(capacity)
+    {
+        assert(pMemory != nullptr);
+        assert(capacity == 0 || reinterpret_cast<uintptr_t>(pMemory) % Alignment == 0);
+    }
+
+    /// @brief Reserve a default-constructed array. Returns an empty span when measuring
+    template <typename T>
+    Span<T> AllocateArray(size_t count)
+    {
+        // Instance data is released with the block, destructors are never called
+        static_assert(std::is_trivially_destructible_v<T>);
+        static_assert(alignof(T) <= Alignment);
+
+        const auto offset = (m_size + alignof(T) - 1) & ~(alignof(T) - 1);
+        m_size = offset + (sizeof(T) * count);
+
+        if (m_pMemory == nullptr || count == 0)
+        {
+            return Span<T>();
+        }
+
+        assert(m_size <= m_capacity);
+        auto pArray = reinterpret_cast<T*>(m_pMemory + offset);
+        for (auto idx = 0; idx < count; ++idx)
+        {
+            aln::PlacementNew<T>(pArray + idx);
+        }
+        return Span<T>(pArray, count);
+    }
+
+    size_t GetSize() const { return m_size; }
+};
+
 /// @brief Base class for runtime nodes. Nodes do not contain data themselves, all of it is kept in the settings
 class RuntimeGraphNode
 {
@@ -49,7 +102,7 @@ class RuntimeGraphNode
         /// @param nodePtrs: Pointers to the allocated node memory, by index
         /// @param options: TODO: Optionally only initialize ptrs (avoid new)
         template <typename T>
-        T* CreateNode(const Vector<RuntimeGraphNode*>& nodePtrs, InitOptions options) const
+        T* CreateNode(const Span<RuntimeGraphNode*>& nodePtrs, InitOptions options) const
         {
             // TODO: Handle options
 
@@ -61,9 +114,17 @@ class RuntimeGraphNode
             return pNode;
         }
 
+        /// @brief Get the buffer holding the variable-size data of a node created with CreateNode
+        template <typename T>
+        NodeInstanceDataBuffer GetInstanceDataBuffer(T* pNode) const
+        {
+            auto pData = reinterpret_cast<std::byte*>(pNode) + NodeInstanceDataBuffer::GetDataOffset(sizeof(T));
+            return NodeInstanceDataBuffer(pData, GetInstanceDataSize());
+        }
+
         /// @brief Set a node based on a given index, only if the index was set
         template<typename T>
-        void SetOptionalNodePtrFromIndex(const Vector<RuntimeGraphNode*>& nodePtrs, const NodeIndex nodeIndex, T*& pNode) const
+        void SetOptionalNodePtrFromIndex(const Span<RuntimeGraphNode*>& nodePtrs, const NodeIndex nodeIndex, T*& pNode) const
         {
             if (nodeIndex == InvalidIndex)
             {
@@ -77,7 +138,7 @@ class RuntimeGraphNode
 
         /// @brief Set a node based on a given index
         template<typename T>
-        void SetNodePtrFromIndex(const Vector<RuntimeGraphNode*>& nodePtrs, const NodeIndex nodeIndex, T*& pNode) const
+        void SetNodePtrFromIndex(const Span<RuntimeGraphNode*>& nodePtrs, const NodeIndex nodeIndex, T*& pNode) const
         {
             assert(nodeIndex != InvalidIndex);
             assert(nodeIndex >= 0 && nodeIndex < nodePtrs.size());
@@ -87,7 +148,11 @@ class RuntimeGraphNode
 
       public:
         /// @brief Instanciate a node and all its data. Override in derived nodes
-        virtual void InstanciateNode(const Vector<RuntimeGraphNode*>& nodePtrs, AnimationGraphDataset const* pDataSet, InitOptions options) const = 0;
+        virtual void InstanciateNode(const Span<RuntimeGraphNode*>& nodePtrs, AnimationGraphDataset const* pDataSet, InitOptions options) const = 0;
+
+        /// @brief Size of the variable-size data the runtime node needs on top of its members. The graph compiler lays it out
+        /// right after the node in the instance memory block. Override in nodes that need some, alongside InstanciateNode
+        virtual size_t GetInstanceDataSize() const { return 0; }
         NodeIndex GetNodeIndex() const { return m_nodeIndex; }
     };
 
@@ -14,14 +14,14 @@ class BlendTask : public Task
   private:
     float m_blendWeight = 1.0f;
     const BoneMask* m_pBoneMask;
-    BitFlags<PoseBlend> m_blendOptions;
+    Blender::BlendFunction m_blendFunction = nullptr; // Kernel matching the blend options, selected once
 
   public:
     BlendTask(NodeIndex sourceNodeIdx, TaskIndex sourceTaskIndex, TaskIndex targetTaskIndex, float const blendWeight, BitFlags<PoseBlend> blendOptions, const BoneMask* pBoneMask)
         : Task(sourceNodeIdx, UpdateStage::Any, {sourceTaskIndex, targetTaskIndex}),
           m_blendWeight(blendWeight),
           m_pBoneMask(pBoneMask),
-          m_blendOptions(blendOptions)
+          m_blendFunction(Blender::GetBlendFunction(blendOptions))
     {
         assert(m_blendWeight >= 0.0f && m_blendWeight <= 1.0f);
 
@@ -38,7 +38,7 @@ class BlendTask : public Task
         auto pTargetBuffer = AccessDependencyPoseBuffer(context, 1);
         auto pFinalBuffer = pSourceBuffer;
 
-        Blender::Blend(&pSourceBuffer->m_pose, &pTargetBuffer->m_pose, m_blendWeight, m_blendOptions, m_pBoneMask, &pFinalBuffer->m_pose);
+        m_blendFunction(&pSourceBuffer->m_pose, &pTargetBuffer->m_pose, m_blendWeight, m_pBoneMask, &pFinalBuffer->m_pose);
 
         ReleaseDependencyPoseBuffer(context, 1);
         MarkTaskComplete(context);
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <common/containers/vector.hpp>
+#include <common/maths/maths.hpp>
+#include <common/transform.hpp>
+
+#include <assert.h>
+
+namespace aln
+{
+
+/// @brief Root motion of an animation clip, baked at load time into cumulative per-frame translations and rotations relative to the first frame.
+/// Sampling is a single lerp/nlerp, and the delta between any two points of the clip (looping included) costs two samples
+class RootMotionTrack
+{
+  private:
+    Vector<Vec3> m_translations;
+    Vector<Quaternion> m_rotations;
+    Transform m_loopTransform = Transform::Identity; // Cumulative root motion over a whole clip, used to continue the track past a loop
+
+  public:
+    /// @brief Bake the track from per-frame root transforms
+    void Bake(const Vector<Transform>& rootTransforms)
+    {
+        m_translations.clear();
+        m_rotations.clear();
+        m_loopTransform = Transform::Identity;
+
+        if (rootTransforms.empty())
+        {
+            return;
+        }
+
+        const auto frameCount = rootTransforms.size();
+        m_translations.reserve(frameCount);
+        m_rotations.reserve(frameCount);
+
+        // Rebase on the first frame so that the track starts at identity
+        const auto inverseStartTransform = rootTransforms[0].GetInverse();
+        for (const auto& rootTransform : rootTransforms)
+        {
+            const auto rebasedTransform = inverseStartTransform * rootTransform;
+            m_translations.push_back(rebasedTransform.GetTranslation());
+            m_rotations.push_back(rebasedTransform.GetRotation().Normalized());
+        }
+
+        m_loopTransform = Transform(m_translations.back(), m_rotations.back(), Vec3::Ones);
+    }
+
+    void Clear()
+    {
+        m_translations.clear();
+        m_rotations.clear();
+        m_loopTransform = Transform::Identity;
+    }
+
+    inline bool IsEmpty() const { return m_translations.empty(); }
+    inline size_t GetFrameCount() const { return m_translations.size(); }
+    inline Transform GetFrameTransform(uint32_t frameIdx) const { return Transform(m_translations[frameIdx], m_rotations[frameIdx], Vec3::Ones); }
+
+    /// @brief Sample the cumulative root motion at a point of the clip
+    Transform Sample(float percentageThroughAnimation) const
+    {
+        assert(percentageThroughAnimation >= 0.0f && percentageThroughAnimation <= 1.0f);
+
+        if (IsEmpty())
+        {
+            return Transform::Identity;
+        }
+
+        const auto lastFrameIdx = (uint32_t) m_translations.size() - 1;
+        const float frameTime = percentageThroughAnimation * lastFrameIdx;
+        const auto frameIdx = (uint32_t) frameTime;
+        if (frameIdx >= lastFrameIdx)
+        {
+            return m_loopTransform;
+        }
+
+        const float percentageThroughFrame = frameTime - frameIdx;
+        const auto translation = Vec3::Lerp(m_translations[frameIdx], m_translations[frameIdx + 1], percentageThroughFrame);
+        const auto rotation = Quaternion::NLerp(m_rotations[frameIdx], m_rotations[frameIdx + 1], percentageThroughFrame);
+        return Transform(translation, rotation, Vec3::Ones);
+    }
+
+    /// @brief Get the root motion delta between two points of the clip. If from > to, the clip is considered to have looped
+    Transform GetDelta(float fromPercentageThroughAnimation, float toPercentageThroughAnimation) const
+    {
+        if (IsEmpty())
+        {
+            return Transform::Identity;
+        }
+
+        const auto fromTransform = Sample(fromPercentageThroughAnimation);
+        if (fromPercentageThroughAnimation <= toPercentageThroughAnimation)
+        {
+            return Transform::Delta(fromTransform, Sample(toPercentageThroughAnimation));
+        }
+
+        // Looping: continue the track from the end of the clip
+        return Transform::Delta(fromTransform, m_loopTransform * Sample(toPercentageThroughAnimation));
+    }
+};
+} // namespace aln
@@ -4,12 +4,12 @@
 
 #include "event.hpp"
 
-#include <common/containers/vector.hpp>
+#include <common/containers/array.hpp>
 #include <common/maths/maths.hpp>
+#include <common/string_id.hpp>
 #include <common/types.hpp>
 
 #include <assert.h>
-#include <string>
 
 namespace aln
 {
@@ -32,35 +32,39 @@ struct SyncTrackTimeRange
 
 class ALN_ANIM_EXPORT SyncTrack
 {
+  public:
+    /// @brief Sync tracks store their events inline so that the tracks blended at runtime live in the
+    /// graph instance's memory block and blending does not allocate
+    static constexpr uint32_t MaxEventCount = 16;
+
+  private:
     struct Event
     {
-        // TODO: StringID
-        std::string m_name;
+        StringID m_id = StringID::InvalidID;
         // In percentage
         float m_startTime = 0.0f;
         float m_duration = 1.0f;
     };
 
-    Vector<SyncTrack::Event> m_events;
+    Array<SyncTrack::Event, MaxEventCount> m_events;
+    uint32_t m_eventCount = 0;
 
   public:
     /// @brief Default construction creates a single sync event over the whole track
     SyncTrack()
     {
-        m_events.emplace_back();
+        m_eventCount = 1;
     }
 
-    /// @brief Create a new sync track by blending two existing ones
-    static SyncTrack Blend(const SyncTrack& source, const SyncTrack& target, const float blendWeight)
+    /// @brief Blend two existing tracks into an output one
+    static void Blend(const SyncTrack& source, const SyncTrack& target, const float blendWeight, SyncTrack& outBlendedTrack)
     {
         assert(blendWeight >= 0.0f && blendWeight <= 1.0f);
 
         // TODO: Temporary assert. Handle different track sizes
-        assert(source.m_events.size() == target.m_events.size());
+        assert(source.m_eventCount == target.m_eventCount);
 
-        SyncTrack blendedTrack;
-        blendedTrack.m_events.clear(); // TODO: dirty dirty
-        const auto eventCount = target.m_events.size();
+        const auto eventCount = target.m_eventCount;
         for (auto eventIdx = 0; eventIdx < eventCount; ++eventIdx)
         {
             const auto& sourceEvent = source.m_events[eventIdx];
@@ -72,16 +76,15 @@ class ALN_ANIM_EXPORT SyncTrack
 
             // TODO: Scale the input tracks
 
-            auto& event = blendedTrack.m_events.emplace_back();
+            auto& event = outBlendedTrack.m_events[eventIdx];
             event.m_duration = Maths::Lerp(sourceEvent.m_duration, targetEvent.m_duration, blendWeight);
             event.m_startTime = 0.0f; // TODO
-            event.m_name = blendWeight <= 0.5 ? sourceEvent.m_name : targetEvent.m_name;
+            event.m_id = blendWeight <= 0.5 ? sourceEvent.m_id : targetEvent.m_id;
         }
-
-        return blendedTrack;
+        outBlendedTrack.m_eventCount = eventCount;
     }
 
-    size_t GetEventCount() const { return m_events.size(); }
+    size_t GetEventCount() const { return m_eventCount; }
 
     /// @brief Returns the sync time at the specified progress through the track
     /// @todo Handle looping
@@ -91,7 +94,7 @@ class ALN_ANIM_EXPORT SyncTrack
 
         SyncTrackTime time;
 
-        const auto eventCount = m_events.size();
+        const auto eventCount = m_eventCount;
         for (auto eventIdx = 0; eventIdx < eventCount; ++eventIdx)
         {
             const auto& event = m_events[eventIdx];
@@ -109,7 +112,7 @@ class ALN_ANIM_EXPORT SyncTrack
 
     float GetPercentageThrough(const SyncTrackTime& time) const
     {
-        assert(time.m_eventIdx < m_events.size());
+        assert(time.m_eventIdx < m_eventCount);
         assert(time.m_percent >= 0.0f && time.m_percent <= 1.0f);
 
         const auto& event = m_events[time.m_eventIdx];
@@ -125,4 +128,7 @@ class ALN_ANIM_EXPORT SyncTrack
 
     static const SyncTrack Default;
 };
+
+// Blended sync tracks are stored in graph instances' memory blocks and must not own any memory
+static_assert(std::is_trivially_destructible_v<SyncTrack>);
 } // namespace aln
\ No newline at end of file
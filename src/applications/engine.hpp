@@ -1,28 +1,15 @@
 #pragma once
 
-#include <anim/module/module.hpp>
-#include <assets/module/module.hpp>
-#include <core/module/module.hpp>
+#include "engine_core.hpp"
+
 #include <editor/module/module.hpp>
-#include <entities/module/module.hpp>
-
-#include <assets/asset_service.hpp>
-#include <common/services/service_provider.hpp>
-#include <core/asset_loaders/animation_graph_loader.hpp>
-#include <core/asset_loaders/animation_loader.hpp>
-#include <core/asset_loaders/material_loader.hpp>
-#include <core/asset_loaders/mesh_loader.hpp>
-#include <core/asset_loaders/skeleton_loader.hpp>
-#include <core/asset_loaders/texture_loader.hpp>
+
+#include <assets/asset_database.hpp>
+#include <config/path.h>
 #include <core/renderers/scene_renderer.hpp>
 #include <core/renderers/ui_renderer.hpp>
-#include <core/services/time_service.hpp>
-#include <core/world_systems/render_system.hpp>
-#include <entities/world_entity.hpp>
-#include <entities/world_update.hpp>
-#include <input/input_service.hpp>
-#include <reflection/services/type_registry_service.hpp>
 #include <core/services/rendering_service.hpp>
+#include <graphics/imgui_service.hpp>
 #include <graphics/window.hpp>
 
 #include <editor/editor.hpp>
@@ -34,36 +21,21 @@ class GLFWwindow;
 namespace aln
 {
 
-class Engine
+/// @brief Windowed engine: the simulation core, plus rendering, ImGui and the editor
+class Engine : public EngineCore
 {
     friend class GLFWApplication;
 
   private:
     // Rendering
     RenderEngine m_renderEngine;
-
-    // Services
-    ServiceProvider m_serviceProvider;
-    TaskService m_taskService;
-    AssetService m_assetService;
-    TimeService m_timeService;
-    InputService m_inputService;
-    TypeRegistryService m_typeRegistryService;
     RenderingService m_renderingService;
 
     // Editor
+    AssetDatabase m_assetDatabase;
     Editor m_editor;
     ImGUIService m_imguiService;
-
-    WorldEntity m_worldEntity;
-    UpdateContext m_updateContext;
-
-    // Modules
-    Assets::Module m_assetsModule;
-    Core::Module m_coreModule;
-    Anim::Module m_animModule;
     Tooling::Module m_toolingModule;
-    Entities::Module m_entitiesModule;
 
   public:
     Engine() : m_editor(m_worldEntity) {}
@@ -80,43 +52,22 @@ class Engine
         // TODO: Uniformize services initialization. Make it happen in the register function ?
         m_imguiService.Initialize();
         m_renderingService.Initialize(&m_renderEngine, &m_worldEntity, &m_imguiService);
-        m_assetService.Initialize(m_taskService, m_renderEngine);
 
-        m_serviceProvider.RegisterService(&m_taskService);
-        m_serviceProvider.RegisterService(&m_assetService);
-        m_serviceProvider.RegisterService(&m_timeService);
-        m_serviceProvider.RegisterService(&m_inputService);
-        m_serviceProvider.RegisterService(&m_typeRegistryService);
-        m_serviceProvider.RegisterService(&m_renderingService);
-        m_serviceProvider.RegisterService(&m_imguiService);
-
-        m_updateContext.m_pServiceProvider = &m_serviceProvider;
+        EngineCore::Initialize(&m_renderEngine);
 
-        // Initialize modules
         EngineModuleContext moduleContext = {
             .m_pTypeRegistryService = &m_typeRegistryService,
         };
-
-        m_coreModule.Initialize(moduleContext);
-        m_assetsModule.Initialize(moduleContext);
-        m_animModule.Initialize(moduleContext);
         m_toolingModule.Initialize(moduleContext);
-        m_entitiesModule.Initialize(moduleContext);
-
-        // TODO: Add a vector of loaded types to the Loader base class, specify them in the constructor of the specialized Loaders,
-        // then register each of them with a single function.
-        m_assetService.RegisterAssetLoader<StaticMesh, MeshLoader>(&m_renderEngine);
-        m_assetService.RegisterAssetLoader<SkeletalMesh, MeshLoader>(&m_renderEngine);
-        m_assetService.RegisterAssetLoader<Texture, TextureLoader>(&m_renderEngine);
-        m_assetService.RegisterAssetLoader<Material, MaterialLoader>(&m_renderEngine);
-        m_assetService.RegisterAssetLoader<AnimationClip, AnimationLoader>(nullptr);
-        m_assetService.RegisterAssetLoader<Skeleton, SkeletonLoader>();
-        m_assetService.RegisterAssetLoader<AnimationGraphDataset, AnimationGraphDatasetLoader>();
-        m_assetService.RegisterAssetLoader<AnimationGraphDefinition, AnimationGraphDefinitionLoader>(&m_typeRegistryService);
-
-        m_worldEntity.Initialize(m_serviceProvider);
-        m_worldEntity.CreateSystem<GraphicsSystem>();
 
+        m_serviceProvider.RegisterService(&m_renderingService);
+        m_serviceProvider.RegisterService(&m_imguiService);
+
+        // Index the asset directory and hot-reload modified assets
+        m_assetDatabase.Initialize(DEFAULT_ASSETS_DIR, &m_assetService);
+        m_serviceProvider.RegisterService(&m_assetDatabase);
+
+        MountSceneBundle("scene.aln");
         m_editor.Initialize(m_serviceProvider, "scene.aln");
 
         ShareImGuiContext();
@@ -127,27 +78,17 @@ class Engine
         ZoneScoped;
 
         m_renderEngine.WaitIdle();
-
         m_editor.Shutdown();
-
-        // TODO: Destroy world entity
-        m_worldEntity.Shutdown();
-
-        m_assetService.Shutdown();
-        m_renderingService.Shutdown();
+        m_assetDatabase.Shutdown();
 
         EngineModuleContext moduleContext = {
             .m_pTypeRegistryService = &m_typeRegistryService,
         };
-
-        m_coreModule.Shutdown(moduleContext);
-        m_assetsModule.Shutdown(moduleContext);
-        m_animModule.Shutdown(moduleContext);
         m_toolingModule.Shutdown(moduleContext);
-        m_entitiesModule.Shutdown(moduleContext);
 
-        m_serviceProvider.UnregisterAllServices();
+        EngineCore::Shutdown();
 
+        m_renderingService.Shutdown();
         m_renderEngine.Shutdown();
     }
 
@@ -168,35 +109,26 @@ class Engine
     {
         ZoneScoped;
 
-        // Update services
-        m_inputService.Update();
-        m_timeService.Update();
+        BeginFrame();
+        m_assetDatabase.Update();
         m_assetService.Update();
 
-        // Populate update context
         auto& dim = m_editor.GetScenePreviewSize();
-        m_updateContext.m_deltaTime = m_timeService.GetDeltaTime();
-        m_updateContext.m_currentTime = m_timeService.GetTime();
-        m_updateContext.m_timeSinceAppStart = m_timeService.GetTimeSinceAppStart();
-        m_updateContext.m_displayWidth = dim.x;
-        m_updateContext.m_displayHeight = dim.y;
+        SetDisplaySize(dim.x, dim.y);
 
         // When out of editor
         // context.displayWidth = m_window.GetWidth();
         // context.displayHeight = m_window.GetHeight();
 
-        // Loading stage
-        m_worldEntity.UpdateLoading();
+        Simulate();
 
-        // Object model: Update systems at various points in the frame.
-        // TODO: Handle sync points here ?
-        for (uint8_t stage = (uint8_t) UpdateStage::FrameStart; stage != (uint8_t) UpdateStage::NumStages; stage++)
-        {
-            ZoneScoped;
+        // Render between the last two simulation steps
+        SpatialComponent::SetRenderInterpolationFactor(m_interpolationFactor);
+        m_worldEntity.GetSystem<GraphicsSystem>()->PrepareRender();
 
-            m_updateContext.m_updateStage = static_cast<UpdateStage>(stage);
-            m_worldEntity.Update(m_updateContext);
-        }
+        // The editor runs once per frame, on real time
+        m_updateContext.m_deltaTime = m_frameDeltaTime;
+        m_updateContext.m_currentTime = m_timeService.GetTime();
 
         m_imguiService.StartFrame();
         m_editor.Update(m_updateContext);
@@ -204,9 +136,7 @@ class Engine
 
         m_renderingService.Render();
 
-        m_inputService.ClearFrameState();
+        EndFrame();
     }
-
-    InputService& GetInputService() { return m_inputService; }
 };
 } // namespace aln
\ No newline at end of file
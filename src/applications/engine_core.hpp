@@ -0,0 +1,352 @@
+#pragma once
+
+#include <anim/module/module.hpp>
+#include <assets/module/module.hpp>
+#include <core/module/module.hpp>
+#include <entities/module/module.hpp>
+
+#include <assets/asset_service.hpp>
+#include <common/drawing_context.hpp>
+#include <common/maths/maths.hpp>
+#include <common/memory.hpp>
+#include <common/profiling.hpp>
+#include <common/serialization/binary_archive.hpp>
+#include <common/services/service_provider.hpp>
+#include <common/threading/task_service.hpp>
+#include <core/asset_loaders/animation_graph_loader.hpp>
+#include <core/asset_loaders/animation_loader.hpp>
+#include <core/asset_loaders/material_loader.hpp>
+#include <core/asset_loaders/mesh_loader.hpp>
+#include <core/asset_loaders/skeleton_loader.hpp>
+#include <core/asset_loaders/texture_loader.hpp>
+#include <core/services/time_service.hpp>
+#include <core/world_systems/render_system.hpp>
+#include <core/world_systems/root_motion_system.hpp>
+#include <entities/entity_descriptors.hpp>
+#include <entities/spatial_component.hpp>
+#include <entities/world_entity.hpp>
+#include <entities/world_update.hpp>
+#include <input/input_service.hpp>
+#include <reflection/services/type_registry_service.hpp>
+
+#include <tracy/Tracy.hpp>
+
+#include <filesystem>
+#include <iostream>
+
+namespace aln
+{
+
+/// @brief How the simulation (entity and world systems) advances relative to rendered frames
+struct SimulationSettings
+{
+    /// When enabled, the simulation runs in steps of m_fixedTimestep, as many times per frame as the elapsed time requires.
+    /// Rendering interpolates between the last two steps. Otherwise, the simulation runs once per frame with the frame's delta time
+    bool m_useFixedTimestep = false;
+    float m_fixedTimestep = 1.0f / 60.0f;
+
+    /// Upper bound on the steps run in a single frame. Time past that is dropped, so that a long frame does not snowball into ever longer ones
+    uint32_t m_maxStepsPerFrame = 4;
+};
+
+/// @brief Simulation part of the engine: services, world, asset loading and time stepping.
+/// Does not depend on the window, ImGui or the editor, so that headless applications can run it on its own.
+/// The windowed Engine adds rendering and tooling on top of it
+class EngineCore
+{
+  protected:
+    // Services
+    ServiceProvider m_serviceProvider;
+    TaskService m_taskService;
+    AssetService m_assetService;
+    TimeService m_timeService;
+    InputService m_inputService;
+    TypeRegistryService m_typeRegistryService;
+
+    WorldEntity m_worldEntity;
+    UpdateContext m_updateContext;
+    EventListenerID m_assetReloadedEventID;
+
+    // Modules
+    Assets::Module m_assetsModule;
+    Core::Module m_coreModule;
+    Anim::Module m_animModule;
+    Entities::Module m_entitiesModule;
+
+    SimulationSettings m_simulationSettings;
+    float m_simulationTimeAccumulator = 0.0f; // Elapsed time not yet consumed by fixed steps
+    double m_simulationTime = 0.0;            // Simulated time, advanced by whole fixed steps
+
+    float m_frameDeltaTime = 0.0f;      // Real time elapsed during the current frame
+    uint32_t m_frameStepCount = 0;      // Simulation steps run during the current frame
+    float m_interpolationFactor = 1.0f; // Position of the current frame between the last two simulation steps
+
+    bool m_isTimeDrivenByReplay = false;
+    float m_fixedDeltaTimeBeforeReplay = 0.0f; // Time service's fixed delta when the current replay started, 0 for wall clock time
+
+    /// @brief Run a single simulation step: loading, then every update stage
+    void RunSimulationStep(float deltaTime)
+    {
+        ZoneScoped;
+
+        SpatialComponent::BeginSimulationTick();
+
+        // Debug geometry describes the latest step only
+        DebugDrawing::Clear();
+
+        m_updateContext.m_deltaTime = deltaTime;
+        if (m_simulationSettings.m_useFixedTimestep)
+        {
+            m_simulationTime += deltaTime;
+            m_updateContext.m_currentTime = (float) m_simulationTime;
+        }
+
+        // Loading stage
+        m_worldEntity.UpdateLoading();
+
+        // Object model: Update systems at various points in the frame.
+        // TODO: Handle sync points here ?
+        for (uint8_t stage = (uint8_t) UpdateStage::FrameStart; stage != (uint8_t) UpdateStage::NumStages; stage++)
+        {
+            ZoneScoped;
+            ALN_PROFILE_SCOPE(Profiling::GetUpdateStageName((UpdateStage) stage), ProfileCategory::UpdateStage);
+
+            m_updateContext.m_updateStage = static_cast<UpdateStage>(stage);
+            m_worldEntity.Update(m_updateContext);
+        }
+
+        SpatialComponent::EndSimulationTick();
+    }
+
+  public:
+    /// @brief Initialize everything the simulation needs
+    /// @param pRenderEngine: Render engine GPU resources are uploaded to. Null for headless engines, in which case loaders only keep the CPU data
+    void Initialize(RenderEngine* pRenderEngine)
+    {
+        ZoneScoped;
+
+        m_assetService.Initialize(m_taskService, pRenderEngine);
+
+        m_serviceProvider.RegisterService(&m_taskService);
+        m_serviceProvider.RegisterService(&m_assetService);
+        m_serviceProvider.RegisterService(&m_timeService);
+        m_serviceProvider.RegisterService(&m_inputService);
+        m_serviceProvider.RegisterService(&m_typeRegistryService);
+
+        m_updateContext.m_pServiceProvider = &m_serviceProvider;
+
+        // Initialize modules
+        EngineModuleContext moduleContext = {
+            .m_pTypeRegistryService = &m_typeRegistryService,
+        };
+
+        m_coreModule.Initialize(moduleContext);
+        m_assetsModule.Initialize(moduleContext);
+        m_animModule.Initialize(moduleContext);
+        m_entitiesModule.Initialize(moduleContext);
+
+        // TODO: Add a vector of loaded types to the Loader base class, specify them in the constructor of the specialized Loaders,
+        // then register each of them with a single function.
+        // Loaders of GPU resources only keep their CPU data when no render engine is provided
+        m_assetService.RegisterAssetLoader<StaticMesh, MeshLoader>(pRenderEngine);
+        m_assetService.RegisterAssetLoader<SkeletalMesh, MeshLoader>(pRenderEngine);
+        m_assetService.RegisterAssetLoader<Texture, TextureLoader>(pRenderEngine);
+        m_assetService.RegisterAssetLoader<Material, MaterialLoader>(pRenderEngine);
+        m_assetService.RegisterAssetLoader<AnimationClip, AnimationLoader>(nullptr);
+        m_assetService.RegisterAssetLoader<Skeleton, SkeletonLoader>();
+        m_assetService.RegisterAssetLoader<AnimationGraphDataset, AnimationGraphDatasetLoader>();
+        m_assetService.RegisterAssetLoader<AnimationGraphDefinition, AnimationGraphDefinitionLoader>(&m_typeRegistryService);
+
+        // Keep recently released meshes and textures resident so that respawned entities do not reload them
+        m_assetService.SetResidencyBudget<StaticMesh>({.m_cpuBytes = 64 * 1024 * 1024, .m_gpuBytes = 128 * 1024 * 1024});
+        m_assetService.SetResidencyBudget<SkeletalMesh>({.m_cpuBytes = 64 * 1024 * 1024, .m_gpuBytes = 128 * 1024 * 1024});
+        m_assetService.SetResidencyBudget<Texture>({.m_cpuBytes = 32 * 1024 * 1024, .m_gpuBytes = 256 * 1024 * 1024});
+
+        m_worldEntity.Initialize(m_serviceProvider);
+        // Culling runs on headless engines as well, only rendering needs the windowed engine
+        m_worldEntity.CreateSystem<GraphicsSystem>();
+        m_worldEntity.CreateSystem<RootMotionSystem>();
+
+        // Render instances keep raw pointers to their meshes, which hot reload replaces
+        m_assetReloadedEventID = m_assetService.OnAssetReloaded().BindListener([this](const AssetID& assetID)
+            { m_worldEntity.GetSystem<GraphicsSystem>()->HandleAssetReloaded(assetID); });
+    }
+
+    void Shutdown()
+    {
+        ZoneScoped;
+
+        m_assetService.OnAssetReloaded().UnbindListener(m_assetReloadedEventID);
+
+        // TODO: Destroy world entity
+        m_worldEntity.Shutdown();
+
+        m_assetService.Shutdown();
+
+        EngineModuleContext moduleContext = {
+            .m_pTypeRegistryService = &m_typeRegistryService,
+        };
+
+        m_coreModule.Shutdown(moduleContext);
+        m_assetsModule.Shutdown(moduleContext);
+        m_animModule.Shutdown(moduleContext);
+        m_entitiesModule.Shutdown(moduleContext);
+
+        m_serviceProvider.UnregisterAllServices();
+    }
+
+    /// @brief Mount the asset bundle packed alongside a scene (same name, .pak extension), if there is one
+    void MountSceneBundle(const std::filesystem::path& scenePath)
+    {
+        auto bundlePath = scenePath;
+        bundlePath.replace_extension(".pak");
+        if (std::filesystem::exists(bundlePath))
+        {
+            m_assetService.MountBundle(bundlePath);
+        }
+    }
+
+    /// @brief Instanciate the entities of a scene archive in the world
+    /// @return Whether the scene could be read
+    bool LoadScene(const std::filesystem::path& scenePath)
+    {
+        ZoneScoped;
+
+        if (!std::filesystem::exists(scenePath))
+        {
+            return false;
+        }
+
+        EntityMapDescriptor mapDescriptor;
+        BinaryFileArchive archive(scenePath, IBinaryArchive::IOMode::Read);
+        archive >> mapDescriptor;
+
+        if (!archive.IsValid())
+        {
+            std::cout << "Failed to read scene archive: " << scenePath << std::endl;
+            return false;
+        }
+
+        if (!mapDescriptor.IsValid())
+        {
+            std::cout << "Scene archive uses an outdated format and must be saved again: " << scenePath << std::endl;
+            return false;
+        }
+
+        mapDescriptor.InstanciateEntityMap(m_worldEntity.m_entityMap, m_worldEntity.m_loadingContext, m_typeRegistryService);
+        return true;
+    }
+
+    /// @brief Start a frame: update time and input, and the frame's timings. Assets are updated separately, so that the
+    /// windowed engine can queue hot reloads first
+    void BeginFrame()
+    {
+        ZoneScoped;
+
+        Memory::BeginFrame();
+        Profiling::BeginFrame();
+
+        // Update services
+        // Replays drive time with the recorded deltas so that the simulation matches the captured session.
+        // The previous time mode is restored once the replay is over
+        if (m_inputService.GetMode() == InputService::Mode::Replaying)
+        {
+            if (!m_isTimeDrivenByReplay)
+            {
+                m_fixedDeltaTimeBeforeReplay = m_timeService.GetFixedDeltaTime();
+                m_isTimeDrivenByReplay = true;
+            }
+            m_timeService.SetFixedDeltaTime(m_inputService.GetReplayDeltaTime());
+        }
+        else if (m_isTimeDrivenByReplay)
+        {
+            m_timeService.SetFixedDeltaTime(m_fixedDeltaTimeBeforeReplay);
+            m_isTimeDrivenByReplay = false;
+        }
+        m_timeService.Update();
+        m_inputService.Update(m_timeService.GetFrameCount(), m_timeService.GetDeltaTime());
+
+        // Populate update context
+        m_frameDeltaTime = m_timeService.GetDeltaTime();
+        m_updateContext.m_deltaTime = m_frameDeltaTime;
+        m_updateContext.m_currentTime = m_timeService.GetTime();
+        m_updateContext.m_timeSinceAppStart = m_timeService.GetTimeSinceAppStart();
+    }
+
+    /// @brief Run as many simulation steps as the frame covers
+    void Simulate()
+    {
+        ZoneScoped;
+
+        // Decide how many simulation steps this frame covers
+        m_frameStepCount = 1;
+        float stepDeltaTime = m_frameDeltaTime;
+        m_interpolationFactor = 1.0f;
+        if (m_simulationSettings.m_useFixedTimestep)
+        {
+            stepDeltaTime = m_simulationSettings.m_fixedTimestep;
+            m_simulationTimeAccumulator = Maths::Min(m_simulationTimeAccumulator + m_frameDeltaTime, stepDeltaTime * m_simulationSettings.m_maxStepsPerFrame);
+
+            m_frameStepCount = (uint32_t) (m_simulationTimeAccumulator / stepDeltaTime);
+            m_simulationTimeAccumulator -= m_frameStepCount * stepDeltaTime;
+            m_interpolationFactor = m_simulationTimeAccumulator / stepDeltaTime;
+        }
+
+        Profiling::IncrementCounter("SimulationSteps", m_frameStepCount);
+
+        // Input is only consumed by frames that simulate, so that changes received during skipped frames are not lost
+        if (m_frameStepCount > 0)
+        {
+            m_inputService.UpdateDevices();
+        }
+
+        for (uint32_t stepIdx = 0; stepIdx < m_frameStepCount; ++stepIdx)
+        {
+            RunSimulationStep(stepDeltaTime);
+        }
+    }
+
+    void EndFrame()
+    {
+        if (m_frameStepCount > 0)
+        {
+            m_inputService.ClearFrameState();
+        }
+
+        Profiling::EndFrame();
+    }
+
+    /// @brief Run a full frame without rendering
+    void Update()
+    {
+        ZoneScoped;
+
+        BeginFrame();
+        m_assetService.Update();
+        Simulate();
+        EndFrame();
+    }
+
+    /// @brief Change how the simulation advances. Resets the fixed step accumulator
+    void SetSimulationSettings(const SimulationSettings& settings)
+    {
+        assert(!settings.m_useFixedTimestep || (settings.m_fixedTimestep > 0.0f && settings.m_maxStepsPerFrame > 0));
+
+        m_simulationSettings = settings;
+        m_simulationTimeAccumulator = 0.0f;
+        m_simulationTime = m_timeService.GetTime();
+    }
+
+    const SimulationSettings& GetSimulationSettings() const { return m_simulationSettings; }
+
+    /// @brief Set the dimensions reported to systems that depend on the viewport (i.e. camera culling)
+    void SetDisplaySize(float width, float height)
+    {
+        m_updateContext.m_displayWidth = width;
+        m_updateContext.m_displayHeight = height;
+    }
+
+    InputService& GetInputService() { return m_inputService; }
+    TimeService& GetTimeService() { return m_timeService; }
+};
+} // namespace aln
@@ -11,6 +11,9 @@
 #include <GLFW/glfw3.h>
 #include <vulkan/vulkan.hpp>
 
+#include <filesystem>
+#include <string>
+
 namespace aln
 {
 
@@ -24,12 +27,22 @@ class GLFWApplication
 
     Engine m_engine;
 
+    InputRecording m_inputRecording;
+    std::filesystem::path m_inputRecordingPath;
+
   public:
     void Initialize()
     {
         m_window.Initialize();
         m_engine.Initialize(&m_window);
 
+        // Simulate at 60Hz regardless of the display's refresh rate, and interpolate what is rendered in between
+        m_engine.SetSimulationSettings({
+            .m_useFixedTimestep = true,
+            .m_fixedTimestep = 1.0f / 60.0f,
+            .m_maxStepsPerFrame = 4,
+        });
+
         m_window.SetMouseButtonCallback([&](Mouse::Button button, ButtonState state)
             { m_engine.GetInputService().UpdateMouseControlState(button, state); });
         m_window.SetKeyCallback([&](Keyboard::Key key, ButtonState state)
@@ -40,8 +53,21 @@ class GLFWApplication
             { m_engine.m_renderEngine.GetWindow()->GetSwapchain().TargetWindowResizedCallback(width, height); });
     }
 
+    /// @brief Capture the session's input, to be written to a file on shutdown
+    void StartInputRecording(const std::filesystem::path& recordingPath)
+    {
+        m_inputRecordingPath = recordingPath;
+        m_engine.GetInputService().StartRecording(&m_inputRecording);
+    }
+
     void Shutdown()
     {
+        if (m_engine.GetInputService().GetMode() == InputService::Mode::Recording)
+        {
+            m_engine.GetInputService().StopRecording();
+            m_inputRecording.Save(m_inputRecordingPath);
+        }
+
         m_engine.Shutdown();
         m_window.Shutdown();
     }
@@ -89,7 +115,8 @@ class GLFWApplication
             if (glfwJoystickIsGamepad(joystickIdx))
             {
                 // TODO: Handle multiple controllers
-                auto& gamepad = m_engine.GetInputService().m_gamepad;
+                auto& inputService = m_engine.GetInputService();
+                const auto pGamepad = inputService.GetGamepad();
 
                 GLFWgamepadstate state;
                 if (glfwGetGamepadState(joystickIdx, &state))
@@ -99,25 +126,25 @@ class GLFWApplication
                         // Only trigger events if the state changed
                         if (state.buttons[buttonIdx] == GLFW_PRESS)
                         {
-                            if (!gamepad.m_buttons[buttonIdx].IsHeld())
+                            if (!pGamepad->IsHeld((Gamepad::Button) buttonIdx))
                             {
                                 // TODO: Map from GLFW button to our actual values
-                                gamepad.SetButtonPressed((Gamepad::Button) buttonIdx);
+                                inputService.UpdateGamepadButtonState((Gamepad::Button) buttonIdx, ButtonState::Pressed);
                             }
                         }
                         else
                         {
-                            if (gamepad.m_buttons[buttonIdx].IsHeld())
+                            if (pGamepad->IsHeld((Gamepad::Button) buttonIdx))
                             {
-                                gamepad.SetButtonReleased((Gamepad::Button) buttonIdx);
+                                inputService.UpdateGamepadButtonState((Gamepad::Button) buttonIdx, ButtonState::Released);
                             }
                         }
                     }
 
-                    gamepad.SetLeftStickState({state.axes[GLFW_GAMEPAD_AXIS_LEFT_X], state.axes[GLFW_GAMEPAD_AXIS_LEFT_Y]});
-                    gamepad.SetRightStickState({state.axes[GLFW_GAMEPAD_AXIS_RIGHT_X], state.axes[GLFW_GAMEPAD_AXIS_RIGHT_Y]});
-                    gamepad.SetLeftTriggerState(state.axes[GLFW_GAMEPAD_AXIS_LEFT_TRIGGER]);
-                    gamepad.SetRightTriggerState(state.axes[GLFW_GAMEPAD_AXIS_RIGHT_TRIGGER]);
+                    inputService.UpdateGamepadStickState(true, {state.axes[GLFW_GAMEPAD_AXIS_LEFT_X], state.axes[GLFW_GAMEPAD_AXIS_LEFT_Y]});
+                    inputService.UpdateGamepadStickState(false, {state.axes[GLFW_GAMEPAD_AXIS_RIGHT_X], state.axes[GLFW_GAMEPAD_AXIS_RIGHT_Y]});
+                    inputService.UpdateGamepadTriggerState(true, state.axes[GLFW_GAMEPAD_AXIS_LEFT_TRIGGER]);
+                    inputService.UpdateGamepadTriggerState(false, state.axes[GLFW_GAMEPAD_AXIS_RIGHT_TRIGGER]);
                 }
             }
         }
@@ -126,11 +153,16 @@ class GLFWApplication
 };
 } // namespace aln
 
-int main()
+/// @brief Usage: editor [--record input_recording_path]
+int main(int argc, char** argv)
 {
     aln::GLFWApplication* pApp = aln::New<aln::GLFWApplication>();
 
     pApp->Initialize();
+    if (argc > 2 && std::string(argv[1]) == "--record")
+    {
+        pApp->StartInputRecording(argv[2]);
+    }
     pApp->Run();
     pApp->Shutdown();
 
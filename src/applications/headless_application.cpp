@@ -0,0 +1,137 @@
+#include "engine_core.hpp"
+
+#include <common/memory.hpp>
+#include <common/profiling.hpp>
+
+#include <tracy/Tracy.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace aln
+{
+
+/// @brief Application running the engine's simulation without window, GPU or editor.
+/// Used for dedicated servers, automated tests and CPU-side benchmarks
+class HeadlessApplication
+{
+  private:
+    static constexpr float DefaultFixedDeltaTime = 1.0f / 60.0f;
+    // Viewport dimensions reported to systems that depend on it (i.e. camera culling)
+    static constexpr float DefaultDisplayWidth = 1920.0f;
+    static constexpr float DefaultDisplayHeight = 1080.0f;
+
+    EngineCore m_engine;
+    InputRecording m_inputRecording;
+
+  public:
+    void Initialize(const std::filesystem::path& scenePath)
+    {
+        m_engine.Initialize(nullptr);
+        m_engine.MountSceneBundle(scenePath);
+        m_engine.SetDisplaySize(DefaultDisplayWidth, DefaultDisplayHeight);
+        m_engine.LoadScene(scenePath);
+
+        // Simulate at a fixed rate so that runs are comparable across machines and builds
+        m_engine.GetTimeService().SetFixedDeltaTime(DefaultFixedDeltaTime);
+
+        // Step the simulation like the windowed application does, so that replayed sessions run the same steps
+        m_engine.SetSimulationSettings({
+            .m_useFixedTimestep = true,
+            .m_fixedTimestep = DefaultFixedDeltaTime,
+            .m_maxStepsPerFrame = 4,
+        });
+    }
+
+    /// @brief Feed the engine with a captured input session instead of live input
+    /// @return The number of recorded frames, 0 if the recording could not be loaded
+    uint32_t StartInputReplay(const std::filesystem::path& recordingPath)
+    {
+        if (!m_inputRecording.Load(recordingPath))
+        {
+            std::cerr << "Failed to load input recording " << recordingPath << std::endl;
+            return 0;
+        }
+
+        m_engine.GetInputService().StartReplay(&m_inputRecording);
+        return m_inputRecording.GetFrameCount();
+    }
+
+    void Shutdown()
+    {
+        m_engine.Shutdown();
+    }
+
+    /// @brief Run a fixed number of frames and report the average cpu frame time
+    void Run(uint32_t frameCount)
+    {
+        const auto startTime = std::chrono::high_resolution_clock::now();
+        for (uint32_t frameIdx = 0; frameIdx < frameCount; ++frameIdx)
+        {
+            m_engine.Update();
+            FrameMark;
+        }
+        const auto endTime = std::chrono::high_resolution_clock::now();
+
+        if (frameCount > 0)
+        {
+            const auto totalMilliseconds = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+            std::cout << "Simulated " << frameCount << " frames in " << totalMilliseconds << "ms ("
+                      << totalMilliseconds / frameCount << "ms/frame)" << std::endl;
+        }
+    }
+
+    /// @brief Dump the profiler's per-stage and per-system statistics. Written as CSV if the extension is .csv, JSON otherwise
+    void WriteProfile(const std::filesystem::path& profilePath)
+    {
+        std::ofstream stream(profilePath);
+        if (profilePath.extension() == ".csv")
+        {
+            Profiling::WriteCSV(stream);
+        }
+        else
+        {
+            Profiling::WriteJSON(stream);
+        }
+    }
+};
+} // namespace aln
+
+/// @brief Usage: headless [scene_path] [frame_count] [profile_output_path or -] [input_recording_path]
+/// When an input recording is provided, at most its number of frames are simulated
+int main(int argc, char** argv)
+{
+    std::filesystem::path scenePath = (argc > 1) ? argv[1] : "scene.aln";
+    uint32_t frameCount = (argc > 2) ? (uint32_t) std::stoul(argv[2]) : 1000;
+
+    aln::HeadlessApplication* pApp = aln::New<aln::HeadlessApplication>();
+
+    pApp->Initialize(scenePath);
+    if (argc > 4)
+    {
+        frameCount = std::min(frameCount, pApp->StartInputReplay(argv[4]));
+    }
+    pApp->Run(frameCount);
+    if (argc > 3 && std::string(argv[3]) != "-")
+    {
+        pApp->WriteProfile(argv[3]);
+    }
+    pApp->Shutdown();
+
+    aln::Delete(pApp);
+
+#ifdef ALN_DEBUG
+    tracy::GetProfiler().RequestShutdown();
+    while (!tracy::GetProfiler().HasShutdownFinished())
+    {
+        continue;
+    }
+#endif
+
+    return EXIT_SUCCESS;
+}
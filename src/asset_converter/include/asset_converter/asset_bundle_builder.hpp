@@ -0,0 +1,42 @@
+#pragma once
+
+#include <common/containers/hash_map.hpp>
+#include <common/containers/vector.hpp>
+
+#include <filesystem>
+#include <string>
+
+namespace aln::assets::converter
+{
+/// @brief Pack converted asset archives into a single bundle file, read by the runtime's AssetBundle.
+/// Archives are laid out depth first with every asset before its dependencies, which is the order the asset service requests them in:
+/// an asset's dependencies are only known once its archive has been read
+class AssetBundleBuilder
+{
+  private:
+    struct BundledAsset
+    {
+        std::string m_path;
+        Vector<std::byte> m_data;
+        Vector<std::string> m_dependencies;
+    };
+
+    Vector<BundledAsset> m_assets;
+    HashMap<std::string, uint32_t, std::hash<std::string>> m_assetIndices;
+
+    /// @brief Append an asset to the layout, followed by its (not yet placed) dependencies
+    void VisitAsset(uint32_t assetIdx, Vector<uint8_t>& visitStates, Vector<uint32_t>& outLayout) const;
+
+  public:
+    /// @brief Read an asset archive and add it to the bundle
+    /// @param assetPath: Path of the archive, as referenced by asset IDs
+    bool AddAsset(const std::string& assetPath);
+
+    /// @brief Write the bundle
+    /// @param compress: Compress archives with LZ4 when it makes them smaller
+    /// @return false if two assets' IDs share the same hash, or the file could not be written
+    bool Write(const std::filesystem::path& bundlePath, bool compress = true) const;
+
+    uint32_t GetAssetCount() const { return m_assets.size(); }
+};
+} // namespace aln::assets::converter
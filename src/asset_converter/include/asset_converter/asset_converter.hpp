@@ -3,12 +3,18 @@
 #include <assimp/scene.h>
 
 #include "assimp_scene_context.hpp"
+#include "conversion_context.hpp"
 #include "raw_assets/raw_animation.hpp"
 #include "raw_assets/raw_material.hpp"
 #include "raw_assets/raw_mesh.hpp"
 #include "raw_assets/raw_skeleton.hpp"
 
+#include <common/serialization/hash.hpp>
+#include <common/threading/task_service.hpp>
+
+#include <atomic>
 #include <filesystem>
+#include <iostream>
 
 namespace aln::assets::converter
 {
@@ -29,11 +35,34 @@ class AssetConverter
         aiProcess_PopulateArmatureData;
 
   public:
-    AssetConverter(std::filesystem::path& outputDirectory)
+    /// @brief Hash of the settings affecting the converted assets. Outputs converted with different settings are considered outdated
+    static uint64_t GetImportSettingsHash()
+    {
+        const auto colorSettings = TextureCompressionSettings::FromUsage(TextureUsage::Color);
+        const auto normalSettings = TextureCompressionSettings::FromUsage(TextureUsage::Normal);
+        const auto maskSettings = TextureCompressionSettings::FromUsage(TextureUsage::Mask);
+        const uint32_t settings[] = {
+            (uint32_t) AssimpPostProcessFlags,
+            (uint32_t) colorSettings.m_mipFilter,
+            (uint32_t) colorSettings.m_isSRGB,
+            (uint32_t) colorSettings.m_generateMips,
+            (uint32_t) normalSettings.m_mipFilter,
+            (uint32_t) normalSettings.m_isSRGB,
+            (uint32_t) normalSettings.m_generateMips,
+            (uint32_t) maskSettings.m_mipFilter,
+            (uint32_t) maskSettings.m_isSRGB,
+            (uint32_t) maskSettings.m_generateMips,
+        };
+        return XXH64(settings, sizeof(settings), hash::Seed);
+    }
+
+    /// @note Assimp importers are not thread safe: use one converter per thread
+    AssetConverter(ConversionContext& conversionContext)
     {
-        std::filesystem::create_directory(outputDirectory);
-        m_sceneContext.m_outputDirectoryPath = outputDirectory;
+        std::filesystem::create_directory(conversionContext.GetOutputDirectory());
+        m_sceneContext.m_outputDirectoryPath = conversionContext.GetOutputDirectory();
         m_sceneContext.m_outputDirectoryPath.make_preferred();
+        m_sceneContext.m_pConversionContext = &conversionContext;
 
         m_importer.SetPropertyBool(AI_CONFIG_IMPORT_FBX_PRESERVE_PIVOTS, false);
     }
@@ -56,54 +85,99 @@ class AssetConverter
         }
     }
 
-    void ReadFile(std::filesystem::path inputFile)
+    /// @brief Convert all the assets of a scene file
+    /// @return false if the file could not be imported, or some of its assets could not be converted
+    bool ReadFile(std::filesystem::path inputFile)
     {
+        m_sceneContext.m_skeletons.clear();
+        m_sceneContext.m_materials.clear();
+        m_sceneContext.m_outputs.clear();
+        m_sceneContext.m_dependencies.clear();
+
         m_sceneContext.m_pScene = m_importer.ReadFile(inputFile.string(), AssimpPostProcessFlags);
         m_sceneContext.m_sourceFilePath = inputFile;
         m_sceneContext.m_sourceFilePath.make_preferred();
 
         if (m_sceneContext.m_pScene == nullptr)
         {
-            // TODO: Handle error
-            auto errorString = m_importer.GetErrorString();
-            assert(false);
+            std::cout << "Failed to import " << inputFile << ": " << m_importer.GetErrorString() << std::endl;
+            return false;
         }
 
         //RecursivePrint(m_sceneContext.GetRootNode());
 
         m_sceneContext.m_inverseSceneTransform = m_sceneContext.DecomposeMatrix(m_sceneContext.m_pScene->mRootNode->mTransformation).GetInverse();
 
+        // Meshes reference materials, read them first
         ReadMaterials();
-        ReadMeshes();
+        const auto meshesConverted = ReadMeshes();
         ReadAnimations();
+
+        m_importer.FreeScene();
+        m_sceneContext.m_pScene = nullptr;
+
+        return meshesConverted;
     }
 
+    const AssimpSceneContext& GetSceneContext() const { return m_sceneContext; }
+
   private:
+    /// @brief Execute a function for each index in [0, count[, in parallel when a task service is available
+    template <typename Function>
+    void ParallelFor(uint32_t count, Function&& function)
+    {
+        auto pTaskService = m_sceneContext.GetTaskService();
+        if (pTaskService != nullptr && count > 1)
+        {
+            TaskSet task(count, [&](TaskSetPartition range, uint32_t threadIdx)
+                {
+                for (auto index = range.start; index < range.end; ++index)
+                {
+                    function(index);
+                } });
+            pTaskService->ExecuteTask(&task);
+        }
+        else
+        {
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                function(index);
+            }
+        }
+    }
+
     void ReadAnimations()
     {
         const auto pScene = m_sceneContext.GetScene();
         if (pScene->HasAnimations())
         {
+            // Skeletons are shared between animations, build them before reading the animations in parallel
+            Vector<const RawSkeleton*> skeletons(pScene->mNumAnimations);
             for (auto animIndex = 0; animIndex < pScene->mNumAnimations; ++animIndex)
             {
-                auto pAnimation = pScene->mAnimations[animIndex];
-                const auto pSkeleton = AssimpSkeletonReader::ReadSkeleton(m_sceneContext, pAnimation);
-                AssimpAnimationReader::ReadAnimation(m_sceneContext, pAnimation, pSkeleton);
+                skeletons[animIndex] = AssimpSkeletonReader::ReadSkeleton(m_sceneContext, pScene->mAnimations[animIndex]);
             }
+
+            ParallelFor(pScene->mNumAnimations, [&](uint32_t animIndex)
+                { AssimpAnimationReader::ReadAnimation(m_sceneContext, pScene->mAnimations[animIndex], skeletons[animIndex]); });
         }
     }
 
-    void ReadMeshes()
+    /// @return false if any of the meshes could not be converted
+    bool ReadMeshes()
     {
+        std::atomic<bool> allConverted = true;
         const auto& pScene = m_sceneContext.GetScene();
         if (pScene->HasMeshes())
         {
-            for (auto meshIndex = 0; meshIndex < pScene->mNumMeshes; ++meshIndex)
-            {
-                auto pMesh = pScene->mMeshes[meshIndex];
-                AssimpMeshReader::ReadMesh(m_sceneContext, pMesh);
-            }
+            ParallelFor(pScene->mNumMeshes, [&](uint32_t meshIndex)
+                {
+                if (!AssimpMeshReader::ReadMesh(m_sceneContext, pScene->mMeshes[meshIndex]))
+                {
+                    allConverted = false;
+                } });
         }
+        return allConverted;
     }
 
     void ReadMaterials()
@@ -111,12 +185,9 @@ class AssetConverter
         const auto pScene = m_sceneContext.GetScene();
         if (pScene->HasMaterials())
         {
-            for (auto materialIndex = 0; materialIndex < pScene->mNumMaterials; ++materialIndex)
-            {
-                auto pMaterial = pScene->mMaterials[materialIndex];
-                auto id = AssimpMaterialReader::ReadMaterial(m_sceneContext, pMaterial);
-                m_sceneContext.m_materials.push_back(id);
-            }
+            m_sceneContext.m_materials.resize(pScene->mNumMaterials);
+            ParallelFor(pScene->mNumMaterials, [&](uint32_t materialIndex)
+                { m_sceneContext.m_materials[materialIndex] = AssimpMaterialReader::ReadMaterial(m_sceneContext, pScene->mMaterials[materialIndex]); });
         }
     }
 };
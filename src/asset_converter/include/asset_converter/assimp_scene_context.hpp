@@ -1,5 +1,6 @@
 #pragma once
 
+#include "conversion_context.hpp"
 #include "raw_assets/raw_skeleton.hpp"
 
 #include <common/maths/quaternion.hpp>
@@ -15,6 +16,7 @@
 
 #include <assert.h>
 #include <filesystem>
+#include <mutex>
 
 namespace aln::assets::converter
 {
@@ -34,8 +36,19 @@ class AssimpSceneContext
     std::filesystem::path m_sourceFilePath;
     std::filesystem::path m_outputDirectoryPath;
 
+    ConversionContext* m_pConversionContext = nullptr;
+
+    // Files written and read by the conversion of this scene, recorded in the conversion manifest
+    mutable Vector<std::string> m_outputs;
+    mutable Vector<std::filesystem::path> m_dependencies;
+
+    // Meshes and animations are read in parallel
+    mutable std::mutex m_mutex;
+
   public:
     const aiScene* GetScene() const { return m_pScene; }
+    TaskService* GetTaskService() const { return m_pConversionContext->GetTaskService(); }
+    ConversionContext* GetConversionContext() const { return m_pConversionContext; }
     const aiNode* GetRootNode() const { return m_pScene->mRootNode; }
 
     // Helpers translating assimp struct to ours
@@ -55,7 +68,7 @@ class AssimpSceneContext
     /// @param pOutSkeleton: a pointer to the existing or newly created skeleton
     /// @return true if the skeleton already existed
     bool TryGetSkeleton(const std::string& skeletonName, RawSkeleton*& pOutSkeleton) const;
-    const AssetID& GetMaterial(size_t materialIndex)
+    const AssetID& GetMaterial(size_t materialIndex) const
     {
         assert(materialIndex >= 0 && materialIndex < m_materials.size());
         return m_materials[materialIndex];
@@ -63,11 +76,20 @@ class AssimpSceneContext
 
     Transform GetGlobalTransform(const aiNode* pNode) const;
 
+    /// @brief Register a file produced by the conversion of this scene
+    /// @return Whether the file should be written. Files shared with other scenes are only written once per conversion run
+    bool RegisterOutput(const std::filesystem::path& outputPath) const;
+
+    /// @brief Register an external file read during the conversion of this scene, so that the scene is converted again when it changes
+    void RegisterDependency(const std::filesystem::path& dependencyPath) const;
+
     // -------------
     // Path manipulation
     // -------------
 
     const std::filesystem::path& GetSourceFile() const { return m_sourceFilePath; }
+    const Vector<std::string>& GetOutputs() const { return m_outputs; }
+    const Vector<std::filesystem::path>& GetDependencies() const { return m_dependencies; }
     const std::filesystem::path& GetOutputDirectory() const { return m_outputDirectoryPath; }
     std::filesystem::path GetPathRelativeToOutput(const std::filesystem::path& path) const
     {
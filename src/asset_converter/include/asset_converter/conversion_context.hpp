@@ -0,0 +1,66 @@
+#pragma once
+
+#include <common/containers/set.hpp>
+
+#include <filesystem>
+#include <mutex>
+#include <string>
+
+namespace aln
+{
+class TaskService;
+}
+
+namespace aln::assets::converter
+{
+/// @brief State shared by all the files converted in a single run.
+/// Ensures assets referenced from multiple source files (textures, materials, skeletons) are only written once.
+/// @note Thread safe
+class ConversionContext
+{
+  private:
+    std::filesystem::path m_inputDirectory;
+    std::filesystem::path m_outputDirectory;
+    TaskService* m_pTaskService = nullptr;
+
+    Set<std::string> m_claimedOutputs;
+    std::mutex m_mutex;
+
+  public:
+    ConversionContext(const std::filesystem::path& inputDirectory, const std::filesystem::path& outputDirectory, TaskService* pTaskService = nullptr)
+        : m_inputDirectory(inputDirectory.lexically_normal()), m_outputDirectory(outputDirectory.lexically_normal()), m_pTaskService(pTaskService)
+    {
+        m_inputDirectory.make_preferred();
+        m_outputDirectory.make_preferred();
+    }
+
+    const std::filesystem::path& GetInputDirectory() const { return m_inputDirectory; }
+    const std::filesystem::path& GetOutputDirectory() const { return m_outputDirectory; }
+    TaskService* GetTaskService() const { return m_pTaskService; }
+
+    /// @brief Claim the right to write an output file
+    /// @return false if the output was already claimed by another conversion of this run
+    bool ClaimOutput(const std::filesystem::path& outputPath)
+    {
+        std::lock_guard lock(m_mutex);
+        auto [it, inserted] = m_claimedOutputs.insert(outputPath.lexically_normal().string());
+        return inserted;
+    }
+
+    /// @brief Output path of a texture read from a file. Textures located in the input directory are mirrored in the output directory,
+    /// so that all the scenes referencing them (and the standalone conversion of the file itself) share a single asset.
+    /// @param fallbackPath: Path used for textures located outside of the input directory
+    std::filesystem::path GetTextureOutputPath(const std::filesystem::path& sourcePath, const std::filesystem::path& fallbackPath) const
+    {
+        auto relativePath = sourcePath.lexically_normal().lexically_relative(m_inputDirectory);
+        if (relativePath.empty() || *relativePath.begin() == "..")
+        {
+            return fallbackPath;
+        }
+
+        auto outputPath = m_outputDirectory / relativePath;
+        outputPath.replace_extension("text");
+        return outputPath;
+    }
+};
+} // namespace aln::assets::converter
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <common/containers/hash_map.hpp>
+#include <common/containers/vector.hpp>
+
+#include <filesystem>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+
+namespace aln::assets::converter
+{
+/// @brief Conversion record of a single source file
+struct ManifestEntry
+{
+    /// @brief An external file read during the conversion (i.e. a texture referenced by a scene)
+    struct Dependency
+    {
+        std::string m_path;
+        uint64_t m_hash = 0;
+    };
+
+    uint64_t m_sourceHash = 0;
+    uint64_t m_settingsHash = 0;
+
+    Vector<std::string> m_outputs;
+    Vector<Dependency> m_dependencies;
+};
+
+/// @brief Persistent record of the previous conversions, used to skip source files that did not change since they were last converted.
+/// Entries are keyed by source path, relative to the input directory.
+/// @note Thread safe
+class ConversionManifest
+{
+  private:
+    static constexpr uint32_t Version = 2; // 2: Also stores the asset archive format version, so that outputs are converted again when it changes
+
+    HashMap<std::string, ManifestEntry, std::hash<std::string>> m_entries;
+    mutable std::mutex m_mutex;
+
+  public:
+    /// @brief Load a manifest from disk. A missing or outdated manifest results in an empty one
+    void Load(const std::filesystem::path& manifestPath);
+    void Save(const std::filesystem::path& manifestPath) const;
+
+    /// @brief Whether a source file was already converted with the same content and settings,
+    /// none of its dependencies changed and all of its outputs still exist
+    bool IsUpToDate(const std::string& sourcePath, uint64_t sourceHash, uint64_t settingsHash) const;
+
+    /// @brief Outputs of every recorded source file
+    Vector<std::string> GetAllOutputs() const;
+
+    void Update(const std::string& sourcePath, ManifestEntry&& entry);
+
+    /// @brief Hash the content of a file
+    /// @return 0 if the file could not be read
+    static uint64_t HashFile(const std::filesystem::path& path);
+};
+} // namespace aln::assets::converter
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <common/containers/vector.hpp>
+#include <common/maths/vec3.hpp>
+
+#include <assert.h>
+#include <stdint.h>
+
+namespace aln::assets::converter
+{
+/// @brief Index and vertex buffer reordering passes run on meshes before they are serialized.
+/// @note Passes are expected to run in order: vertex cache, then overdraw, then vertex fetch.
+class MeshOptimizer
+{
+  public:
+    /// @brief Size of the simulated post-transform vertex cache
+    static constexpr uint32_t VertexCacheSize = 32;
+
+    /// @brief Reorder triangles to maximize post-transform vertex cache hits
+    /// @note Implements "Linear-Speed Vertex Cache Optimisation" (T. Forsyth, 2006)
+    static void OptimizeVertexCache(Vector<uint32_t>& indices, size_t vertexCount);
+
+    /// @brief Reorder clusters of triangles so that outward-facing ones are drawn first, reducing overdraw.
+    /// Clusters are split where the vertex cache is effectively flushed, so the cache efficiency of the previous pass is preserved.
+    /// @note Based on "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw" (Sander et al. 2007)
+    static void OptimizeOverdraw(Vector<uint32_t>& indices, const Vector<Vec3>& positions);
+
+    /// @brief Compute a vertex remap table ordering vertices by first use in the index buffer, and update the indices accordingly.
+    /// Unreferenced vertices are dropped.
+    /// @return The remap table, mapping new vertex indices to the original ones
+    static Vector<uint32_t> OptimizeVertexFetch(Vector<uint32_t>& indices, size_t vertexCount);
+
+    /// @brief Apply a remap table produced by OptimizeVertexFetch to a vertex buffer
+    template <typename T>
+    static void RemapVertices(Vector<T>& vertices, const Vector<uint32_t>& remap)
+    {
+        Vector<T> remappedVertices;
+        remappedVertices.reserve(remap.size());
+        for (auto originalIndex : remap)
+        {
+            assert(originalIndex < vertices.size());
+            remappedVertices.push_back(vertices[originalIndex]);
+        }
+        vertices.swap(remappedVertices);
+    }
+
+    /// @brief Average number of transformed vertices per triangle for the given cache size. Useful to evaluate the passes.
+    static float ComputeACMR(const Vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize = VertexCacheSize);
+};
+} // namespace aln::assets::converter
@@ -151,16 +151,17 @@ struct AssimpAnimationReader
         }
 
         // --- Serialization
-        Vector<std::byte> data;
-        BinaryMemoryArchive dataStream(data, IBinaryArchive::IOMode::Write);
-        animation.Serialize(dataStream);
-
         AssetArchiveHeader header("anim"); // TODO: Use SkeletalMesh::GetStaticAssetType();
         header.AddDependency(pSkeleton->GetID());
 
         auto path = (sceneContext.GetOutputDirectory() / (animation.m_name + ".anim"));
-        auto archive = BinaryFileArchive(path.string(), IBinaryArchive::IOMode::Write);
-        archive << header << data;
+        if (sceneContext.RegisterOutput(path))
+        {
+            auto archive = BinaryFileArchive(path.string(), IBinaryArchive::IOMode::Write);
+            archive << header;
+            archive.WriteBlock([&](BinaryMemoryArchive& dataStream)
+                { animation.Serialize(dataStream); });
+        }
     }
 };
 } // namespace aln::assets::converter
@@ -37,6 +37,16 @@ class AssimpMaterialReader
             return AssetID();
         }
 
+        auto exportPath = sceneContext.GetOutputDirectory() / name;
+        exportPath.replace_extension("mtrl");
+        auto id = AssetID(exportPath.string());
+
+        if (!sceneContext.RegisterOutput(exportPath))
+        {
+            // Material shared with another scene, which takes care of the conversion
+            return id;
+        }
+
         // Diffuse
         auto textureCount = pMaterial->GetTextureCount(aiTextureType_DIFFUSE);
         assert(textureCount <= 1); // We only support one texture for now
@@ -52,31 +62,40 @@ class AssimpMaterialReader
             const auto pEmbeddedTexture = sceneContext.GetScene()->GetEmbeddedTexture(texturePath.C_Str());
             if (pEmbeddedTexture != nullptr)
             {
-                textureID = AssimpTextureReader::ReadTexture(sceneContext, pEmbeddedTexture, textureExportPath);
+                textureID = AssetID(textureExportPath.string());
+                if (sceneContext.RegisterOutput(textureExportPath))
+                {
+                    AssimpTextureReader::ReadTexture(sceneContext, pEmbeddedTexture, textureExportPath, TextureUsage::Color);
+                }
             }
             else
             {
                 auto textureFilePath = sceneContext.GetSourceFile();
                 textureFilePath.replace_filename(texturePath.C_Str());
-                textureID = FileTextureReader::ReadTexture(textureFilePath, textureExportPath);
+
+                // Textures from the input directory are shared between all the scenes referencing them
+                const auto sharedExportPath = sceneContext.GetConversionContext()->GetTextureOutputPath(textureFilePath, textureExportPath);
+                if (sharedExportPath == textureExportPath)
+                {
+                    sceneContext.RegisterDependency(textureFilePath);
+                }
+
+                textureID = AssetID(sharedExportPath.string());
+                if (sceneContext.RegisterOutput(sharedExportPath))
+                {
+                    FileTextureReader::ReadTexture(textureFilePath, sharedExportPath, TextureUsage::Color, sceneContext.GetTaskService());
+                }
             }
             material.m_albedoMapID = textureID;
         }
 
-        auto exportPath = sceneContext.GetOutputDirectory() / name;
-        exportPath.replace_extension("mtrl");
-        auto id = AssetID(exportPath.string());
-
         AssetArchiveHeader header(id.GetAssetTypeID()); // TODO: Use Material::GetStaticAssetType
         header.AddDependency(material.m_albedoMapID);
 
-        Vector<std::byte> data;
-        auto dataStream = BinaryMemoryArchive(data, IBinaryArchive::IOMode::Write);
-
-        material.Serialize(dataStream);
-
         auto archive = BinaryFileArchive(std::filesystem::path(id.GetAssetPath()), BinaryFileArchive::IOMode::Write);
-        archive << header << data;
+        archive << header;
+        archive.WriteBlock([&](BinaryMemoryArchive& dataStream)
+            { material.Serialize(dataStream); });
         // TODO: Other textures
         // TODO: Material properties
 
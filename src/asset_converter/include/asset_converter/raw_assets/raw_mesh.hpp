@@ -1,63 +1,226 @@
 #pragma once
 
 #include "../assimp_scene_context.hpp"
+#include "../mesh_optimization.hpp"
 #include "raw_asset.hpp"
 #include "raw_skeleton.hpp"
 
 #include <assets/asset_archive_header.hpp>
 #include <assets/asset_id.hpp>
+#include <common/containers/array.hpp>
 #include <common/containers/vector.hpp>
+#include <common/maths/quantization.hpp>
 #include <common/serialization/binary_archive.hpp>
 #include <common/vertex.hpp>
 
 #include <assert.h>
 #include <filesystem>
+#include <iostream>
+#include <string.h>
 
 namespace aln::assets::converter
 {
-class RawStaticMesh : public IRawAsset
+/// @brief Full precision vertex used during conversion. Quantized to the runtime formats on serialization
+struct RawVertex
+{
+    Vec3 m_position;
+    Vec3 m_normal;
+    Vec2 m_texCoord;
+    Vec3 m_color = {1.0f, 1.0f, 1.0f};
+
+    // Skinning data
+    Array<uint32_t, 4> m_boneIndices = {0, 0, 0, 0};
+    Array<float, 4> m_weights = {0.0f, 0.0f, 0.0f, 0.0f};
+};
+
+/// @brief Geometry shared by static and skeletal meshes
+class RawMeshGeometry
 {
     friend class AssimpMeshReader;
 
+  protected:
     Vector<uint32_t> m_indices;
-    Vector<Vertex> m_vertices;
+    Vector<RawVertex> m_vertices;
+
+    /// @brief Reorder the index and vertex buffers for post-transform cache, overdraw and vertex fetch efficiency
+    void Optimize()
+    {
+        MeshOptimizer::OptimizeVertexCache(m_indices, m_vertices.size());
+
+        Vector<Vec3> positions;
+        positions.reserve(m_vertices.size());
+        for (const auto& vertex : m_vertices)
+        {
+            positions.push_back(vertex.m_position);
+        }
+        MeshOptimizer::OptimizeOverdraw(m_indices, positions);
+
+        const auto remap = MeshOptimizer::OptimizeVertexFetch(m_indices, m_vertices.size());
+        MeshOptimizer::RemapVertices(m_vertices, remap);
+    }
+
+    MeshBounds ComputeBounds() const
+    {
+        if (m_vertices.empty())
+        {
+            return {Vec3::Zeroes, Vec3::Ones};
+        }
+
+        Vec3 min = m_vertices[0].m_position;
+        Vec3 max = m_vertices[0].m_position;
+        for (const auto& vertex : m_vertices)
+        {
+            const auto& position = vertex.m_position;
+            min = Vec3(Maths::Min(min.x, position.x), Maths::Min(min.y, position.y), Maths::Min(min.z, position.z));
+            max = Vec3(Maths::Max(max.x, position.x), Maths::Max(max.y, position.y), Maths::Max(max.z, position.z));
+        }
+
+        MeshBounds bounds;
+        bounds.m_center = (min + max) * 0.5f;
+        bounds.m_halfExtent = (max - min) * 0.5f;
+
+        // Flat meshes would otherwise divide by zero when quantizing
+        for (uint8_t axis = 0; axis < 3; ++axis)
+        {
+            if (bounds.m_halfExtent[axis] < Maths::Epsilon)
+            {
+                bounds.m_halfExtent[axis] = 1.0f;
+            }
+        }
+        return bounds;
+    }
+
+    template <typename TVertex>
+    static void EncodeCommonAttributes(const RawVertex& rawVertex, const MeshBounds& bounds, TVertex& vertex)
+    {
+        vertex.pos = bounds.EncodePosition(rawVertex.m_position);
+
+        const auto octahedralNormal = Maths::OctahedralEncode(rawVertex.m_normal);
+        vertex.normal = {Maths::FloatToSnorm16(octahedralNormal.x), Maths::FloatToSnorm16(octahedralNormal.y)};
+
+        vertex.texCoord = {Maths::FloatToHalf(rawVertex.m_texCoord.x), Maths::FloatToHalf(rawVertex.m_texCoord.y)};
+        vertex.color = {Maths::FloatToUnorm8(rawVertex.m_color.x), Maths::FloatToUnorm8(rawVertex.m_color.y), Maths::FloatToUnorm8(rawVertex.m_color.z), 255};
+    }
+
+    /// @brief Serialize the bounds and index buffer. Indices are stored on 16 bits when possible
+    void SerializeIndices(BinaryMemoryArchive& archive, const MeshBounds& bounds) const
+    {
+        archive << bounds;
+
+        Vector<std::byte> indexData;
+        if (m_vertices.size() <= UINT16_MAX)
+        {
+            uint8_t bytesPerIndex = sizeof(uint16_t);
+            archive << bytesPerIndex;
+
+            indexData.resize(m_indices.size() * sizeof(uint16_t));
+            auto pIndices = reinterpret_cast<uint16_t*>(indexData.data());
+            for (size_t i = 0; i < m_indices.size(); ++i)
+            {
+                pIndices[i] = (uint16_t) m_indices[i];
+            }
+        }
+        else
+        {
+            uint8_t bytesPerIndex = sizeof(uint32_t);
+            archive << bytesPerIndex;
+
+            indexData.resize(m_indices.size() * sizeof(uint32_t));
+            memcpy(indexData.data(), m_indices.data(), indexData.size());
+        }
+        archive << indexData;
+    }
+};
+
+class RawStaticMesh : public IRawAsset, public RawMeshGeometry
+{
+    friend class AssimpMeshReader;
 
     void Serialize(BinaryMemoryArchive& archive) final override
     {
-        archive << m_indices;
+        Optimize();
+
+        const auto bounds = ComputeBounds();
+        SerializeIndices(archive, bounds);
 
         // Vertices need to be extracted in a Vector<std::byte> format
-        size_t byteSize = m_vertices.size() * sizeof(Vertex);
-        archive << byteSize;
-        archive.Write(m_vertices.data(), byteSize);
+        Vector<std::byte> vertexData(m_vertices.size() * sizeof(Vertex));
+        auto pVertices = reinterpret_cast<Vertex*>(vertexData.data());
+        for (size_t i = 0; i < m_vertices.size(); ++i)
+        {
+            EncodeCommonAttributes(m_vertices[i], bounds, pVertices[i]);
+        }
+        archive << vertexData;
     }
 };
 
-class RawSkeletalMesh : public IRawAsset
+class RawSkeletalMesh : public IRawAsset, public RawMeshGeometry
 {
     friend class AssimpMeshReader;
 
-    Vector<uint32_t> m_indices;
-    Vector<SkinnedVertex> m_vertices;
     Vector<Transform> m_inverseBindPose;
 
     RawSkeleton m_skeleton;
 
     void Serialize(BinaryMemoryArchive& archive) final override
     {
-        archive << m_indices;
+        Optimize();
+
+        const auto bounds = ComputeBounds();
+        SerializeIndices(archive, bounds);
 
         // Vertices need to be extracted in a Vector<std::byte> format
-        size_t byteSize = m_vertices.size() * sizeof(SkinnedVertex);
-        archive << byteSize;
-        archive.Write(m_vertices.data(), byteSize);
+        Vector<std::byte> vertexData(m_vertices.size() * sizeof(SkinnedVertex));
+        auto pVertices = reinterpret_cast<SkinnedVertex*>(vertexData.data());
+        for (size_t i = 0; i < m_vertices.size(); ++i)
+        {
+            const auto& rawVertex = m_vertices[i];
+            auto& vertex = pVertices[i];
+
+            EncodeCommonAttributes(rawVertex, bounds, vertex);
+            EncodeSkinningData(rawVertex, vertex);
+        }
+        archive << vertexData;
 
         archive << m_skeleton.m_boneNames;
         archive << m_skeleton.m_parentBoneIndices;
         archive << m_inverseBindPose;
     }
 
-    static void AddBoneData(SkinnedVertex& vertex, uint32_t boneIndex, float weight)
+    /// @brief Quantize the bone weights to unorm8, making sure they still sum up to exactly 255
+    static void EncodeSkinningData(const RawVertex& rawVertex, SkinnedVertex& vertex)
+    {
+        float weightsSum = 0.0f;
+        for (uint8_t idx = 0; idx < 4; ++idx)
+        {
+            weightsSum += rawVertex.m_weights[idx];
+        }
+
+        uint32_t quantizedSum = 0;
+        uint8_t heaviestIndex = 0;
+        for (uint8_t idx = 0; idx < 4; ++idx)
+        {
+            assert(rawVertex.m_boneIndices[idx] <= UINT8_MAX);
+            vertex.boneIndices[idx] = (uint8_t) rawVertex.m_boneIndices[idx];
+
+            const auto normalizedWeight = Maths::SafeDivide(rawVertex.m_weights[idx], weightsSum);
+            vertex.weights[idx] = Maths::FloatToUnorm8(normalizedWeight);
+            quantizedSum += vertex.weights[idx];
+
+            if (vertex.weights[idx] > vertex.weights[heaviestIndex])
+            {
+                heaviestIndex = idx;
+            }
+        }
+
+        // Give the rounding error to the most influent bone
+        if (quantizedSum > 0)
+        {
+            vertex.weights[heaviestIndex] = (uint8_t) (vertex.weights[heaviestIndex] + 255 - (int32_t) quantizedSum);
+        }
+    }
+
+    static void AddBoneData(RawVertex& vertex, uint32_t boneIndex, float weight)
     {
         /// @note Max influenced vertices is 4.
         // TODO: For now if more weights are detected only the most influent one are kept.
@@ -65,13 +228,13 @@ class RawSkeletalMesh : public IRawAsset
         float minWeight = 1;
         for (uint8_t idx = 0; idx < 4; ++idx)
         {
-            if (vertex.weights[idx] == 0)
+            if (vertex.m_weights[idx] == 0)
             {
-                vertex.boneIndices[idx] = boneIndex;
-                vertex.weights[idx] = weight;
+                vertex.m_boneIndices[idx] = boneIndex;
+                vertex.m_weights[idx] = weight;
                 return;
             }
-            else if (weight > vertex.weights[idx] && minWeight > vertex.weights[idx])
+            else if (weight > vertex.m_weights[idx] && minWeight > vertex.m_weights[idx])
             {
                 minIndex = idx;
                 minWeight = weight;
@@ -80,8 +243,8 @@ class RawSkeletalMesh : public IRawAsset
 
         if (minIndex < 5)
         {
-            vertex.weights[minIndex] = weight;
-            vertex.boneIndices[minIndex] = boneIndex;
+            vertex.m_weights[minIndex] = weight;
+            vertex.m_boneIndices[minIndex] = boneIndex;
         }
 
         // Too many weights for a single vertex
@@ -91,29 +254,25 @@ class RawSkeletalMesh : public IRawAsset
 
 struct AssimpMeshReader
 {
-    template <typename T>
-    static void ReadMeshData(Vector<T>& vertices, Vector<uint32_t>& indices, const aiMesh* pMesh, const AssimpSceneContext& context)
+    static void ReadMeshData(Vector<RawVertex>& vertices, Vector<uint32_t>& indices, const aiMesh* pMesh, const AssimpSceneContext& context)
     {
+        vertices.reserve(pMesh->mNumVertices);
         for (int vertexIndex = 0; vertexIndex < pMesh->mNumVertices; vertexIndex++)
         {
             auto& vertex = vertices.emplace_back();
 
-            vertex.pos = context.ToVec3(pMesh->mVertices[vertexIndex]);
-            vertex.normal = context.ToVec3(pMesh->mNormals[vertexIndex]);
+            vertex.m_position = context.ToVec3(pMesh->mVertices[vertexIndex]);
+            vertex.m_normal = context.ToVec3(pMesh->mNormals[vertexIndex]);
 
             if (pMesh->GetNumUVChannels() >= 1)
             {
-                vertex.texCoord[0] = pMesh->mTextureCoords[0][vertexIndex].x;
-                vertex.texCoord[1] = pMesh->mTextureCoords[0][vertexIndex].y;
+                vertex.m_texCoord.x = pMesh->mTextureCoords[0][vertexIndex].x;
+                vertex.m_texCoord.y = pMesh->mTextureCoords[0][vertexIndex].y;
             }
 
             if (pMesh->HasVertexColors(0))
             {
-                vertex.color = context.ToVec3(*pMesh->mColors[0]);
-            }
-            else
-            {
-                vertex.color = {1, 1, 1};
+                vertex.m_color = context.ToVec3(*pMesh->mColors[0]);
             }
         }
 
@@ -144,7 +303,8 @@ struct AssimpMeshReader
         }
     }
 
-    static void ReadMesh(AssimpSceneContext& context, const aiMesh* pMesh)
+    /// @return false if the mesh can not be converted
+    static bool ReadMesh(const AssimpSceneContext& context, const aiMesh* pMesh)
     {
         // TODO: Output naming
         std::string meshName = std::string(pMesh->mName.C_Str());
@@ -160,6 +320,13 @@ struct AssimpMeshReader
             // TODO: This should be done directly in the skeleton reader method
             assert((mesh.m_skeleton.GetBonesCount()) == pMesh->mNumBones);
 
+            // Skinned vertices store their bone indices on 8 bits
+            if (mesh.m_skeleton.GetBonesCount() > UINT8_MAX + 1)
+            {
+                std::cout << "Failed to convert mesh " << meshName << ": its skeleton has " << mesh.m_skeleton.GetBonesCount() << " bones, skinned meshes support up to " << UINT8_MAX + 1 << std::endl;
+                return false;
+            }
+
             mesh.m_inverseBindPose.resize(mesh.m_skeleton.GetBonesCount(), Transform::Identity);
             for (size_t meshBoneIndex = 0; meshBoneIndex < pMesh->mNumBones; ++meshBoneIndex)
             {
@@ -183,18 +350,17 @@ struct AssimpMeshReader
             AssetArchiveHeader header("smsh"); // TODO: Use SkeletalMesh::GetStaticAssetType();
             header.AddDependency(context.GetMaterial(pMesh->mMaterialIndex));
 
-            Vector<std::byte> data;
-            BinaryMemoryArchive dataStream(data, IBinaryArchive::IOMode::Write);
-            mesh.Serialize(dataStream);
-
             // TODO: Compress
-            // TODO: Calculate AABB
 
             // TODO: Generate AssetID;
             auto assetID = context.GetOutputDirectory() / (meshName + ".smsh");
-            auto archive = BinaryFileArchive(assetID.string(), IBinaryArchive::IOMode::Write);
-
-            archive << header << data;
+            if (context.RegisterOutput(assetID))
+            {
+                auto archive = BinaryFileArchive(assetID.string(), IBinaryArchive::IOMode::Write);
+                archive << header;
+                archive.WriteBlock([&](BinaryMemoryArchive& dataStream)
+                    { mesh.Serialize(dataStream); });
+            }
         }
         else
         { // Static Mesh
@@ -205,20 +371,20 @@ struct AssimpMeshReader
             AssetArchiveHeader header("mesh"); // TODO: Use StaticMesh::GetStaticAssetType();
             header.AddDependency(context.GetMaterial(pMesh->mMaterialIndex));
 
-            Vector<std::byte> data;
-            BinaryMemoryArchive dataStream(data, IBinaryArchive::IOMode::Write);
-
-            mesh.Serialize(dataStream);
-
             // TODO: Compress
-            // TODO: AABB
 
             // TODO: Generate AssetID;
             auto assetID = context.GetOutputDirectory() / (meshName + ".mesh");
-            auto archive = BinaryFileArchive(assetID.string(), IBinaryArchive::IOMode::Write);
-
-            archive << header << data;
+            if (context.RegisterOutput(assetID))
+            {
+                auto archive = BinaryFileArchive(assetID.string(), IBinaryArchive::IOMode::Write);
+                archive << header;
+                archive.WriteBlock([&](BinaryMemoryArchive& dataStream)
+                    { mesh.Serialize(dataStream); });
+            }
         }
+
+        return true;
     }
 };
 } // namespace aln::assets::converter
\ No newline at end of file
@@ -1,12 +1,15 @@
 #pragma once
 
+#include <algorithm>
 #include <assert.h>
+#include <cctype>
 #include <filesystem>
 
 #include <assets/asset_archive_header.hpp>
 #include <common/serialization/binary_archive.hpp>
 
 #include "../assimp_scene_context.hpp"
+#include "../texture_compression.hpp"
 #include "raw_asset.hpp"
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -20,42 +23,71 @@ class RawTexture : public IRawAsset
     friend class AssimpTextureReader;
     friend class FileTextureReader;
 
-    int m_width;
-    int m_height;
-    int m_channels;
+    RawImage m_image;
+    TextureCompressionSettings m_settings;
+    TextureFormat m_format = TextureFormat::BC7;
+    TaskService* m_pTaskService = nullptr;
 
-    unsigned char* m_pixelData;
-
-    void Serialize(BinaryMemoryArchive& archive) final override
+    /// @brief Copy the pixels decoded by stb and free them
+    bool SetPixels(unsigned char* pPixelData, int width, int height)
     {
-        size_t imageSize = m_width * m_height * m_channels;
+        if (pPixelData == nullptr)
+        {
+            return false;
+        }
 
-        archive << m_width;
-        archive << m_height;
-        archive << imageSize;
-        archive.Write(m_pixelData, imageSize);
+        m_image.m_width = width;
+        m_image.m_height = height;
+        m_image.m_pixels.assign(pPixelData, pPixelData + (size_t) width * height * 4);
+        stbi_image_free(pPixelData);
+
+        m_format = TextureCompressor::SelectFormat(m_image, m_settings.m_usage);
+        return true;
     }
 
-    ~RawTexture()
+    /// @note Format: | Format | sRGB | Width | Height | Mip count | Mips data, from the largest to the smallest |
+    void Serialize(BinaryMemoryArchive& archive) final override
     {
-        stbi_image_free(m_pixelData);
+        Vector<RawImage> mips;
+        if (m_settings.m_generateMips)
+        {
+            mips = TextureCompressor::GenerateMipChain(m_image, m_settings.m_mipFilter, m_settings.m_isSRGB);
+        }
+        else
+        {
+            mips.push_back(m_image);
+        }
+
+        Vector<std::byte> data;
+        for (const auto& mip : mips)
+        {
+            TextureCompressor::Encode(mip, m_format, data, m_pTaskService);
+        }
+
+        archive << m_format;
+        archive << m_settings.m_isSRGB;
+        archive << m_image.m_width;
+        archive << m_image.m_height;
+        archive << (uint32_t) mips.size();
+        archive << data;
     }
 };
 
 struct AssimpTextureReader
 {
-    static AssetID ReadTexture(const AssimpSceneContext& sceneContext, const aiTexture* pTexture, const std::filesystem::path& outPath)
+    static AssetID ReadTexture(const AssimpSceneContext& sceneContext, const aiTexture* pTexture, const std::filesystem::path& outPath, TextureUsage usage)
     {
         RawTexture texture;
         texture.m_id = AssetID(outPath.string());
-        texture.m_channels = 4;
+        texture.m_settings = TextureCompressionSettings::FromUsage(usage);
+        texture.m_pTaskService = sceneContext.GetTaskService();
 
         int size = pTexture->mHeight == 0 ? pTexture->mWidth * 4 : pTexture->mHeight * pTexture->mWidth;
 
-        int actualChannels;
-        texture.m_pixelData = stbi_load_from_memory((unsigned char*) pTexture->pcData, size, &texture.m_width, &texture.m_height, &actualChannels, 4);
+        int width, height, actualChannels;
+        auto pPixelData = stbi_load_from_memory((unsigned char*) pTexture->pcData, size, &width, &height, &actualChannels, 4);
 
-        if (texture.m_pixelData == nullptr)
+        if (!texture.SetPixels(pPixelData, width, height))
         {
             // TODO: Do not throw but rather log an error
             throw std::runtime_error("Failed to load embedded image");
@@ -63,16 +95,12 @@ struct AssimpTextureReader
         }
 
         // Save to disk
-        // TODO: Compress again
-        Vector<std::byte> data;
-        BinaryMemoryArchive dataStream(data, IBinaryArchive::IOMode::Write);
-
-        texture.Serialize(dataStream);
-
         AssetArchiveHeader header("text"); // TODO: Use Texture::GetStaticAssetType();
 
         auto archive = BinaryFileArchive(outPath, IBinaryArchive::IOMode::Write);
-        archive << header << data;
+        archive << header;
+        archive.WriteBlock([&](BinaryMemoryArchive& dataStream)
+            { texture.Serialize(dataStream); });
 
         return texture.m_id;
     }
@@ -80,24 +108,50 @@ struct AssimpTextureReader
 
 struct FileTextureReader
 {
-    static AssetID ReadTexture(const std::filesystem::path& imagePath, const std::filesystem::path& outPath)
+    /// @brief Usage of a standalone texture file, from its name suffix (i.e. "Brick_Normal.png"). Defaults to color
+    static TextureUsage GetUsageFromFileName(const std::filesystem::path& imagePath)
+    {
+        auto stem = imagePath.stem().string();
+        std::transform(stem.begin(), stem.end(), stem.begin(), [](unsigned char c)
+            { return (char) std::tolower(c); });
+
+        const auto suffixPosition = stem.find_last_of('_');
+        if (suffixPosition == std::string::npos)
+        {
+            return TextureUsage::Color;
+        }
+
+        const auto suffix = stem.substr(suffixPosition + 1);
+        if (suffix == "normal" || suffix == "nrm" || suffix == "n")
+        {
+            return TextureUsage::Normal;
+        }
+        if (suffix == "mask" || suffix == "orm" || suffix == "roughness" || suffix == "metallic" || suffix == "ao")
+        {
+            return TextureUsage::Mask;
+        }
+        return TextureUsage::Color;
+    }
+
+    static AssetID ReadTexture(const std::filesystem::path& imagePath, const std::filesystem::path& outPath, TextureUsage usage, TaskService* pTaskService = nullptr)
     {
         assert(std::filesystem::exists(imagePath));
 
         RawTexture texture;
         texture.m_id = AssetID(outPath.string());
-        texture.m_channels = 4; // RGBA
+        texture.m_settings = TextureCompressionSettings::FromUsage(usage);
+        texture.m_pTaskService = pTaskService;
 
-        int actualChannels;
-        if (!stbi_info(imagePath.string().c_str(), &texture.m_width, &texture.m_height, &actualChannels))
+        int width, height, actualChannels;
+        if (!stbi_info(imagePath.string().c_str(), &width, &height, &actualChannels))
         {
             std::cout << "Unsupported file format" << std::endl;
             return AssetID();
         }
 
-        texture.m_pixelData = stbi_load(imagePath.string().c_str(), &texture.m_width, &texture.m_height, &actualChannels, texture.m_channels);
+        auto pPixelData = stbi_load(imagePath.string().c_str(), &width, &height, &actualChannels, 4);
 
-        if (texture.m_pixelData == nullptr)
+        if (!texture.SetPixels(pPixelData, width, height))
         {
             // TODO: Do not throw but rather log an error
             throw std::runtime_error("Failed to load image at " + imagePath.string());
@@ -105,16 +159,12 @@ struct FileTextureReader
         }
 
         // Save to disk
-        // TODO: Compress again
-        Vector<std::byte> data;
-        BinaryMemoryArchive dataStream(data, IBinaryArchive::IOMode::Write);
-
-        texture.Serialize(dataStream);
-
         AssetArchiveHeader header("text"); // TODO: Use Texture::GetStaticAssetType();
 
         auto archive = BinaryFileArchive(outPath, IBinaryArchive::IOMode::Write);
-        archive << header << data;
+        archive << header;
+        archive.WriteBlock([&](BinaryMemoryArchive& dataStream)
+            { texture.Serialize(dataStream); });
 
         return texture.m_id;
     }
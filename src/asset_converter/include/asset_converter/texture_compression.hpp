@@ -0,0 +1,79 @@
+#pragma once
+
+#include <common/containers/vector.hpp>
+#include <common/texture_format.hpp>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace aln
+{
+class TaskService;
+}
+
+namespace aln::assets::converter
+{
+/// @brief Uncompressed RGBA8 image
+struct RawImage
+{
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+    Vector<uint8_t> m_pixels;
+};
+
+enum class MipFilter : uint8_t
+{
+    Box,    // Cheap, slightly blurry
+    Kaiser, // Kaiser-windowed sinc. Sharper, preserves details in lower mips
+};
+
+/// @brief What a texture's channels hold. Drives its compressed format and color space
+enum class TextureUsage : uint8_t
+{
+    Color,  // sRGB color, with optional alpha
+    Normal, // Tangent-space normal map, XY in the red and green channels
+    Mask,   // Linear data channels (roughness, metalness, occlusion...)
+};
+
+struct TextureCompressionSettings
+{
+    TextureUsage m_usage = TextureUsage::Color;
+    MipFilter m_mipFilter = MipFilter::Kaiser;
+    bool m_isSRGB = true;
+    bool m_generateMips = true;
+
+    /// @brief Default settings of a usage. Only color textures are stored and filtered as sRGB
+    static TextureCompressionSettings FromUsage(TextureUsage usage)
+    {
+        TextureCompressionSettings settings;
+        settings.m_usage = usage;
+        settings.m_isSRGB = (usage == TextureUsage::Color);
+        return settings;
+    }
+};
+
+/// @brief Mip chain generation and CPU block compression of textures
+class TextureCompressor
+{
+  public:
+    /// @brief Pick a compressed format for an image:
+    /// - Color: BC1 when it is fully opaque, BC7 otherwise
+    /// - Normal: BC5
+    /// - Mask: BC1 when it is fully opaque, BC3 otherwise
+    static TextureFormat SelectFormat(const RawImage& image, TextureUsage usage);
+
+    /// @brief Generate the full mip chain of an image, including the base level.
+    /// sRGB images are filtered in linear space
+    static Vector<RawImage> GenerateMipChain(const RawImage& image, MipFilter filter, bool isSRGB);
+
+    /// @brief Encode an image to the given format and append the result to the output.
+    /// Blocks are encoded in parallel when a task service is provided
+    static void Encode(const RawImage& image, TextureFormat format, Vector<std::byte>& output, TaskService* pTaskService = nullptr);
+
+    // Single block encoders. Input is a 4x4 block of RGBA8 pixels (64 bytes)
+    static void EncodeBC1Block(const uint8_t* pBlockPixels, uint8_t* pOutput);
+    static void EncodeBC3Block(const uint8_t* pBlockPixels, uint8_t* pOutput);
+    static void EncodeBC5Block(const uint8_t* pBlockPixels, uint8_t* pOutput);
+    static void EncodeBC7Block(const uint8_t* pBlockPixels, uint8_t* pOutput);
+};
+} // namespace aln::assets::converter
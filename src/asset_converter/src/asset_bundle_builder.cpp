@@ -0,0 +1,226 @@
+#include "asset_bundle_builder.hpp"
+
+#include <assets/asset_archive_header.hpp>
+#include <assets/asset_bundle.hpp>
+#include <assets/asset_id.hpp>
+#include <common/serialization/binary_archive.hpp>
+#include <common/serialization/compression.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+
+namespace aln::assets::converter
+{
+namespace
+{
+enum VisitState : uint8_t
+{
+    NotVisited,
+    Visiting,
+    Visited,
+};
+} // namespace
+
+bool AssetBundleBuilder::AddAsset(const std::string& assetPath)
+{
+    if (m_assetIndices.find(assetPath) != m_assetIndices.end())
+    {
+        return true;
+    }
+
+    std::ifstream fileStream(assetPath, std::ios::binary | std::ios::in | std::ios::ate);
+    if (!fileStream.is_open())
+    {
+        return false;
+    }
+
+    BundledAsset asset;
+    asset.m_path = assetPath;
+
+    const auto fileSize = (size_t) fileStream.tellg();
+    asset.m_data.resize(fileSize);
+    fileStream.seekg(0);
+    fileStream.read(reinterpret_cast<char*>(asset.m_data.data()), fileSize);
+    if (!fileStream)
+    {
+        return false;
+    }
+
+    // Only the header is needed to order the bundle
+    AssetArchiveHeader header;
+    auto archive = BinaryMemoryArchive(asset.m_data, IBinaryArchive::IOMode::Read);
+    archive >> header;
+    if (!header.IsValid())
+    {
+        return false; // Outdated archive, it must be converted again
+    }
+
+    for (const auto& dependency : header.GetDependencies())
+    {
+        asset.m_dependencies.push_back(dependency.GetAssetPath());
+    }
+
+    m_assetIndices[assetPath] = m_assets.size();
+    m_assets.push_back(std::move(asset));
+    return true;
+}
+
+void AssetBundleBuilder::VisitAsset(uint32_t assetIdx, Vector<uint8_t>& visitStates, Vector<uint32_t>& outLayout) const
+{
+    if (visitStates[assetIdx] != NotVisited)
+    {
+        return; // Already placed, or a dependency cycle
+    }
+
+    // The asset service reads an archive before it knows about its dependencies, so the asset goes first
+    outLayout.push_back(assetIdx);
+
+    visitStates[assetIdx] = Visiting;
+    for (const auto& dependencyPath : m_assets[assetIdx].m_dependencies)
+    {
+        // Dependencies outside of the bundle are loaded from their own source
+        auto it = m_assetIndices.find(dependencyPath);
+        if (it != m_assetIndices.end())
+        {
+            VisitAsset(it->second, visitStates, outLayout);
+        }
+    }
+    visitStates[assetIdx] = Visited;
+}
+
+bool AssetBundleBuilder::Write(const std::filesystem::path& bundlePath, bool compress) const
+{
+    // Dependents before their dependencies. Assets nothing in the bundle depends on are visited first, so that
+    // shared dependencies land after one of the assets requesting them. Ties are broken by path so that bundles are reproducible
+    Vector<uint32_t> dependentCounts(m_assets.size(), 0);
+    for (const auto& asset : m_assets)
+    {
+        for (const auto& dependencyPath : asset.m_dependencies)
+        {
+            auto it = m_assetIndices.find(dependencyPath);
+            if (it != m_assetIndices.end())
+            {
+                dependentCounts[it->second]++;
+            }
+        }
+    }
+
+    Vector<uint32_t> rootOrder(m_assets.size());
+    std::iota(rootOrder.begin(), rootOrder.end(), 0);
+    std::sort(rootOrder.begin(), rootOrder.end(), [&](uint32_t a, uint32_t b)
+        {
+            const bool aIsRoot = dependentCounts[a] == 0;
+            const bool bIsRoot = dependentCounts[b] == 0;
+            if (aIsRoot != bIsRoot)
+            {
+                return aIsRoot;
+            }
+            return m_assets[a].m_path < m_assets[b].m_path;
+        });
+
+    Vector<uint8_t> visitStates(m_assets.size(), NotVisited);
+    Vector<uint32_t> layout;
+    layout.reserve(m_assets.size());
+    for (auto assetIdx : rootOrder)
+    {
+        VisitAsset(assetIdx, visitStates, layout);
+    }
+
+    // Prepare the stored data of each asset, in layout order
+    Vector<Vector<std::byte>> storedData(layout.size());
+    Vector<AssetBundleEntry> entries(layout.size());
+    uint64_t dataOffset = 0;
+    for (auto layoutIdx = 0; layoutIdx < layout.size(); ++layoutIdx)
+    {
+        const auto& asset = m_assets[layout[layoutIdx]];
+        auto& data = storedData[layoutIdx];
+        auto& entry = entries[layoutIdx];
+
+        data = asset.m_data;
+        entry.m_assetIDHash = AssetID(asset.m_path).GetHash();
+        entry.m_uncompressedSize = data.size();
+        entry.m_compressionMode = AssetCompressionMode::None;
+
+        if (compress)
+        {
+            Compression::Compress(data);
+            if (data.size() < entry.m_uncompressedSize)
+            {
+                entry.m_compressionMode = AssetCompressionMode::LZ4;
+            }
+            else
+            {
+                data = asset.m_data;
+            }
+        }
+
+        entry.m_offset = dataOffset;
+        entry.m_size = data.size();
+        dataOffset += data.size();
+    }
+
+    // Table of contents, sorted by hash for lookups
+    Vector<uint32_t> tableOrder(layout.size());
+    std::iota(tableOrder.begin(), tableOrder.end(), 0);
+    std::sort(tableOrder.begin(), tableOrder.end(), [&](uint32_t a, uint32_t b)
+        { return entries[a].m_assetIDHash < entries[b].m_assetIDHash; });
+
+    // Asset IDs are identified by their hash, two assets sharing one could not be told apart at runtime
+    for (auto tableIdx = 1; tableIdx < tableOrder.size(); ++tableIdx)
+    {
+        const auto previousLayoutIdx = tableOrder[tableIdx - 1];
+        const auto layoutIdx = tableOrder[tableIdx];
+        if (entries[previousLayoutIdx].m_assetIDHash == entries[layoutIdx].m_assetIDHash)
+        {
+            std::cout << "Asset ID hash collision between " << m_assets[layout[previousLayoutIdx]].m_path << " and " << m_assets[layout[layoutIdx]].m_path << std::endl;
+            return false;
+        }
+    }
+
+    AssetBundleTableOfContents tableOfContents;
+    tableOfContents.m_entries.reserve(layout.size());
+    for (auto layoutIdx : tableOrder)
+    {
+        const auto& asset = m_assets[layout[layoutIdx]];
+
+        auto& entry = tableOfContents.m_entries.emplace_back(entries[layoutIdx]);
+        entry.m_firstDependencyIdx = tableOfContents.m_dependencies.size();
+        entry.m_dependencyCount = asset.m_dependencies.size();
+        for (const auto& dependencyPath : asset.m_dependencies)
+        {
+            tableOfContents.m_dependencies.push_back(AssetID(dependencyPath));
+        }
+    }
+
+    Vector<std::byte> tableOfContentsData;
+    {
+        auto tableOfContentsArchive = BinaryMemoryArchive(tableOfContentsData, IBinaryArchive::IOMode::Write);
+        tableOfContentsArchive << tableOfContents;
+    }
+
+    auto archive = BinaryFileArchive(bundlePath, IBinaryArchive::IOMode::Write);
+    if (!archive.IsValid())
+    {
+        return false;
+    }
+
+    archive << AssetBundle::FileMagic;
+    archive << AssetBundle::FileVersion;
+    archive << tableOfContentsData; // Prefixed with its size
+    for (const auto& data : storedData)
+    {
+        archive.Write(data.data(), data.size());
+    }
+
+    // Do not leave a truncated bundle behind
+    if (!archive.Close())
+    {
+        std::error_code errorCode;
+        std::filesystem::remove(bundlePath, errorCode);
+        return false;
+    }
+    return true;
+}
+} // namespace aln::assets::converter
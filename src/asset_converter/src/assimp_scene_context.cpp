@@ -43,11 +43,27 @@ Vec3 AssimpSceneContext::RevertSceneTransform(const Vec3& vector) const
 
 bool AssimpSceneContext::TryGetSkeleton(const std::string& skeletonName, RawSkeleton*& pOutSkeleton) const
 {
+    std::lock_guard lock(m_mutex);
     auto [it, emplaced] = m_skeletons.try_emplace(skeletonName);
     pOutSkeleton = &(it->second);
     return !emplaced;
 }
 
+bool AssimpSceneContext::RegisterOutput(const std::filesystem::path& outputPath) const
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_outputs.push_back(outputPath.string());
+    }
+    return m_pConversionContext->ClaimOutput(outputPath);
+}
+
+void AssimpSceneContext::RegisterDependency(const std::filesystem::path& dependencyPath) const
+{
+    std::lock_guard lock(m_mutex);
+    m_dependencies.push_back(dependencyPath);
+}
+
 Transform AssimpSceneContext::GetGlobalTransform(const aiNode* pNode) const
 {
     struct NodeLookUp
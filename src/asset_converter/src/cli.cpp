@@ -1,56 +1,183 @@
+#include "asset_bundle_builder.hpp"
 #include "asset_converter.hpp"
+#include "conversion_context.hpp"
+#include "conversion_manifest.hpp"
 #include "raw_assets/raw_texture.hpp"
 
+#include <common/threading/task_service.hpp>
+
+#include <atomic>
 #include <filesystem>
 #include <iostream>
 
 using namespace aln::assets::converter;
 
-// TODO: Propagate a shared context so that we can detect when the same asset is used multiple times
+namespace
+{
+bool IsTextureFile(const std::filesystem::path& path)
+{
+    auto extension = path.extension();
+    return extension == ".png" || extension == ".jpg" || extension == ".TGA";
+}
+
+bool IsSceneFile(const std::filesystem::path& path)
+{
+    auto extension = path.extension();
+    return extension == ".fbx" || extension == ".obj" || extension == ".gltf";
+}
+
+struct SourceFile
+{
+    std::filesystem::path m_path;
+    std::string m_relativePath;
+    uint64_t m_hash;
+};
+} // namespace
 
 int main(int argc, char* argv[])
 {
-    /*if (argc < 2)
+    if (argc < 2)
     {
-        std::cout << "AssetConverter expects a directory to process as a first argument" << std::endl;
+        std::cout << "AssetConverter expects a directory to process as a first argument, and optionally an output directory as a second one." << std::endl;
+        std::cout << "If a bundle path is given as a third argument, all converted assets are also packed into it" << std::endl;
         return -1;
-    }*/
+    }
 
-    //std::filesystem::path inputDirectory = std::filesystem::path(argv[1]);
-    std::filesystem::path inputDirectory = std::filesystem::path("D:/Dev/allen_engine/assets/converter_tests");
-    
-    std::filesystem::path rootOutputDirectory = inputDirectory.parent_path() / "output";
+    std::filesystem::path inputDirectory = std::filesystem::path(argv[1]);
+    std::filesystem::path rootOutputDirectory = (argc > 2) ? std::filesystem::path(argv[2]) : inputDirectory.parent_path() / "output";
+    std::filesystem::path bundlePath = (argc > 3) ? std::filesystem::path(argv[3]) : std::filesystem::path();
+
+    if (!std::filesystem::is_directory(inputDirectory))
+    {
+        std::cout << "Invalid input directory: " << inputDirectory << std::endl;
+        return -1;
+    }
 
     std::cout << "Loaded asset directory: " << inputDirectory << std::endl;
 
-    AssetConverter converter = AssetConverter(rootOutputDirectory);
+    std::filesystem::create_directories(rootOutputDirectory);
+
+    aln::TaskService taskService;
+    ConversionContext conversionContext(inputDirectory, rootOutputDirectory, &taskService);
+
+    // Skip the files that did not change since the last conversion
+    const auto manifestPath = rootOutputDirectory / "conversion.manifest";
+    ConversionManifest manifest;
+    manifest.Load(manifestPath);
 
+    const auto settingsHash = AssetConverter::GetImportSettingsHash();
+
+    aln::Vector<SourceFile> dirtyFiles;
+    uint32_t upToDateCount = 0;
     for (auto& file : std::filesystem::recursive_directory_iterator(inputDirectory))
     {
-        std::cout << "File: " << file.path() << std::endl;
+        if (!file.is_regular_file() || !(IsTextureFile(file.path()) || IsSceneFile(file.path())))
+        {
+            continue;
+        }
 
-        auto exportPath = rootOutputDirectory / file.path().lexically_proximate(inputDirectory);
+        auto& sourceFile = dirtyFiles.emplace_back();
+        sourceFile.m_path = file.path();
+        sourceFile.m_relativePath = file.path().lexically_proximate(inputDirectory).generic_string();
+        sourceFile.m_hash = ConversionManifest::HashFile(file.path());
 
-        // Create subdirectories if necessary
-        if (!std::filesystem::is_directory(exportPath.parent_path()))
+        // The outputs of up to date files are not claimed: a dirty file sharing one of them (e.g. a material or texture) writes it again from its latest input
+        if (manifest.IsUpToDate(sourceFile.m_relativePath, sourceFile.m_hash, settingsHash))
         {
-            std::filesystem::create_directory(exportPath.parent_path());
+            dirtyFiles.pop_back();
+            upToDateCount++;
         }
+    }
+
+    std::cout << upToDateCount << " file(s) up to date, " << dirtyFiles.size() << " file(s) to convert" << std::endl;
 
-        auto extension = file.path().extension();
-        if (extension == ".png" || extension == ".jpg" || extension == ".TGA")
+    // Create subdirectories upfront, conversion tasks only write files
+    for (const auto& sourceFile : dirtyFiles)
+    {
+        auto exportPath = rootOutputDirectory / sourceFile.m_relativePath;
+        std::filesystem::create_directories(exportPath.parent_path());
+    }
+
+    std::atomic<uint32_t> failedCount = 0;
+    auto ConvertFile = [&](const SourceFile& sourceFile)
+    {
+        ManifestEntry entry;
+        entry.m_sourceHash = sourceFile.m_hash;
+        entry.m_settingsHash = settingsHash;
+
+        if (IsTextureFile(sourceFile.m_path))
         {
+            auto exportPath = rootOutputDirectory / sourceFile.m_relativePath;
             exportPath.replace_extension(".text");
+            exportPath = conversionContext.GetTextureOutputPath(sourceFile.m_path, exportPath);
+            entry.m_outputs.push_back(exportPath.string());
+
+            if (conversionContext.ClaimOutput(exportPath))
+            {
+                std::cout << "Texture found, saving to " << exportPath << std::endl;
+                FileTextureReader::ReadTexture(sourceFile.m_path, exportPath, FileTextureReader::GetUsageFromFileName(sourceFile.m_path), &taskService);
+            }
+        }
+        else
+        {
+            std::cout << "Scene found: " << sourceFile.m_path << std::endl;
+
+            // Assimp importers are not thread safe, each task uses its own
+            AssetConverter converter = AssetConverter(conversionContext);
+            if (!converter.ReadFile(sourceFile.m_path))
+            {
+                failedCount++;
+                return;
+            }
+
+            const auto& sceneContext = converter.GetSceneContext();
+            entry.m_outputs = sceneContext.GetOutputs();
+            for (const auto& dependency : sceneContext.GetDependencies())
+            {
+                auto& dependencyEntry = entry.m_dependencies.emplace_back();
+                dependencyEntry.m_path = dependency.string();
+                dependencyEntry.m_hash = ConversionManifest::HashFile(dependency);
+            }
+        }
+
+        manifest.Update(sourceFile.m_relativePath, std::move(entry));
+    };
 
-            std::cout << "Texture found, saving to " << exportPath << std::endl;
-            FileTextureReader::ReadTexture(file.path(), exportPath);
+    aln::TaskSet conversionTask((uint32_t) dirtyFiles.size(), [&](aln::TaskSetPartition range, uint32_t threadIdx)
+        {
+        for (auto fileIndex = range.start; fileIndex < range.end; ++fileIndex)
+        {
+            ConvertFile(dirtyFiles[fileIndex]);
+        } });
+    taskService.ExecuteTask(&conversionTask);
+
+    manifest.Save(manifestPath);
+
+    // Pack every output, converted during this run or not, so that the bundle always covers the whole directory
+    if (!bundlePath.empty())
+    {
+        AssetBundleBuilder bundleBuilder;
+        for (const auto& output : manifest.GetAllOutputs())
+        {
+            if (!bundleBuilder.AddAsset(output))
+            {
+                std::cout << "Could not add " << output << " to the bundle" << std::endl;
+            }
         }
 
-        if (extension == ".fbx" || extension == ".obj" || extension == ".gltf")
+        if (!bundleBuilder.Write(bundlePath))
         {
-            converter.ReadFile(file.path());
+            std::cout << "Failed to write bundle " << bundlePath << std::endl;
+            return -1;
         }
+        std::cout << "Packed " << bundleBuilder.GetAssetCount() << " asset(s) into " << bundlePath << std::endl;
+    }
+
+    if (failedCount > 0)
+    {
+        std::cout << failedCount << " file(s) failed to convert" << std::endl;
+        return -1;
     }
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,166 @@
+#include "conversion_manifest.hpp"
+
+#include <assets/asset_archive_header.hpp>
+#include <common/serialization/binary_archive.hpp>
+#include <common/serialization/hash.hpp>
+
+#include <fstream>
+
+namespace aln::assets::converter
+{
+void ConversionManifest::Load(const std::filesystem::path& manifestPath)
+{
+    std::lock_guard lock(m_mutex);
+    m_entries.clear();
+
+    if (!std::filesystem::exists(manifestPath))
+    {
+        return;
+    }
+
+    auto archive = BinaryFileArchive(manifestPath, IBinaryArchive::IOMode::Read);
+    if (!archive.IsValid())
+    {
+        return;
+    }
+
+    uint32_t version = 0;
+    uint32_t assetArchiveVersion = 0;
+    archive >> version;
+    archive >> assetArchiveVersion;
+    if (!archive.IsValid() || version != Version || assetArchiveVersion != AssetArchiveHeader::AssetArchiveVersion)
+    {
+        // Outdated manifest or asset archive format, convert everything again
+        return;
+    }
+
+    size_t entryCount = 0;
+    archive >> entryCount;
+    for (size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+    {
+        std::string sourcePath;
+        archive >> sourcePath;
+
+        auto& entry = m_entries[sourcePath];
+        archive >> entry.m_sourceHash;
+        archive >> entry.m_settingsHash;
+        archive >> entry.m_outputs;
+
+        size_t dependencyCount = 0;
+        archive >> dependencyCount;
+        entry.m_dependencies.resize(dependencyCount);
+        for (auto& dependency : entry.m_dependencies)
+        {
+            archive >> dependency.m_path;
+            archive >> dependency.m_hash;
+        }
+    }
+
+    // Truncated manifest, convert everything again
+    if (!archive.IsValid())
+    {
+        m_entries.clear();
+    }
+}
+
+void ConversionManifest::Save(const std::filesystem::path& manifestPath) const
+{
+    std::lock_guard lock(m_mutex);
+
+    auto archive = BinaryFileArchive(manifestPath, IBinaryArchive::IOMode::Write);
+    archive << Version;
+    archive << AssetArchiveHeader::AssetArchiveVersion;
+    archive << m_entries.size();
+    for (const auto& [sourcePath, entry] : m_entries)
+    {
+        archive << sourcePath;
+        archive << entry.m_sourceHash;
+        archive << entry.m_settingsHash;
+        archive << entry.m_outputs;
+
+        archive << entry.m_dependencies.size();
+        for (const auto& dependency : entry.m_dependencies)
+        {
+            archive << dependency.m_path;
+            archive << dependency.m_hash;
+        }
+    }
+}
+
+bool ConversionManifest::IsUpToDate(const std::string& sourcePath, uint64_t sourceHash, uint64_t settingsHash) const
+{
+    std::lock_guard lock(m_mutex);
+
+    auto it = m_entries.find(sourcePath);
+    if (it == m_entries.end())
+    {
+        return false;
+    }
+
+    const auto& entry = it->second;
+    if (entry.m_sourceHash != sourceHash || entry.m_settingsHash != settingsHash)
+    {
+        return false;
+    }
+
+    for (const auto& output : entry.m_outputs)
+    {
+        if (!std::filesystem::exists(output))
+        {
+            return false;
+        }
+    }
+
+    for (const auto& dependency : entry.m_dependencies)
+    {
+        if (HashFile(dependency.m_path) != dependency.m_hash)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+Vector<std::string> ConversionManifest::GetAllOutputs() const
+{
+    std::lock_guard lock(m_mutex);
+
+    Vector<std::string> outputs;
+    for (const auto& [sourcePath, entry] : m_entries)
+    {
+        outputs.insert(outputs.end(), entry.m_outputs.begin(), entry.m_outputs.end());
+    }
+    return outputs;
+}
+
+void ConversionManifest::Update(const std::string& sourcePath, ManifestEntry&& entry)
+{
+    std::lock_guard lock(m_mutex);
+    m_entries[sourcePath] = std::move(entry);
+}
+
+uint64_t ConversionManifest::HashFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        return 0;
+    }
+
+    auto pState = XXH64_createState();
+    XXH64_reset(pState, hash::Seed);
+
+    constexpr size_t ChunkSize = 64 * 1024;
+    char buffer[ChunkSize];
+    while (file)
+    {
+        file.read(buffer, ChunkSize);
+        XXH64_update(pState, buffer, file.gcount());
+    }
+
+    const auto hash = XXH64_digest(pState);
+    XXH64_freeState(pState);
+    return hash;
+}
+} // namespace aln::assets::converter
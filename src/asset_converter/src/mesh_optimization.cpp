@@ -0,0 +1,352 @@
+#include "mesh_optimization.hpp"
+
+#include <common/containers/array.hpp>
+#include <common/maths/maths.hpp>
+
+#include <EASTL/sort.h>
+
+#include <math.h>
+
+namespace aln::assets::converter
+{
+namespace
+{
+// Scoring parameters from Forsyth's original article
+constexpr float CacheDecayPower = 1.5f;
+constexpr float LastTriangleScore = 0.75f;
+constexpr float ValenceBoostScale = 2.0f;
+constexpr float ValenceBoostPower = 0.5f;
+
+constexpr uint32_t InvalidVertex = UINT32_MAX;
+
+float ScoreVertex(int32_t cachePosition, uint32_t remainingValence)
+{
+    if (remainingValence == 0)
+    {
+        // No remaining triangle uses this vertex
+        return -1.0f;
+    }
+
+    float score = 0.0f;
+    if (cachePosition >= 0)
+    {
+        if (cachePosition < 3)
+        {
+            // The vertex was used in the last triangle. Use a fixed score so that no edge of that triangle is favored
+            score = LastTriangleScore;
+        }
+        else
+        {
+            assert(cachePosition < MeshOptimizer::VertexCacheSize);
+            constexpr float scaler = 1.0f / (MeshOptimizer::VertexCacheSize - 3);
+            score = powf(1.0f - (cachePosition - 3) * scaler, CacheDecayPower);
+        }
+    }
+
+    // Boost vertices with few remaining triangles, so that lone triangles do not get left behind
+    score += ValenceBoostScale * powf((float) remainingValence, -ValenceBoostPower);
+    return score;
+}
+
+/// @brief Simulates a FIFO post-transform cache
+class VertexCacheSimulator
+{
+  private:
+    Vector<uint32_t> m_timestamps;
+    uint32_t m_cacheSize;
+    uint32_t m_time;
+
+  public:
+    VertexCacheSimulator(size_t vertexCount, uint32_t cacheSize) : m_timestamps(vertexCount, 0), m_cacheSize(cacheSize), m_time(cacheSize + 1) {}
+
+    /// @brief Push a vertex through the cache
+    /// @return Whether the vertex was missing from the cache
+    bool Process(uint32_t vertex)
+    {
+        if (m_time - m_timestamps[vertex] > m_cacheSize)
+        {
+            m_timestamps[vertex] = m_time++;
+            return true;
+        }
+        return false;
+    }
+};
+} // namespace
+
+void MeshOptimizer::OptimizeVertexCache(Vector<uint32_t>& indices, size_t vertexCount)
+{
+    assert(indices.size() % 3 == 0);
+
+    const auto triangleCount = indices.size() / 3;
+    if (triangleCount == 0)
+    {
+        return;
+    }
+
+    // Build the vertex -> triangles adjacency
+    Vector<uint32_t> remainingValence(vertexCount, 0);
+    for (auto index : indices)
+    {
+        assert(index < vertexCount);
+        remainingValence[index]++;
+    }
+
+    Vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+    for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        adjacencyOffsets[vertex + 1] = adjacencyOffsets[vertex] + remainingValence[vertex];
+    }
+
+    Vector<uint32_t> adjacency(indices.size());
+    Vector<uint32_t> adjacencyFill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+    for (uint32_t triangle = 0; triangle < triangleCount; ++triangle)
+    {
+        for (auto corner = 0; corner < 3; ++corner)
+        {
+            const auto vertex = indices[triangle * 3 + corner];
+            adjacency[adjacencyFill[vertex]++] = triangle;
+        }
+    }
+
+    // Initial scores
+    Vector<int32_t> cachePositions(vertexCount, -1);
+    Vector<float> vertexScores(vertexCount);
+    for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        vertexScores[vertex] = ScoreVertex(-1, remainingValence[vertex]);
+    }
+
+    Vector<bool> emittedTriangles(triangleCount, false);
+
+    // The cache temporarily overflows by the size of a triangle while it is being updated
+    Array<uint32_t, VertexCacheSize + 3> cache;
+    Array<uint32_t, VertexCacheSize + 3> updatedCache;
+    uint32_t cacheCount = 0;
+
+    Vector<uint32_t> output;
+    output.reserve(indices.size());
+
+    int64_t bestTriangle = -1;
+    uint32_t fallbackCursor = 0;
+
+    for (size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount)
+    {
+        if (bestTriangle < 0)
+        {
+            // No candidate left around the cached vertices: jump to the next remaining triangle
+            while (emittedTriangles[fallbackCursor])
+            {
+                fallbackCursor++;
+            }
+            bestTriangle = fallbackCursor;
+        }
+
+        const auto triangle = (uint32_t) bestTriangle;
+        const uint32_t* pTriangleVertices = &indices[triangle * 3];
+
+        output.push_back(pTriangleVertices[0]);
+        output.push_back(pTriangleVertices[1]);
+        output.push_back(pTriangleVertices[2]);
+        emittedTriangles[triangle] = true;
+
+        // Remove the triangle from its vertices' adjacency lists, and push its vertices at the front of the cache
+        uint32_t updatedCacheCount = 0;
+        for (auto corner = 0; corner < 3; ++corner)
+        {
+            const auto vertex = pTriangleVertices[corner];
+            const auto adjacencyBegin = adjacencyOffsets[vertex];
+            const auto adjacencyEnd = adjacencyBegin + remainingValence[vertex];
+            for (auto adjacencyIndex = adjacencyBegin; adjacencyIndex < adjacencyEnd; ++adjacencyIndex)
+            {
+                if (adjacency[adjacencyIndex] == triangle)
+                {
+                    eastl::swap(adjacency[adjacencyIndex], adjacency[adjacencyEnd - 1]);
+                    break;
+                }
+            }
+            remainingValence[vertex]--;
+
+            updatedCache[updatedCacheCount++] = vertex;
+        }
+
+        for (uint32_t cacheIndex = 0; cacheIndex < cacheCount; ++cacheIndex)
+        {
+            const auto vertex = cache[cacheIndex];
+            if (vertex != pTriangleVertices[0] && vertex != pTriangleVertices[1] && vertex != pTriangleVertices[2])
+            {
+                updatedCache[updatedCacheCount++] = vertex;
+            }
+        }
+
+        // Update the scores of the vertices in cache (including the ones that were just evicted)
+        for (uint32_t cacheIndex = 0; cacheIndex < updatedCacheCount; ++cacheIndex)
+        {
+            const auto vertex = updatedCache[cacheIndex];
+            cachePositions[vertex] = (cacheIndex < VertexCacheSize) ? (int32_t) cacheIndex : -1;
+            vertexScores[vertex] = ScoreVertex(cachePositions[vertex], remainingValence[vertex]);
+        }
+
+        // Rescore the triangles adjacent to the cached vertices and pick the best one as the next candidate
+        bestTriangle = -1;
+        float bestScore = -1.0f;
+        for (uint32_t cacheIndex = 0; cacheIndex < updatedCacheCount; ++cacheIndex)
+        {
+            const auto vertex = updatedCache[cacheIndex];
+            const auto adjacencyBegin = adjacencyOffsets[vertex];
+            const auto adjacencyEnd = adjacencyBegin + remainingValence[vertex];
+            for (auto adjacencyIndex = adjacencyBegin; adjacencyIndex < adjacencyEnd; ++adjacencyIndex)
+            {
+                const auto candidate = adjacency[adjacencyIndex];
+                const uint32_t* pCandidateVertices = &indices[candidate * 3];
+                const auto score = vertexScores[pCandidateVertices[0]] + vertexScores[pCandidateVertices[1]] + vertexScores[pCandidateVertices[2]];
+                if (score > bestScore)
+                {
+                    bestScore = score;
+                    bestTriangle = candidate;
+                }
+            }
+        }
+
+        cache.swap(updatedCache);
+        cacheCount = Maths::Min(updatedCacheCount, VertexCacheSize);
+    }
+
+    indices.swap(output);
+}
+
+void MeshOptimizer::OptimizeOverdraw(Vector<uint32_t>& indices, const Vector<Vec3>& positions)
+{
+    assert(indices.size() % 3 == 0);
+
+    const auto triangleCount = indices.size() / 3;
+    if (triangleCount == 0)
+    {
+        return;
+    }
+
+    struct Cluster
+    {
+        uint32_t m_firstTriangle = 0;
+        uint32_t m_triangleCount = 0;
+        float m_sortKey = 0.0f;
+    };
+
+    // Split the triangles in clusters at the points where the vertex cache is flushed,
+    // i.e. where all three vertices of a triangle miss. Reordering clusters then preserves cache efficiency
+    Vector<Cluster> clusters;
+    VertexCacheSimulator cacheSimulator(positions.size(), VertexCacheSize);
+    for (uint32_t triangle = 0; triangle < triangleCount; ++triangle)
+    {
+        uint32_t misses = 0;
+        for (auto corner = 0; corner < 3; ++corner)
+        {
+            misses += cacheSimulator.Process(indices[triangle * 3 + corner]) ? 1 : 0;
+        }
+
+        if (clusters.empty() || misses == 3)
+        {
+            auto& cluster = clusters.emplace_back();
+            cluster.m_firstTriangle = triangle;
+        }
+        clusters.back().m_triangleCount++;
+    }
+
+    if (clusters.size() == 1)
+    {
+        return;
+    }
+
+    Vec3 meshCentroid;
+    for (auto index : indices)
+    {
+        meshCentroid += positions[index];
+    }
+    meshCentroid /= (float) indices.size();
+
+    // Sort key: how much the cluster faces away from the mesh center
+    for (auto& cluster : clusters)
+    {
+        Vec3 centroid;
+        Vec3 normal;
+        float totalArea = 0.0f;
+
+        const auto lastTriangle = cluster.m_firstTriangle + cluster.m_triangleCount;
+        for (auto triangle = cluster.m_firstTriangle; triangle < lastTriangle; ++triangle)
+        {
+            const auto& p0 = positions[indices[triangle * 3 + 0]];
+            const auto& p1 = positions[indices[triangle * 3 + 1]];
+            const auto& p2 = positions[indices[triangle * 3 + 2]];
+
+            const auto triangleNormal = (p1 - p0).Cross(p2 - p0);
+            const auto area = triangleNormal.Magnitude() * 0.5f;
+
+            centroid += (p0 + p1 + p2) * (area / 3.0f);
+            normal += triangleNormal;
+            totalArea += area;
+        }
+
+        if (totalArea < Maths::Epsilon)
+        {
+            continue;
+        }
+
+        centroid /= totalArea;
+        const auto normalLength = normal.Magnitude();
+        if (normalLength > Maths::Epsilon)
+        {
+            cluster.m_sortKey = (centroid - meshCentroid).Dot(normal / normalLength);
+        }
+    }
+
+    // Outward-facing clusters are the most likely to occlude others, draw them first
+    eastl::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& a, const Cluster& b)
+        { return a.m_sortKey > b.m_sortKey; });
+
+    Vector<uint32_t> output;
+    output.reserve(indices.size());
+    for (const auto& cluster : clusters)
+    {
+        const auto begin = indices.begin() + cluster.m_firstTriangle * 3;
+        output.insert(output.end(), begin, begin + cluster.m_triangleCount * 3);
+    }
+
+    indices.swap(output);
+}
+
+Vector<uint32_t> MeshOptimizer::OptimizeVertexFetch(Vector<uint32_t>& indices, size_t vertexCount)
+{
+    Vector<uint32_t> originalToNew(vertexCount, InvalidVertex);
+    Vector<uint32_t> newToOriginal;
+    newToOriginal.reserve(vertexCount);
+
+    for (auto& index : indices)
+    {
+        assert(index < vertexCount);
+        if (originalToNew[index] == InvalidVertex)
+        {
+            originalToNew[index] = (uint32_t) newToOriginal.size();
+            newToOriginal.push_back(index);
+        }
+        index = originalToNew[index];
+    }
+
+    return newToOriginal;
+}
+
+float MeshOptimizer::ComputeACMR(const Vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize)
+{
+    if (indices.empty())
+    {
+        return 0.0f;
+    }
+
+    uint32_t misses = 0;
+    VertexCacheSimulator cacheSimulator(vertexCount, cacheSize);
+    for (auto index : indices)
+    {
+        misses += cacheSimulator.Process(index) ? 1 : 0;
+    }
+
+    return (float) misses / (indices.size() / 3);
+}
+} // namespace aln::assets::converter
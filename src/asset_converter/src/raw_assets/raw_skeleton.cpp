@@ -165,17 +165,17 @@ const RawSkeleton* AssimpSkeletonReader::ReadSkeleton(const AssimpSceneContext&
 
         assert(pSkeleton->m_parentBoneIndices[0] == InvalidIndex);
 
-        // Save the skeleton
+        // Save the skeleton, unless another scene sharing it already did
         // TODO: Check against existing skeletons
-        Vector<std::byte> data;
-        auto dataStream = BinaryMemoryArchive(data, IBinaryArchive::IOMode::Write);
-
-        pSkeleton->Serialize(dataStream);
-
-        // TODO: Use skeleton static asset type
-        auto header = AssetArchiveHeader("skel");
-        auto archive = BinaryFileArchive(pSkeleton->m_id.GetAssetPath(), IBinaryArchive::IOMode::Write);
-        archive << header << data;
+        if (sceneContext.RegisterOutput(exportPath))
+        {
+            // TODO: Use skeleton static asset type
+            auto header = AssetArchiveHeader("skel");
+            auto archive = BinaryFileArchive(pSkeleton->m_id.GetAssetPath(), IBinaryArchive::IOMode::Write);
+            archive << header;
+            archive.WriteBlock([&](BinaryMemoryArchive& dataStream)
+                { pSkeleton->Serialize(dataStream); });
+        }
     }
     return pSkeleton;
 }
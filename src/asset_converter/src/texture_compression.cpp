@@ -0,0 +1,857 @@
+#include "texture_compression.hpp"
+
+#include <common/maths/maths.hpp>
+#include <common/threading/task_service.hpp>
+
+#include <EASTL/utility.h>
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+namespace aln::assets::converter
+{
+namespace
+{
+// -------------------------------------
+// Color space
+// -------------------------------------
+float SRGBToLinear(float value) { return value <= 0.04045f ? value / 12.92f : powf((value + 0.055f) / 1.055f, 2.4f); }
+float LinearToSRGB(float value) { return value <= 0.0031308f ? value * 12.92f : 1.055f * powf(value, 1.0f / 2.4f) - 0.055f; }
+
+uint8_t FloatToByte(float value) { return (uint8_t) (Maths::Clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f); }
+
+// -------------------------------------
+// Mip generation
+// -------------------------------------
+
+/// @brief RGBA image with float channels, in linear space
+struct FloatImage
+{
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+    Vector<float> m_pixels;
+};
+
+constexpr float KaiserWidth = 3.0f;
+constexpr float KaiserAlpha = 4.0f;
+
+/// @brief Modified Bessel function of the first kind, used by the Kaiser window
+float BesselI0(float x)
+{
+    const auto halfXSquared = x * x * 0.25f;
+    float sum = 1.0f;
+    float term = 1.0f;
+    for (auto k = 1; k < 32 && term > sum * 1e-8f; ++k)
+    {
+        term *= halfXSquared / (float) (k * k);
+        sum += term;
+    }
+    return sum;
+}
+
+float Sinc(float x)
+{
+    if (fabsf(x) < 1e-5f)
+    {
+        return 1.0f;
+    }
+    const auto piX = Maths::Pi * x;
+    return sinf(piX) / piX;
+}
+
+/// @param distance: Distance to the filter center, in destination pixels
+float EvaluateFilter(MipFilter filter, float distance)
+{
+    if (filter == MipFilter::Box)
+    {
+        return fabsf(distance) <= 0.5f ? 1.0f : 0.0f;
+    }
+
+    const auto ratio = distance / KaiserWidth;
+    if (ratio * ratio >= 1.0f)
+    {
+        return 0.0f;
+    }
+    return Sinc(distance) * BesselI0(KaiserAlpha * sqrtf(1.0f - ratio * ratio)) / BesselI0(KaiserAlpha);
+}
+
+float GetFilterSupport(MipFilter filter) { return filter == MipFilter::Box ? 0.5f : KaiserWidth; }
+
+/// @brief Precomputed source pixels and normalized weights contributing to each destination pixel along one axis
+struct FilterTaps
+{
+    struct Tap
+    {
+        uint32_t m_sourceIndex;
+        float m_weight;
+    };
+
+    Vector<Tap> m_taps;
+    Vector<uint32_t> m_firstTaps; // Index of the first tap of each destination pixel, plus one past the end
+
+    FilterTaps(uint32_t sourceSize, uint32_t destinationSize, MipFilter filter)
+    {
+        const auto scale = (float) sourceSize / (float) destinationSize;
+        const auto support = GetFilterSupport(filter) * scale;
+
+        m_firstTaps.reserve(destinationSize + 1);
+        for (uint32_t destinationIndex = 0; destinationIndex < destinationSize; ++destinationIndex)
+        {
+            const auto firstTap = (uint32_t) m_taps.size();
+            m_firstTaps.push_back(firstTap);
+
+            const auto center = (destinationIndex + 0.5f) * scale;
+            const auto begin = (int32_t) floorf(center - support - 0.5f);
+            const auto end = (int32_t) ceilf(center + support);
+
+            float totalWeight = 0.0f;
+            for (auto sourceIndex = begin; sourceIndex <= end; ++sourceIndex)
+            {
+                const auto weight = EvaluateFilter(filter, (sourceIndex + 0.5f - center) / scale);
+                if (weight == 0.0f)
+                {
+                    continue;
+                }
+
+                // Clamp to edge
+                const auto clampedIndex = (uint32_t) Maths::Clamp(sourceIndex, 0, (int32_t) sourceSize - 1);
+                m_taps.push_back({clampedIndex, weight});
+                totalWeight += weight;
+            }
+
+            for (auto tapIndex = firstTap; tapIndex < m_taps.size(); ++tapIndex)
+            {
+                m_taps[tapIndex].m_weight /= totalWeight;
+            }
+        }
+        m_firstTaps.push_back((uint32_t) m_taps.size());
+    }
+};
+
+FloatImage Downsample(const FloatImage& source, MipFilter filter)
+{
+    const auto width = Maths::Max(source.m_width / 2, 1u);
+    const auto height = Maths::Max(source.m_height / 2, 1u);
+
+    const FilterTaps horizontalTaps(source.m_width, width, filter);
+    const FilterTaps verticalTaps(source.m_height, height, filter);
+
+    // Horizontal pass
+    Vector<float> intermediate((size_t) width * source.m_height * 4, 0.0f);
+    for (uint32_t y = 0; y < source.m_height; ++y)
+    {
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            auto pDestination = &intermediate[((size_t) y * width + x) * 4];
+            for (auto tapIndex = horizontalTaps.m_firstTaps[x]; tapIndex < horizontalTaps.m_firstTaps[x + 1]; ++tapIndex)
+            {
+                const auto& tap = horizontalTaps.m_taps[tapIndex];
+                const auto pSource = &source.m_pixels[((size_t) y * source.m_width + tap.m_sourceIndex) * 4];
+                for (auto channel = 0; channel < 4; ++channel)
+                {
+                    pDestination[channel] += pSource[channel] * tap.m_weight;
+                }
+            }
+        }
+    }
+
+    // Vertical pass
+    FloatImage destination;
+    destination.m_width = width;
+    destination.m_height = height;
+    destination.m_pixels.resize((size_t) width * height * 4, 0.0f);
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        for (auto tapIndex = verticalTaps.m_firstTaps[y]; tapIndex < verticalTaps.m_firstTaps[y + 1]; ++tapIndex)
+        {
+            const auto& tap = verticalTaps.m_taps[tapIndex];
+            for (uint32_t x = 0; x < width; ++x)
+            {
+                auto pDestination = &destination.m_pixels[((size_t) y * width + x) * 4];
+                const auto pSource = &intermediate[((size_t) tap.m_sourceIndex * width + x) * 4];
+                for (auto channel = 0; channel < 4; ++channel)
+                {
+                    pDestination[channel] += pSource[channel] * tap.m_weight;
+                }
+            }
+        }
+    }
+
+    return destination;
+}
+
+// -------------------------------------
+// Block encoding helpers
+// -------------------------------------
+
+/// @brief Copy a 4x4 block of pixels, replicating the edges of images whose size is not a multiple of 4
+void ExtractBlock(const RawImage& image, uint32_t blockX, uint32_t blockY, uint8_t* pBlockPixels)
+{
+    for (uint32_t y = 0; y < 4; ++y)
+    {
+        const auto sourceY = Maths::Min(blockY * 4 + y, image.m_height - 1);
+        for (uint32_t x = 0; x < 4; ++x)
+        {
+            const auto sourceX = Maths::Min(blockX * 4 + x, image.m_width - 1);
+            memcpy(&pBlockPixels[(y * 4 + x) * 4], &image.m_pixels[((size_t) sourceY * image.m_width + sourceX) * 4], 4);
+        }
+    }
+}
+
+/// @brief Write bits to a block, least significant bit first
+struct BlockBitWriter
+{
+    uint8_t* m_pData;
+    uint32_t m_bitOffset = 0;
+
+    void Write(uint32_t value, uint32_t bitCount)
+    {
+        for (uint32_t bit = 0; bit < bitCount; ++bit, ++m_bitOffset)
+        {
+            if (value & (1u << bit))
+            {
+                m_pData[m_bitOffset / 8] |= (uint8_t) (1u << (m_bitOffset % 8));
+            }
+        }
+    }
+};
+
+/// @brief Fit a line through a set of points using their principal axis, and return its extremities
+template <uint32_t Channels>
+void ComputeEndpoints(const float (*pPoints)[Channels], uint32_t pointCount, float* pStart, float* pEnd)
+{
+    float mean[Channels] = {};
+    for (uint32_t point = 0; point < pointCount; ++point)
+    {
+        for (uint32_t channel = 0; channel < Channels; ++channel)
+        {
+            mean[channel] += pPoints[point][channel];
+        }
+    }
+    for (uint32_t channel = 0; channel < Channels; ++channel)
+    {
+        mean[channel] /= pointCount;
+    }
+
+    float covariance[Channels][Channels] = {};
+    for (uint32_t point = 0; point < pointCount; ++point)
+    {
+        for (uint32_t i = 0; i < Channels; ++i)
+        {
+            for (uint32_t j = 0; j < Channels; ++j)
+            {
+                covariance[i][j] += (pPoints[point][i] - mean[i]) * (pPoints[point][j] - mean[j]);
+            }
+        }
+    }
+
+    // Power iteration, starting from the diagonal of the bounding box
+    float axis[Channels];
+    for (uint32_t channel = 0; channel < Channels; ++channel)
+    {
+        axis[channel] = 1.0f;
+    }
+    for (auto iteration = 0; iteration < 8; ++iteration)
+    {
+        float next[Channels] = {};
+        float length = 0.0f;
+        for (uint32_t i = 0; i < Channels; ++i)
+        {
+            for (uint32_t j = 0; j < Channels; ++j)
+            {
+                next[i] += covariance[i][j] * axis[j];
+            }
+            length += next[i] * next[i];
+        }
+
+        if (length < Maths::Epsilon)
+        {
+            break;
+        }
+
+        length = sqrtf(length);
+        for (uint32_t channel = 0; channel < Channels; ++channel)
+        {
+            axis[channel] = next[channel] / length;
+        }
+    }
+
+    float minProjection = 0.0f;
+    float maxProjection = 0.0f;
+    for (uint32_t point = 0; point < pointCount; ++point)
+    {
+        float projection = 0.0f;
+        for (uint32_t channel = 0; channel < Channels; ++channel)
+        {
+            projection += (pPoints[point][channel] - mean[channel]) * axis[channel];
+        }
+        minProjection = Maths::Min(minProjection, projection);
+        maxProjection = Maths::Max(maxProjection, projection);
+    }
+
+    for (uint32_t channel = 0; channel < Channels; ++channel)
+    {
+        pStart[channel] = Maths::Clamp(mean[channel] + axis[channel] * minProjection, 0.0f, 255.0f);
+        pEnd[channel] = Maths::Clamp(mean[channel] + axis[channel] * maxProjection, 0.0f, 255.0f);
+    }
+}
+
+/// @brief Least-squares fit of two endpoints given the interpolation factor of each point
+/// @return Whether the system could be solved
+template <uint32_t Channels>
+bool RefineEndpoints(const float (*pPoints)[Channels], const float* pFactors, uint32_t pointCount, float* pStart, float* pEnd)
+{
+    float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+    float ax[Channels] = {};
+    float bx[Channels] = {};
+    for (uint32_t point = 0; point < pointCount; ++point)
+    {
+        const auto b = pFactors[point];
+        const auto a = 1.0f - b;
+        aa += a * a;
+        ab += a * b;
+        bb += b * b;
+        for (uint32_t channel = 0; channel < Channels; ++channel)
+        {
+            ax[channel] += a * pPoints[point][channel];
+            bx[channel] += b * pPoints[point][channel];
+        }
+    }
+
+    const auto determinant = aa * bb - ab * ab;
+    if (fabsf(determinant) < Maths::Epsilon)
+    {
+        return false;
+    }
+
+    const auto inverseDeterminant = 1.0f / determinant;
+    for (uint32_t channel = 0; channel < Channels; ++channel)
+    {
+        pStart[channel] = Maths::Clamp((ax[channel] * bb - bx[channel] * ab) * inverseDeterminant, 0.0f, 255.0f);
+        pEnd[channel] = Maths::Clamp((bx[channel] * aa - ax[channel] * ab) * inverseDeterminant, 0.0f, 255.0f);
+    }
+    return true;
+}
+
+// -------------------------------------
+// BC1
+// -------------------------------------
+uint16_t PackRGB565(const float* pColor)
+{
+    const auto r = (uint16_t) Maths::Clamp((int32_t) (pColor[0] * 31.0f / 255.0f + 0.5f), 0, 31);
+    const auto g = (uint16_t) Maths::Clamp((int32_t) (pColor[1] * 63.0f / 255.0f + 0.5f), 0, 63);
+    const auto b = (uint16_t) Maths::Clamp((int32_t) (pColor[2] * 31.0f / 255.0f + 0.5f), 0, 31);
+    return (uint16_t) ((r << 11) | (g << 5) | b);
+}
+
+void UnpackRGB565(uint16_t packed, float* pColor)
+{
+    const auto r = (packed >> 11) & 31;
+    const auto g = (packed >> 5) & 63;
+    const auto b = packed & 31;
+    pColor[0] = (float) ((r << 3) | (r >> 2));
+    pColor[1] = (float) ((g << 2) | (g >> 4));
+    pColor[2] = (float) ((b << 3) | (b >> 2));
+}
+
+struct BC1Candidate
+{
+    uint16_t m_color0;
+    uint16_t m_color1;
+    uint8_t m_indices[16];
+    float m_error;
+};
+
+/// @brief Assign the closest palette entry to each pixel
+/// @param threeColorMode: Palette has 3 colors and a transparent black entry. Transparent pixels always use it
+BC1Candidate AssignBC1Indices(const float (*pPixels)[3], const bool* pTransparent, uint16_t color0, uint16_t color1, bool threeColorMode)
+{
+    BC1Candidate candidate = {color0, color1, {}, 0.0f};
+
+    float palette[4][3];
+    UnpackRGB565(color0, palette[0]);
+    UnpackRGB565(color1, palette[1]);
+    for (auto channel = 0; channel < 3; ++channel)
+    {
+        if (threeColorMode)
+        {
+            palette[2][channel] = (palette[0][channel] + palette[1][channel]) / 2.0f;
+            palette[3][channel] = 0.0f;
+        }
+        else
+        {
+            palette[2][channel] = (2.0f * palette[0][channel] + palette[1][channel]) / 3.0f;
+            palette[3][channel] = (palette[0][channel] + 2.0f * palette[1][channel]) / 3.0f;
+        }
+    }
+
+    const auto paletteSize = threeColorMode ? 3 : 4;
+    for (auto pixel = 0; pixel < 16; ++pixel)
+    {
+        if (pTransparent[pixel])
+        {
+            candidate.m_indices[pixel] = 3;
+            continue;
+        }
+
+        float bestError = FLT_MAX;
+        for (auto entry = 0; entry < paletteSize; ++entry)
+        {
+            float error = 0.0f;
+            for (auto channel = 0; channel < 3; ++channel)
+            {
+                const auto difference = pPixels[pixel][channel] - palette[entry][channel];
+                error += difference * difference;
+            }
+
+            if (error < bestError)
+            {
+                bestError = error;
+                candidate.m_indices[pixel] = (uint8_t) entry;
+            }
+        }
+        candidate.m_error += bestError;
+    }
+
+    return candidate;
+}
+
+void EncodeColorBlock(const uint8_t* pBlockPixels, uint8_t* pOutput, bool allowTransparency)
+{
+    float pixels[16][3];
+    bool transparent[16];
+    float opaquePixels[16][3];
+    uint32_t opaqueCount = 0;
+
+    for (auto pixel = 0; pixel < 16; ++pixel)
+    {
+        for (auto channel = 0; channel < 3; ++channel)
+        {
+            pixels[pixel][channel] = pBlockPixels[pixel * 4 + channel];
+        }
+
+        transparent[pixel] = allowTransparency && pBlockPixels[pixel * 4 + 3] < 128;
+        if (!transparent[pixel])
+        {
+            memcpy(opaquePixels[opaqueCount++], pixels[pixel], sizeof(pixels[pixel]));
+        }
+    }
+
+    const bool threeColorMode = opaqueCount < 16;
+
+    BC1Candidate best = {0, 0, {}, FLT_MAX};
+    if (opaqueCount == 0)
+    {
+        best.m_color0 = 0;
+        best.m_color1 = 0;
+        memset(best.m_indices, 3, sizeof(best.m_indices));
+    }
+    else
+    {
+        float start[3], end[3];
+        ComputeEndpoints<3>(opaquePixels, opaqueCount, start, end);
+
+        for (auto iteration = 0; iteration < 2; ++iteration)
+        {
+            auto candidate = AssignBC1Indices(pixels, transparent, PackRGB565(end), PackRGB565(start), threeColorMode);
+            if (candidate.m_error < best.m_error)
+            {
+                best = candidate;
+            }
+
+            // Refine the endpoints from the current assignment
+            static constexpr float FourColorFactors[4] = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+            static constexpr float ThreeColorFactors[4] = {0.0f, 1.0f, 0.5f, 0.0f};
+
+            float factors[16];
+            uint32_t factorCount = 0;
+            for (auto pixel = 0; pixel < 16; ++pixel)
+            {
+                if (!transparent[pixel])
+                {
+                    factors[factorCount++] = threeColorMode ? ThreeColorFactors[candidate.m_indices[pixel]] : FourColorFactors[candidate.m_indices[pixel]];
+                }
+            }
+
+            // Endpoints are swapped in the palette: color0 is the end of the segment
+            if (!RefineEndpoints<3>(opaquePixels, factors, opaqueCount, end, start))
+            {
+                break;
+            }
+        }
+    }
+
+    // Ensure the endpoints order matches the palette mode: color0 > color1 for 4 colors, color0 <= color1 for 3 colors
+    const bool swapEndpoints = threeColorMode ? (best.m_color0 > best.m_color1) : (best.m_color0 < best.m_color1);
+    if (swapEndpoints)
+    {
+        eastl::swap(best.m_color0, best.m_color1);
+        for (auto& index : best.m_indices)
+        {
+            if (threeColorMode)
+            {
+                index = (index == 0) ? 1 : (index == 1) ? 0
+                                                        : index;
+            }
+            else
+            {
+                index ^= 1;
+            }
+        }
+    }
+    else if (!threeColorMode && best.m_color0 == best.m_color1)
+    {
+        // Degenerate block, all pixels use the same color
+        memset(best.m_indices, 0, sizeof(best.m_indices));
+    }
+
+    uint32_t packedIndices = 0;
+    for (auto pixel = 0; pixel < 16; ++pixel)
+    {
+        packedIndices |= (uint32_t) best.m_indices[pixel] << (pixel * 2);
+    }
+
+    memcpy(pOutput, &best.m_color0, sizeof(uint16_t));
+    memcpy(pOutput + 2, &best.m_color1, sizeof(uint16_t));
+    memcpy(pOutput + 4, &packedIndices, sizeof(uint32_t));
+}
+
+// -------------------------------------
+// BC4 (single channel), used by BC3 alpha and BC5
+// -------------------------------------
+void EncodeSingleChannelBlock(const uint8_t* pBlockPixels, uint32_t channel, uint8_t* pOutput)
+{
+    uint8_t minValue = 255;
+    uint8_t maxValue = 0;
+    for (auto pixel = 0; pixel < 16; ++pixel)
+    {
+        const auto value = pBlockPixels[pixel * 4 + channel];
+        minValue = Maths::Min(minValue, value);
+        maxValue = Maths::Max(maxValue, value);
+    }
+
+    memset(pOutput, 0, 8);
+    pOutput[0] = maxValue;
+    pOutput[1] = minValue;
+    if (maxValue == minValue)
+    {
+        return;
+    }
+
+    // 8 values mode (endpoint 0 > endpoint 1)
+    float palette[8];
+    palette[0] = maxValue;
+    palette[1] = minValue;
+    for (auto step = 1; step < 7; ++step)
+    {
+        palette[step + 1] = ((7 - step) * maxValue + step * minValue) / 7.0f;
+    }
+
+    uint64_t packedIndices = 0;
+    for (auto pixel = 0; pixel < 16; ++pixel)
+    {
+        const float value = pBlockPixels[pixel * 4 + channel];
+
+        uint64_t bestIndex = 0;
+        float bestError = FLT_MAX;
+        for (auto entry = 0; entry < 8; ++entry)
+        {
+            const auto error = fabsf(value - palette[entry]);
+            if (error < bestError)
+            {
+                bestError = error;
+                bestIndex = entry;
+            }
+        }
+        packedIndices |= bestIndex << (pixel * 3);
+    }
+
+    for (auto byte = 0; byte < 6; ++byte)
+    {
+        pOutput[2 + byte] = (uint8_t) (packedIndices >> (byte * 8));
+    }
+}
+
+// -------------------------------------
+// BC7 (mode 6: single subset, 7.7.7.7 endpoints with a p-bit, 4-bit indices)
+// -------------------------------------
+constexpr uint32_t BC7Weights[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+struct BC7Endpoint
+{
+    uint8_t m_values[4]; // 7 bits per channel
+    uint8_t m_pBit;
+
+    uint32_t Expand(uint32_t channel) const { return (m_values[channel] << 1) | m_pBit; }
+};
+
+BC7Endpoint QuantizeBC7Endpoint(const float* pColor)
+{
+    BC7Endpoint best = {};
+    float bestError = FLT_MAX;
+    for (uint8_t pBit = 0; pBit < 2; ++pBit)
+    {
+        BC7Endpoint endpoint = {{}, pBit};
+        float error = 0.0f;
+        for (auto channel = 0; channel < 4; ++channel)
+        {
+            endpoint.m_values[channel] = (uint8_t) Maths::Clamp((int32_t) ((pColor[channel] - pBit) / 2.0f + 0.5f), 0, 127);
+            const auto difference = (float) endpoint.Expand(channel) - pColor[channel];
+            error += difference * difference;
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            best = endpoint;
+        }
+    }
+    return best;
+}
+
+struct BC7Candidate
+{
+    BC7Endpoint m_endpoints[2];
+    uint8_t m_indices[16];
+    float m_error;
+};
+
+BC7Candidate AssignBC7Indices(const float (*pPixels)[4], const BC7Endpoint& endpoint0, const BC7Endpoint& endpoint1)
+{
+    BC7Candidate candidate = {{endpoint0, endpoint1}, {}, 0.0f};
+
+    float palette[16][4];
+    for (auto entry = 0; entry < 16; ++entry)
+    {
+        for (auto channel = 0; channel < 4; ++channel)
+        {
+            palette[entry][channel] = (float) (((64 - BC7Weights[entry]) * endpoint0.Expand(channel) + BC7Weights[entry] * endpoint1.Expand(channel) + 32) >> 6);
+        }
+    }
+
+    for (auto pixel = 0; pixel < 16; ++pixel)
+    {
+        float bestError = FLT_MAX;
+        for (auto entry = 0; entry < 16; ++entry)
+        {
+            float error = 0.0f;
+            for (auto channel = 0; channel < 4; ++channel)
+            {
+                const auto difference = pPixels[pixel][channel] - palette[entry][channel];
+                error += difference * difference;
+            }
+
+            if (error < bestError)
+            {
+                bestError = error;
+                candidate.m_indices[pixel] = (uint8_t) entry;
+            }
+        }
+        candidate.m_error += bestError;
+    }
+
+    return candidate;
+}
+} // namespace
+
+TextureFormat TextureCompressor::SelectFormat(const RawImage& image, TextureUsage usage)
+{
+    if (usage == TextureUsage::Normal)
+    {
+        return TextureFormat::BC5;
+    }
+
+    for (size_t pixel = 0; pixel < (size_t) image.m_width * image.m_height; ++pixel)
+    {
+        if (image.m_pixels[pixel * 4 + 3] != 255)
+        {
+            // BC3 stores alpha in its own block, independent from the other channels
+            return usage == TextureUsage::Color ? TextureFormat::BC7 : TextureFormat::BC3;
+        }
+    }
+    return TextureFormat::BC1;
+}
+
+Vector<RawImage> TextureCompressor::GenerateMipChain(const RawImage& image, MipFilter filter, bool isSRGB)
+{
+    assert(image.m_width > 0 && image.m_height > 0);
+    assert(image.m_pixels.size() == (size_t) image.m_width * image.m_height * 4);
+
+    const auto mipCount = GetMipChainLength(image.m_width, image.m_height);
+
+    Vector<RawImage> mips;
+    mips.reserve(mipCount);
+    mips.push_back(image);
+
+    // Filter in linear space, starting from the previous level to avoid accumulating quantization errors
+    FloatImage level;
+    level.m_width = image.m_width;
+    level.m_height = image.m_height;
+    level.m_pixels.resize(image.m_pixels.size());
+    for (size_t index = 0; index < image.m_pixels.size(); ++index)
+    {
+        const auto value = image.m_pixels[index] / 255.0f;
+        const bool isColorChannel = (index % 4) != 3;
+        level.m_pixels[index] = (isSRGB && isColorChannel) ? SRGBToLinear(value) : value;
+    }
+
+    for (uint32_t mipLevel = 1; mipLevel < mipCount; ++mipLevel)
+    {
+        level = Downsample(level, filter);
+
+        auto& mip = mips.emplace_back();
+        mip.m_width = level.m_width;
+        mip.m_height = level.m_height;
+        mip.m_pixels.resize(level.m_pixels.size());
+        for (size_t index = 0; index < level.m_pixels.size(); ++index)
+        {
+            const auto value = Maths::Clamp(level.m_pixels[index], 0.0f, 1.0f);
+            const bool isColorChannel = (index % 4) != 3;
+            mip.m_pixels[index] = FloatToByte((isSRGB && isColorChannel) ? LinearToSRGB(value) : value);
+        }
+    }
+
+    return mips;
+}
+
+void TextureCompressor::Encode(const RawImage& image, TextureFormat format, Vector<std::byte>& output, TaskService* pTaskService)
+{
+    const auto outputOffset = output.size();
+    output.resize(outputOffset + GetMipByteSize(format, image.m_width, image.m_height));
+
+    auto pOutput = reinterpret_cast<uint8_t*>(output.data() + outputOffset);
+    if (!IsBlockCompressed(format))
+    {
+        memcpy(pOutput, image.m_pixels.data(), image.m_pixels.size());
+        return;
+    }
+
+    const auto blockCountX = (image.m_width + 3) / 4;
+    const auto blockCountY = (image.m_height + 3) / 4;
+    const auto blockByteSize = GetTextureFormatElementSize(format);
+
+    auto EncodeBlockRows = [&](uint32_t firstRow, uint32_t lastRow)
+    {
+        uint8_t blockPixels[64];
+        for (auto blockY = firstRow; blockY < lastRow; ++blockY)
+        {
+            for (uint32_t blockX = 0; blockX < blockCountX; ++blockX)
+            {
+                ExtractBlock(image, blockX, blockY, blockPixels);
+
+                auto pBlockOutput = pOutput + ((size_t) blockY * blockCountX + blockX) * blockByteSize;
+                switch (format)
+                {
+                case TextureFormat::BC1:
+                    EncodeBC1Block(blockPixels, pBlockOutput);
+                    break;
+                case TextureFormat::BC3:
+                    EncodeBC3Block(blockPixels, pBlockOutput);
+                    break;
+                case TextureFormat::BC5:
+                    EncodeBC5Block(blockPixels, pBlockOutput);
+                    break;
+                case TextureFormat::BC7:
+                    EncodeBC7Block(blockPixels, pBlockOutput);
+                    break;
+                default:
+                    assert(false);
+                }
+            }
+        }
+    };
+
+    if (pTaskService != nullptr)
+    {
+        TaskSet encodingTask(blockCountY, [&](TaskSetPartition range, uint32_t threadIdx)
+            { EncodeBlockRows(range.start, range.end); });
+        pTaskService->ExecuteTask(&encodingTask);
+    }
+    else
+    {
+        EncodeBlockRows(0, blockCountY);
+    }
+}
+
+void TextureCompressor::EncodeBC1Block(const uint8_t* pBlockPixels, uint8_t* pOutput)
+{
+    EncodeColorBlock(pBlockPixels, pOutput, true);
+}
+
+void TextureCompressor::EncodeBC3Block(const uint8_t* pBlockPixels, uint8_t* pOutput)
+{
+    EncodeSingleChannelBlock(pBlockPixels, 3, pOutput);
+    EncodeColorBlock(pBlockPixels, pOutput + 8, false);
+}
+
+void TextureCompressor::EncodeBC5Block(const uint8_t* pBlockPixels, uint8_t* pOutput)
+{
+    EncodeSingleChannelBlock(pBlockPixels, 0, pOutput);
+    EncodeSingleChannelBlock(pBlockPixels, 1, pOutput + 8);
+}
+
+void TextureCompressor::EncodeBC7Block(const uint8_t* pBlockPixels, uint8_t* pOutput)
+{
+    float pixels[16][4];
+    for (auto pixel = 0; pixel < 16; ++pixel)
+    {
+        for (auto channel = 0; channel < 4; ++channel)
+        {
+            pixels[pixel][channel] = pBlockPixels[pixel * 4 + channel];
+        }
+    }
+
+    float start[4], end[4];
+    ComputeEndpoints<4>(pixels, 16, start, end);
+
+    BC7Candidate best = {};
+    best.m_error = FLT_MAX;
+    for (auto iteration = 0; iteration < 2; ++iteration)
+    {
+        const auto candidate = AssignBC7Indices(pixels, QuantizeBC7Endpoint(start), QuantizeBC7Endpoint(end));
+        if (candidate.m_error < best.m_error)
+        {
+            best = candidate;
+        }
+
+        float factors[16];
+        for (auto pixel = 0; pixel < 16; ++pixel)
+        {
+            factors[pixel] = BC7Weights[candidate.m_indices[pixel]] / 64.0f;
+        }
+
+        if (!RefineEndpoints<4>(pixels, factors, 16, start, end))
+        {
+            break;
+        }
+    }
+
+    // The most significant bit of the first index is implicit and must be zero
+    if (best.m_indices[0] & 0x8)
+    {
+        eastl::swap(best.m_endpoints[0], best.m_endpoints[1]);
+        for (auto& index : best.m_indices)
+        {
+            index = 15 - index;
+        }
+    }
+
+    memset(pOutput, 0, 16);
+    BlockBitWriter writer = {pOutput};
+    writer.Write(1 << 6, 7); // Mode 6
+    for (auto channel = 0; channel < 4; ++channel)
+    {
+        writer.Write(best.m_endpoints[0].m_values[channel], 7);
+        writer.Write(best.m_endpoints[1].m_values[channel], 7);
+    }
+    writer.Write(best.m_endpoints[0].m_pBit, 1);
+    writer.Write(best.m_endpoints[1].m_pBit, 1);
+    writer.Write(best.m_indices[0], 3);
+    for (auto pixel = 1; pixel < 16; ++pixel)
+    {
+        writer.Write(best.m_indices[pixel], 4);
+    }
+    assert(writer.m_bitOffset == 128);
+}
+} // namespace aln::assets::converter
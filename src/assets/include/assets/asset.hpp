@@ -27,6 +27,10 @@ class IAsset
     inline const AssetID& GetID() const { return m_id; }
     virtual AssetTypeID GetAssetTypeID() const = 0;
 
+    // Memory footprint, used to build memory reports
+    virtual size_t GetCPUMemorySize() const { return 0; }
+    virtual size_t GetGPUMemorySize() const { return 0; }
+
     inline bool operator==(const IAsset& other) const { return m_id == other.m_id; }
 };
 } // namespace aln
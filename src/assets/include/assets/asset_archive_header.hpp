@@ -19,7 +19,10 @@ class AssetArchiveHeader
 {
     friend struct ArchiveAccess;
 
-    static constexpr uint32_t AssetArchiveVersion = 1;
+  public:
+    /// @brief Version of the archive format, bumped whenever the layout of the serialized data changes. Outdated archives must be converted again.
+    /// 2: Transforms are 48 bytes, with an aligned rotation first
+    static constexpr uint32_t AssetArchiveVersion = 2;
 
   private:
     // System info
@@ -41,6 +44,9 @@ class AssetArchiveHeader
 
     const Vector<AssetID>& GetDependencies() const { return m_dependencies; }
 
+    /// @brief Whether the archive was written in the current format
+    bool IsValid() const { return m_version == AssetArchiveVersion; }
+
     // Serialization
     /// @todo Make private when serialization system allows it
     template <class Archive>
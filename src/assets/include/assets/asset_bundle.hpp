@@ -0,0 +1,108 @@
+#pragma once
+
+#include "asset_archive_header.hpp"
+#include "asset_id.hpp"
+
+#include <common/containers/span.hpp>
+#include <common/containers/vector.hpp>
+
+#include <assert.h>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+
+namespace aln
+{
+
+/// @brief Table of contents entry of an asset bundle, locating one asset archive in the bundle's data section
+struct AssetBundleEntry
+{
+    uint64_t m_assetIDHash = 0; // Hash of the asset's ID, entries are sorted by it
+    AssetCompressionMode m_compressionMode = AssetCompressionMode::None;
+    uint64_t m_offset = 0; // From the start of the data section
+    uint32_t m_size = 0;   // Stored size, compressed or not
+    uint32_t m_uncompressedSize = 0;
+
+    // Range of the asset's dependencies in the table of contents, so that they can be requested without reading the archive
+    uint32_t m_firstDependencyIdx = 0;
+    uint32_t m_dependencyCount = 0;
+};
+static_assert(std::is_trivially_copyable_v<AssetBundleEntry>);
+
+/// @brief Table of contents of a bundle. Entries are sorted by asset ID hash, which identifies assets as AssetID does: bundles with colliding hashes are not built
+struct AssetBundleTableOfContents
+{
+    Vector<AssetBundleEntry> m_entries;
+    Vector<AssetID> m_dependencies; // Dependencies of all entries, indexed by the entries' dependency ranges
+
+    template <class Archive>
+    void Serialize(Archive& archive) const
+    {
+        archive << m_entries;
+        archive << m_dependencies;
+    }
+
+    template <class Archive>
+    void Deserialize(Archive& archive)
+    {
+        archive >> m_entries;
+        archive >> m_dependencies;
+    }
+};
+
+/// @brief Read-only view of a packed asset bundle (pak) file.
+/// @note The expected format is: | Magic | Version | Table of contents size | Table of contents | Data |.
+/// Asset archives are laid out depth first, each asset before its dependencies, so that loading a level reads the file front to back:
+/// reads go through a read-ahead window so that consecutive small assets cost a single large read.
+/// Thread safe
+class AssetBundle
+{
+  public:
+    static constexpr uint32_t FileMagic = 0x504E4C41; // "ALNP"
+    static constexpr uint32_t FileVersion = 4;
+
+  private:
+    static constexpr size_t ReadAheadSize = 4 * 1024 * 1024;
+
+    std::filesystem::path m_path;
+    AssetBundleTableOfContents m_tableOfContents;
+    uint64_t m_dataOffset = 0; // Start of the data section in the file
+
+    std::mutex m_mutex;
+    std::ifstream m_fileStream;
+
+    // Read-ahead window over the data section
+    Vector<std::byte> m_readAheadBuffer;
+    uint64_t m_readAheadOffset = 0;
+
+  public:
+    AssetBundle() = default;
+    AssetBundle(const AssetBundle&) = delete;
+    AssetBundle& operator=(const AssetBundle&) = delete;
+
+    /// @brief Open a bundle file and read its table of contents. The file stays open until the bundle is closed
+    bool Open(const std::filesystem::path& path);
+    void Close();
+
+    bool IsOpen() const { return m_fileStream.is_open(); }
+    const std::filesystem::path& GetPath() const { return m_path; }
+    uint32_t GetAssetCount() const { return m_tableOfContents.m_entries.size(); }
+
+    /// @brief Find the entry of an asset
+    /// @return nullptr if the bundle does not contain the asset
+    const AssetBundleEntry* FindEntry(const AssetID& assetID) const;
+
+    /// @brief Dependencies of an asset, as listed in its archive header
+    Span<const AssetID> GetDependencies(const AssetBundleEntry& entry) const
+    {
+        assert(entry.m_firstDependencyIdx + entry.m_dependencyCount <= m_tableOfContents.m_dependencies.size());
+        return Span<const AssetID>(m_tableOfContents.m_dependencies.data() + entry.m_firstDependencyIdx, entry.m_dependencyCount);
+    }
+
+    /// @brief Read and decompress an asset archive
+    bool ReadEntry(const AssetBundleEntry& entry, Vector<std::byte>& outData);
+};
+} // namespace aln
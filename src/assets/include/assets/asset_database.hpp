@@ -0,0 +1,104 @@
+#pragma once
+
+#include "asset_id.hpp"
+#include "asset_type_id.hpp"
+
+#include <common/containers/hash_map.hpp>
+#include <common/containers/vector.hpp>
+#include <common/services/service.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace aln
+{
+class AssetService;
+
+/// @brief Index entry of an asset file
+struct AssetDatabaseEntry
+{
+    AssetID m_id;
+    std::string m_name; // File name without extension
+    std::filesystem::file_time_type m_lastWriteTime;
+    Vector<AssetID> m_dependencies; // As listed in the archive header
+};
+
+/// @brief In-memory index of the asset files of a directory.
+/// The directory is scanned once, then kept current from file system notifications (inotify on linux), or by periodically comparing
+/// the files' modification times elsewhere. Modified assets are hot-reloaded through the asset service.
+/// @note Not thread safe, use from the main thread
+class AssetDatabase : public IService
+{
+  private:
+    std::filesystem::path m_rootDirectory;
+    AssetService* m_pAssetService = nullptr;
+
+    HashMap<AssetID, AssetDatabaseEntry> m_entries;
+    HashMap<AssetID, Vector<AssetID>> m_dependents; // Reverse dependencies. Kept apart from the entries as dependencies might not be indexed
+    Vector<std::filesystem::path> m_directories;   // Sorted
+    uint32_t m_revision = 0;
+
+    // File system watching
+#ifdef __linux__
+    int m_inotifyDescriptor = -1;
+    HashMap<int, std::filesystem::path> m_watchedDirectories; // Watch descriptor -> directory
+#endif
+    std::chrono::steady_clock::duration m_pollingInterval = std::chrono::seconds(1);
+    std::chrono::steady_clock::time_point m_lastPollingTime;
+
+  private:
+    bool IsAssetFile(const std::filesystem::path& path) const;
+
+    /// @brief Index the assets of a directory and its subdirectories, and start watching them
+    void ScanDirectory(const std::filesystem::path& directory);
+    void WatchDirectory(const std::filesystem::path& directory);
+    /// @brief Remove a deleted directory, its subdirectories and their assets from the index
+    void RemoveDirectory(const std::filesystem::path& directory);
+
+    /// @brief Bring an asset file's entry up to date: index it if it is new, unindex it if it is gone, reindex and hot-reload it if it was modified
+    void RefreshAsset(const std::filesystem::path& path);
+    void AddEntry(const AssetID& assetID, std::filesystem::file_time_type lastWriteTime);
+    void RemoveEntry(const AssetID& assetID);
+    void SetDependencies(AssetDatabaseEntry& entry, Vector<AssetID>&& dependencies);
+
+    void ProcessFileSystemNotifications();
+    /// @brief Fallback when notifications are not available: rescan the whole directory and compare modification times
+    void Poll();
+
+  public:
+    /// @param pAssetService: Service reloading the modified assets. Loaders must be registered beforehand, they define which files are assets
+    void Initialize(const std::filesystem::path& rootDirectory, AssetService* pAssetService);
+    void Shutdown();
+
+    /// @brief Apply the file system changes that happened since the last update
+    void Update();
+
+    /// @brief Interval between two rescans of the directory when file system notifications are not available
+    void SetPollingInterval(std::chrono::steady_clock::duration interval) { m_pollingInterval = interval; }
+
+    // ------------------------------
+    // Queries
+    // ------------------------------
+    const std::filesystem::path& GetRootDirectory() const { return m_rootDirectory; }
+
+    /// @brief Incremented every time the index changes, so that views of it can be rebuilt only when needed
+    uint32_t GetRevision() const { return m_revision; }
+
+    const HashMap<AssetID, AssetDatabaseEntry>& GetEntries() const { return m_entries; }
+    const Vector<std::filesystem::path>& GetDirectories() const { return m_directories; }
+
+    /// @return nullptr if the asset is not indexed
+    const AssetDatabaseEntry* FindEntry(const AssetID& assetID) const;
+
+    Vector<AssetID> GetAssetsOfType(const AssetTypeID& typeID) const;
+    /// @brief Assets whose file name starts with a prefix. Case sensitive
+    Vector<AssetID> FindAssetsByNamePrefix(std::string_view prefix) const;
+
+    /// @brief Direct dependencies of an indexed asset
+    const Vector<AssetID>& GetDependencies(const AssetID& assetID) const;
+    /// @brief Indexed assets that directly depend on an asset
+    const Vector<AssetID>& GetDependents(const AssetID& assetID) const;
+};
+} // namespace aln
@@ -7,61 +7,72 @@
 
 #include <EASTL/functional.h>
 
+#include <filesystem>
+#include <string>
+#include <type_traits>
+
 namespace aln
 {
 /// @brief Assets are identified by their path on disk and their type.
-/// @todo Internally use a uint identifier to avoid costly string comparisons
+/// Paths are interned in a global table when an ID is first created from them: IDs only hold the path's 64-bit hash and the type derived from
+/// its extension, so that they are trivially copyable and compared without touching strings.
 class AssetID
 {
   public:
     friend struct ArchiveAccess;
 
+    /// @note Serialized as the path, so that the interning table can be rebuilt when reading
     template <class Archive>
     void Serialize(Archive& archive) const
     {
-        archive << m_path;
+        archive << GetAssetPath();
     }
 
     template <class Archive>
     void Deserialize(Archive& archive)
     {
-        archive >> m_path;
-        m_typeID = m_path.substr(m_path.size() - 4);
+        std::string path;
+        archive >> path;
+        *this = AssetID(path);
     }
 
   private:
-    // TODO: change to AssetPath
-    std::string m_path;
-    AssetTypeID m_typeID;
+    uint64_t m_hash = 0;
+    AssetTypeID m_typeID = AssetTypeID((uint32_t) 0);
 
   public:
     AssetID() = default;
-    AssetID(std::string assetPath) : m_path(assetPath),
-                                     m_typeID(assetPath.substr(assetPath.size() - 4)) {}
 
-    AssetID(const AssetID& other) : m_path(other.m_path), m_typeID(other.m_typeID) {}
+    /// @brief Create the ID of the asset at a given path, interning the path if it was never seen before
+    AssetID(const std::string& assetPath);
 
     inline const AssetTypeID& GetAssetTypeID() const { return m_typeID; }
-    inline const std::string& GetAssetPath() const { return m_path; }
+    inline uint64_t GetHash() const { return m_hash; }
+
+    /// @brief Interned path of the asset. Requires a table lookup, keep out of hot paths
+    const std::string& GetAssetPath() const;
 
     /// @brief Returns a string containing only the asset file name (for display purpose only)
     /// @todo Disable out of editor modes ?
     inline const std::string GetAssetName() const
     {
         assert(IsValid());
-        auto start = m_path.find_last_of(std::filesystem::path::preferred_separator) + 1;
-        auto end = m_path.find_last_of('.') - start;
-        return m_path.substr(start, end);
+        const auto& path = GetAssetPath();
+        auto start = path.find_last_of(std::filesystem::path::preferred_separator) + 1;
+        auto end = path.find_last_of('.') - start;
+        return path.substr(start, end);
     }
 
-    bool operator==(const AssetID& other) const { return m_path == other.m_path; }
-    bool operator!=(const AssetID& other) const { return m_path != other.m_path; }
-    bool operator<(const AssetID& other) const { return m_path < other.m_path; }
-    operator uint32_t() const { return aln::Hash32(m_path); }
+    bool operator==(const AssetID& other) const { return m_hash == other.m_hash; }
+    bool operator!=(const AssetID& other) const { return m_hash != other.m_hash; }
+    bool operator<(const AssetID& other) const { return m_hash < other.m_hash; }
 
-    bool IsValid() const { return m_typeID.IsValid() && !m_path.empty(); }
+    bool IsValid() const { return m_hash != 0; }
 };
 
+// Copied around in handles and requests, and passed as raw bytes in editor drag and drop payloads
+static_assert(std::is_trivially_copyable_v<AssetID>);
+
 ALN_REGISTER_PRIMITIVE(AssetID);
 
 } // namespace aln
@@ -71,6 +82,6 @@ namespace eastl
 template <>
 struct hash<aln::AssetID>
 {
-    size_t operator()(const aln::AssetID& id) const { return (uint32_t) id; }
+    size_t operator()(const aln::AssetID& id) const { return id.GetHash(); }
 };
-} // namespace eastl
\ No newline at end of file
+} // namespace eastl
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "asset.hpp"
+#include "asset_bundle.hpp"
 #include "handle.hpp"
 #include "loader.hpp"
 #include "record.hpp"
@@ -8,6 +9,7 @@
 
 #include <common/containers/array.hpp>
 #include <common/containers/hash_map.hpp>
+#include <common/event.hpp>
 #include <common/threading/task_service.hpp>
 #include <graphics/render_engine.hpp>
 
@@ -18,26 +20,76 @@
 namespace aln
 {
 
-/// @todo Handle asset lifetime. for now they're all "instant" (name subject to change)
-enum class AssetLifetime
+/// @brief Memory used by the loaded assets of a given type
+struct AssetMemoryUsage
 {
-    Instant, // Unloaded as soon as it's not used anymore
-    Level,   // Unloaded when a level ends
-    Global,  // Unloaded on game exit
+    uint32_t m_assetCount = 0;
+    size_t m_cpuBytes = 0;
+    size_t m_gpuBytes = 0;
+};
+
+/// @brief Memory unreferenced assets of a given type can keep resident before the least recently released ones are evicted
+struct AssetResidencyBudget
+{
+    size_t m_cpuBytes = 0;
+    size_t m_gpuBytes = 0;
+};
+
+/// @brief Residency cache statistics of a given asset type
+struct AssetResidencyStats
+{
+    uint64_t m_hitCount = 0;      // Requests served by an unreferenced resident asset
+    uint64_t m_missCount = 0;     // Requests that had to load the asset
+    uint64_t m_evictionCount = 0; // Unreferenced assets unloaded to respect the budget
+    uint32_t m_cachedAssetCount = 0;
+    size_t m_cachedCPUBytes = 0;
+    size_t m_cachedGPUBytes = 0;
 };
 
 class AssetService : public IService
 {
     friend class Engine;
+    friend class EngineCore;
     friend struct AssetRequest;
 
+    /// @brief Unreferenced assets of a type kept resident
+    struct ResidencyCache
+    {
+        AssetResidencyBudget m_budget;
+        AssetResidencyStats m_stats;
+        Vector<AssetRecord*> m_records; // Least recently released first
+    };
+
+    /// @brief Previous version of a reloaded asset, unloaded once the frames that might still use it are done
+    struct RetiredAsset
+    {
+        AssetRecord m_record;        // Holds the previous asset and the dependencies it references
+        uint64_t m_retiredUpdateIdx; // Update the asset was replaced in
+    };
+
+    /// @brief Number of updates a replaced asset is kept alive for. Updates run once per frame before rendering,
+    /// so the frames that were in flight when it was replaced are done by then. One more frame is kept as a margin
+    static constexpr uint64_t RetiredAssetUpdateCount = RenderEngine::GetFrameQueueSize() + 1;
+
   private:
     HashMap<AssetTypeID, std::unique_ptr<IAssetLoader>> m_loaders;
     HashMap<AssetID, AssetRecord> m_assetCache;
+    HashMap<AssetTypeID, ResidencyCache> m_residencyCaches;
+    bool m_isShuttingDown = false;
+
+    // Mounted bundles, searched most recently mounted first before falling back to loose files
+    Vector<std::unique_ptr<AssetBundle>> m_bundles;
+    std::mutex m_bundlesMutex;
 
     Vector<AssetRequest> m_pendingRequests;
     Vector<AssetRequest> m_activeRequests;
 
+    // Hot reload. New versions are loaded to their own record, then swapped with the loaded one on the main thread
+    HashMap<AssetID, AssetRecord> m_reloadedRecords;
+    Vector<RetiredAsset> m_retiredAssets;
+    uint64_t m_updateIdx = 0;
+    Event<const AssetID&> m_assetReloadedEvent;
+
     RenderEngine* m_pRenderDevice = nullptr;
 
     // Sync
@@ -58,10 +110,36 @@ class AssetService : public IService
     AssetRecord* GetOrCreateRecord(const AssetID& assetID);
     AssetRequest* FindActiveRequest(const AssetID id);
 
+    /// @brief Keep a record whose last reference was just removed resident according to its lifetime, or unload it right away
+    void ReleaseRecord(AssetRecord* pRecord);
+    void RemoveFromResidencyCache(AssetRecord* pRecord);
+    /// @brief Unload a record that was removed from its residency cache
+    void EvictRecord(AssetRecord* pRecord);
+    /// @brief Unload every unreferenced resident asset of a given lifetime
+    void EvictCachedRecords(AssetLifetime lifetime);
+    /// @brief Evict the least recently released instant-lifetime assets of each type until the cached memory fits in the budget
+    void TrimResidencyCaches();
+
+    /// @brief Read a full asset archive, from the first mounted bundle that contains it or from its loose file
+    bool ReadAssetArchive(const AssetID& assetID, Vector<std::byte>& outData);
+    /// @brief Read the dependencies of an asset from the first mounted bundle's table of contents, or from its loose file's header only
+    bool ReadAssetDependencies(const AssetID& assetID, Vector<AssetID>& outDependencies);
+    /// @brief Request the transitive dependencies of an asset. Only the headers of assets that were not already requested are read
+    /// @param outHandles: Handles referencing the requested dependencies. Must be unloaded by the caller
+    void PrefetchDependencies(const AssetID& assetID, Vector<IAssetHandle>& outHandles);
+
+    /// @brief Run the dependency installation step again on the loaded assets that depend on a reloaded asset, and on their own dependents
+    void ReinstallDependents(const AssetID& assetID);
+    /// @brief Install the new versions of reloaded assets whose GPU transfers are complete, and swap them with the loaded ones. Main thread only
+    void InstallReloadedAssets();
+    /// @brief Unload the previous versions of reloaded assets once no frame in flight can use them anymore, or right away when shutting down
+    void ReleaseRetiredAssets();
+
     /// @brief Handle pending requests
     void Update();
     void HandleActiveRequests(uint32_t threadIdx);
 
+    inline bool IsGPUAvailable() const { return m_pRenderDevice != nullptr; }
     inline bool IsIdle() const { return m_pendingRequests.empty() && m_activeRequests.empty() && !m_isLoadingTaskRunning; }
     inline bool IsBusy() const { return !IsIdle(); }
 
@@ -69,13 +147,17 @@ class AssetService : public IService
     AssetService() : m_loadingTask([this](TaskSetPartition range, uint32_t threadIdx)
                          { HandleActiveRequests(threadIdx); }) {}
 
-    void Initialize(TaskService& taskService, RenderEngine& renderEngine)
+    /// @param pRenderEngine: Render engine GPU resources are uploaded to. Null for headless engines, in which case no GPU commands are recorded
+    void Initialize(TaskService& taskService, RenderEngine* pRenderEngine)
     {
         m_pTaskService = &taskService;
-        m_pRenderDevice = &renderEngine;
+        m_pRenderDevice = pRenderEngine;
 
-        static constexpr size_t STAGING_BUFFER_SIZE = 256 * 1024 * 1024; // 256MiB
-        m_stagingBuffer.Initialize(m_pRenderDevice, STAGING_BUFFER_SIZE);
+        if (IsGPUAvailable())
+        {
+            static constexpr size_t STAGING_BUFFER_SIZE = 256 * 1024 * 1024; // 256MiB
+            m_stagingBuffer.Initialize(m_pRenderDevice, STAGING_BUFFER_SIZE);
+        }
     }
 
     void Shutdown()
@@ -85,13 +167,34 @@ class AssetService : public IService
             Update();
         }
 
-        m_stagingBuffer.Shutdown();
+        // Unload every unreferenced asset still resident, whatever its lifetime. Released dependencies are unloaded right away
+        m_isShuttingDown = true;
+        ReleaseRetiredAssets();
+        EvictCachedRecords(AssetLifetime::Instant);
+        EvictCachedRecords(AssetLifetime::Level);
+        EvictCachedRecords(AssetLifetime::Global);
+        while (IsBusy())
+        {
+            Update();
+        }
+
+        if (IsGPUAvailable())
+        {
+            m_stagingBuffer.Shutdown();
+        }
 
         // TODO: Properly remove cache entries when the last reference is unloaded
         // assert(m_assetCache.empty());
         m_loaders.clear();
+
+        UnmountAllBundles();
     }
 
+    /// @brief Mount a bundle produced by the asset converter. Assets it contains are read from it instead of their loose files
+    /// @return Whether the bundle could be opened
+    bool MountBundle(const std::filesystem::path& bundlePath);
+    void UnmountAllBundles();
+
     /// @brief Register a new loader
     /// @tparam T: Asset type
     /// @tparam TLoader: Loader type
@@ -113,6 +216,65 @@ class AssetService : public IService
         return &m_loaders[T::GetStaticAssetTypeID()];
     }
 
+    /// @brief Override the CPU residency policy of an asset type. Only affects assets loaded afterwards
+    template <AssetType T>
+    void SetCPUResidency(CPUResidency residency)
+    {
+        auto it = m_loaders.find(T::GetStaticAssetTypeID());
+        assert(it != m_loaders.end());
+        it->second->SetCPUResidency(residency);
+    }
+
+    /// @brief Set the default lifetime of an asset type. Only affects records created afterwards
+    template <AssetType T>
+    void SetLifetime(AssetLifetime lifetime)
+    {
+        auto it = m_loaders.find(T::GetStaticAssetTypeID());
+        assert(it != m_loaders.end());
+        it->second->SetLifetime(lifetime);
+    }
+
+    /// @brief Override the lifetime of a single asset
+    void SetLifetime(const AssetID& assetID, AssetLifetime lifetime);
+
+    /// @brief Set the memory unreferenced instant-lifetime assets of a type can keep resident. Types without a budget are unloaded as soon as they are released
+    template <AssetType T>
+    void SetResidencyBudget(const AssetResidencyBudget& budget)
+    {
+        std::lock_guard lock(m_mutex);
+        m_residencyCaches[T::GetStaticAssetTypeID()].m_budget = budget;
+    }
+
+    /// @brief Unload the unreferenced level-lifetime assets. Call when a level ends
+    void ReleaseLevelAssets();
+
+    /// @brief Unload every unreferenced instant-lifetime asset, i.e. when running low on memory
+    void FlushResidencyCaches();
+
+    /// @brief Residency cache statistics, per asset type
+    HashMap<AssetTypeID, AssetResidencyStats> GetResidencyStats();
+
+    /// @brief Keep the CPU copies of an asset's data resident regardless of its type's residency policy (i.e. for collision or picking)
+    /// @note Must be called before the asset is loaded
+    void RequireCPUAccess(const AssetID& assetID);
+
+    /// @brief Gather the memory used by loaded assets, per asset type
+    HashMap<AssetTypeID, AssetMemoryUsage> GetMemoryReport();
+
+    /// @brief Reload an asset from its archive, i.e. after its file changed. The new version is loaded next to the current one, which stays usable
+    /// until the new one is installed. It is then swapped in on the main thread, loaded dependents are reinstalled and the reload event is fired.
+    /// The previous version is unloaded once the frames in flight are done with it. Handles and references are preserved.
+    /// @note Assets that are not loaded are left untouched, they read the new version on their next load. Referenced assets are only reloaded if their loader
+    /// allows it: users of other asset types keep raw pointers to them
+    void ReloadAsset(const AssetID& assetID);
+
+    /// @brief Event fired on the main thread when the new version of a reloaded asset has replaced the previous one.
+    /// Listeners must drop the raw pointers they keep to the previous version
+    Event<const AssetID&>& OnAssetReloaded() { return m_assetReloadedEvent; }
+
+    /// @brief Whether a loader is registered for an asset type
+    bool IsAssetTypeRegistered(const AssetTypeID& typeID) const { return m_loaders.find(typeID) != m_loaders.end(); }
+
     void Load(IAssetHandle& assetHandle);
     void Unload(IAssetHandle& assetHandle);
 };
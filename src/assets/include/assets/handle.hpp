@@ -61,6 +61,9 @@ class IAssetHandle
     }
 };
 
+// Handles are passed around by value in components and dependency lists, keep them cheap to copy
+static_assert(std::is_trivially_copyable_v<IAssetHandle>);
+
 template <AssetType T>
 class AssetHandle : public IAssetHandle
 {
@@ -15,6 +15,13 @@
 namespace aln
 {
 
+/// @brief Residency policy of the CPU copy of the data an asset uploads to the GPU
+enum class CPUResidency : uint8_t
+{
+    ReleaseAfterUpload, // CPU data is released as soon as the upload transfers are complete, unless the asset requires CPU access
+    Keep,               // CPU data stays resident until the asset is unloaded
+};
+
 /// TODO: Hide from clients
 class IAssetLoader
 {
@@ -22,25 +29,26 @@ class IAssetLoader
     friend class AssetRequest;
 
   private:
+    CPUResidency m_cpuResidency = CPUResidency::Keep;
+    AssetLifetime m_lifetime = AssetLifetime::Instant; // Default lifetime of the loaded assets
+    bool m_isReloadableWhileReferenced = false;        // Whether users of the loaded assets go through their handles or are notified when they are reloaded
+
     // Concrete loading functions called by the asset service
-    bool LoadAsset(AssetRequestContext& ctx, AssetRecord* pRecord)
+    /// @param assetArchiveData: Full asset archive, read from a bundle or a loose file by the asset service
+    bool LoadAsset(AssetRequestContext& ctx, AssetRecord* pRecord, Vector<std::byte>& assetArchiveData)
     {
         assert(pRecord->IsUnloaded());
 
-        // TODO: Is this the right place for loading *from disk* ?
-        // The full archive could be dumped to a Vector<byte> earlier (and it would possibly be faster)
-        auto archive = BinaryFileArchive(pRecord->GetAssetPath(), IBinaryArchive::IOMode::Read);
-        if (!archive.IsValid())
-        {
-            // TODO: Properly handle load failure
-            assert(0);
-            return false;
-        }
+        auto archive = BinaryMemoryArchive(assetArchiveData, IBinaryArchive::IOMode::Read);
 
         AssetArchiveHeader header;
         Vector<std::byte> dataStream;
 
         archive >> header;
+        if (!header.IsValid())
+        {
+            return false; // Outdated archive
+        }
         archive >> dataStream;
 
         for (auto& dependency : header.GetDependencies())
@@ -74,12 +82,30 @@ class IAssetLoader
         InstallDependencies(pRecord, dependencies);
     }
 
+    /// @brief Apply the residency policy once the GPU transfers of an asset are complete
+    void UpdateResidency(AssetRecord* pRecord)
+    {
+        assert(pRecord->m_pAsset != nullptr);
+
+        if (m_cpuResidency == CPUResidency::ReleaseAfterUpload && !pRecord->IsCPUAccessRequired())
+        {
+            ReleaseCPUData(pRecord);
+        }
+    }
+
   protected:
     // Virtual loading functions, overload in specialized loader classes to implement asset-specific behavior
     virtual bool Load(AssetRequestContext& ctx, AssetRecord* pRecord, BinaryMemoryArchive& archive) = 0;
     virtual void Unload(AssetRecord* pRecord){};
     virtual void InstallDependencies(AssetRecord* pRecord, const Vector<IAssetHandle>& dependencies) {}
 
+    /// @brief Free the CPU copies of data that has been uploaded to the GPU. Only called when the upload transfers are complete
+    virtual void ReleaseCPUData(AssetRecord* pRecord) {}
+
+    void SetCPUResidency(CPUResidency residency) { m_cpuResidency = residency; }
+    void SetLifetime(AssetLifetime lifetime) { m_lifetime = lifetime; }
+    void SetReloadableWhileReferenced(bool isReloadable) { m_isReloadableWhileReferenced = isReloadable; }
+
     const AssetRecord* GetDependencyRecord(const Vector<IAssetHandle>& dependencies, size_t dependencyIndex)
     {
         assert(dependencyIndex >= 0 && dependencyIndex < dependencies.size());
@@ -106,5 +132,9 @@ class IAssetLoader
 
   public:
     virtual ~IAssetLoader(){};
+
+    CPUResidency GetCPUResidency() const { return m_cpuResidency; }
+    AssetLifetime GetLifetime() const { return m_lifetime; }
+    bool IsReloadableWhileReferenced() const { return m_isReloadableWhileReferenced; }
 };
 } // namespace aln
\ No newline at end of file
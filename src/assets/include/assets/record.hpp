@@ -8,6 +8,14 @@
 
 namespace aln
 {
+/// @brief How long an asset stays resident once nothing references it anymore
+enum class AssetLifetime : uint8_t
+{
+    Instant, // Kept in its type's residency cache while the budget allows, unloaded when evicted
+    Level,   // Unloaded when a level ends
+    Global,  // Unloaded on game exit
+};
+
 /// @brief Record kept by the asset manager service, which counts the number of references.
 // A record for an asset should be unique.
 class AssetRecord
@@ -26,6 +34,13 @@ class AssetRecord
     AssetStatus m_status = AssetStatus::Unloaded;
     uint32_t m_referenceCount = 0;
 
+    // Keep CPU copies of the asset data after its GPU upload (i.e. for collision or picking)
+    bool m_cpuAccessRequired = false;
+
+    // Residency
+    AssetLifetime m_lifetime = AssetLifetime::Instant;
+    bool m_isCached = false; // Unreferenced but kept resident by the asset service
+
     void AddReference() { m_referenceCount++; }
     void RemoveReference() { m_referenceCount--; }
     uint32_t GetReferenceCount() { return m_referenceCount; }
@@ -65,6 +80,13 @@ class AssetRecord
     inline bool IsLoaded() const { return m_status == AssetStatus::Loaded; }
     inline bool IsUnloaded() const { return m_status == AssetStatus::Unloaded; }
 
+    // ------------------------------
+    // Residency
+    // ------------------------------
+    bool IsCPUAccessRequired() const { return m_cpuAccessRequired; }
+    AssetLifetime GetLifetime() const { return m_lifetime; }
+    bool IsCached() const { return m_isCached; }
+
     // ------------------------------
     // Dependencies
     // ------------------------------
@@ -23,6 +23,7 @@ class AssetRequest
     {
         Load,
         Unload,
+        Reload, // Load a new version next to the loaded one and swap them once it is installed, i.e. when the asset file changed
         Invalid,
     };
 
@@ -41,6 +42,7 @@ class AssetRequest
   private:
     UUID m_requesterEntityID = UUID::InvalidID;
     AssetRecord* m_pAssetRecord = nullptr;
+    AssetRecord* m_pReloadedRecord = nullptr; // Record the new version of a reloaded asset is loaded to, owned by the asset service
     IAssetLoader* m_pLoader = nullptr;
     RenderEngine* m_pRenderDevice = nullptr;
 
@@ -48,6 +50,12 @@ class AssetRequest
     std::function<void(IAssetHandle&)> m_requestAssetLoad;
     std::function<void(IAssetHandle&)> m_requestAssetUnload;
 
+    // Callback reading an asset archive from the mounted bundles or a loose file
+    std::function<bool(const AssetID&, Vector<std::byte>&)> m_readAssetArchive;
+
+    // Callback requesting the whole dependency closure of an asset from the archive headers
+    std::function<void(const AssetID&, Vector<IAssetHandle>&)> m_prefetchDependencies;
+
     // Sync
     AssetRequestContext m_context;
 
@@ -59,8 +67,12 @@ class AssetRequest
     State m_status = State::Invalid;
 
     Vector<IAssetHandle> m_dependencies;
+    Vector<IAssetHandle> m_prefetchedDependencies; // Released once the asset is installed, its dependencies then hold their own references
 
   private:
+    /// @brief Record the request loads to: the asset's own one, or the one its new version is loaded to when reloading
+    AssetRecord* GetLoadingRecord() { return IsReloadingRequest() ? m_pReloadedRecord : m_pAssetRecord; }
+
     void Load();
     void WaitForDependencies();
     void Install();
@@ -68,14 +80,19 @@ class AssetRequest
 
     void Shutdown()
     {
-        m_pRenderDevice->GetVkDevice().destroySemaphore(m_transferQueueCommandsSemaphore);
-        m_pRenderDevice->GetVkDevice().destroySemaphore(m_graphicsQueueCommandsSemaphore);
+        // Headless requests never touch the GPU
+        if (m_pRenderDevice != nullptr)
+        {
+            m_pRenderDevice->GetVkDevice().destroySemaphore(m_transferQueueCommandsSemaphore);
+            m_pRenderDevice->GetVkDevice().destroySemaphore(m_graphicsQueueCommandsSemaphore);
+        }
     }
 
   public:
     bool IsValid() const { return m_type != Type::Invalid; }
     bool IsLoadingRequest() const { return m_type == Type::Load; }
     bool IsUnloadingRequest() const { return m_type == Type::Unload; }
+    bool IsReloadingRequest() const { return m_type == Type::Reload; }
     bool IsComplete() { return m_status == State::Complete; }
 
     bool WereCommandsSubmitted() const { return m_commandBuffersSubmitted; }
@@ -27,13 +27,14 @@ class AssetRequestContext
         return m_pStagingBuffer->UploadBufferToGPU<TransferQueuePersistentCommandBuffer, T>(data, dstBuffer, *m_pTransferQueueSubmission);
     }
 
+    /// @param mipOffsets: Offset of each mip level in the data. Defaults to the base level only
     template<typename T>
-    std::pair<const vk::Semaphore*, uint64_t> UploadImageThroughStaging(const Vector<T>& data, GPUImage& dstImage)
+    std::pair<const vk::Semaphore*, uint64_t> UploadImageThroughStaging(const Vector<T>& data, GPUImage& dstImage, const Vector<vk::DeviceSize>& mipOffsets = {0})
     {
         assert(m_pStagingBuffer != nullptr && m_pTransferQueueSubmission != nullptr);
         
         m_transferSubmissionAccessed = true;
-        return m_pStagingBuffer->UploadImageToGPU(data, dstImage, *m_pTransferQueueSubmission);
+        return m_pStagingBuffer->UploadImageToGPU(data, dstImage, *m_pTransferQueueSubmission, mipOffsets);
     }
 
     CommandBufferSubmission<GraphicsQueuePersistentCommandBuffer>* GetGraphicsQueueSubmission() { 
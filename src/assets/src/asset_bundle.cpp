@@ -0,0 +1,134 @@
+#include "asset_bundle.hpp"
+
+#include <common/serialization/binary_archive.hpp>
+#include <common/serialization/compression.hpp>
+
+#include <tracy/Tracy.hpp>
+
+#include <algorithm>
+#include <assert.h>
+
+namespace aln
+{
+
+bool AssetBundle::Open(const std::filesystem::path& path)
+{
+    assert(!IsOpen());
+
+    m_fileStream.open(path, std::ios::binary | std::ios::in);
+    if (!m_fileStream.is_open())
+    {
+        return false;
+    }
+
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint64_t tableOfContentsSize = 0;
+    m_fileStream.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    m_fileStream.read(reinterpret_cast<char*>(&version), sizeof(version));
+    m_fileStream.read(reinterpret_cast<char*>(&tableOfContentsSize), sizeof(tableOfContentsSize));
+    if (!m_fileStream || magic != FileMagic || version != FileVersion)
+    {
+        m_fileStream.close();
+        return false;
+    }
+
+    Vector<std::byte> tableOfContentsData(tableOfContentsSize);
+    m_fileStream.read(reinterpret_cast<char*>(tableOfContentsData.data()), tableOfContentsSize);
+    if (!m_fileStream)
+    {
+        m_fileStream.close();
+        return false;
+    }
+
+    auto archive = BinaryMemoryArchive(tableOfContentsData, IBinaryArchive::IOMode::Read);
+    archive >> m_tableOfContents;
+
+    m_path = path;
+    m_dataOffset = sizeof(magic) + sizeof(version) + sizeof(tableOfContentsSize) + tableOfContentsSize;
+    m_readAheadBuffer.clear();
+    m_readAheadOffset = 0;
+
+    return true;
+}
+
+void AssetBundle::Close()
+{
+    std::lock_guard lock(m_mutex);
+
+    m_fileStream.close();
+    m_tableOfContents.m_entries.clear();
+    m_tableOfContents.m_dependencies.clear();
+    m_readAheadBuffer.clear();
+    m_readAheadBuffer.shrink_to_fit();
+}
+
+const AssetBundleEntry* AssetBundle::FindEntry(const AssetID& assetID) const
+{
+    const auto& entries = m_tableOfContents.m_entries;
+    const auto assetIDHash = assetID.GetHash();
+
+    auto it = std::lower_bound(entries.begin(), entries.end(), assetIDHash, [](const AssetBundleEntry& entry, uint64_t hash)
+        { return entry.m_assetIDHash < hash; });
+
+    if (it == entries.end() || it->m_assetIDHash != assetIDHash)
+    {
+        return nullptr;
+    }
+    return &*it;
+}
+
+bool AssetBundle::ReadEntry(const AssetBundleEntry& entry, Vector<std::byte>& outData)
+{
+    ZoneScoped;
+
+    std::lock_guard lock(m_mutex);
+    assert(IsOpen());
+
+    outData.resize(entry.m_size);
+
+    const auto entryEnd = entry.m_offset + entry.m_size;
+    const bool isInReadAheadWindow = entry.m_offset >= m_readAheadOffset && entryEnd <= m_readAheadOffset + m_readAheadBuffer.size();
+    if (isInReadAheadWindow)
+    {
+        memcpy(outData.data(), m_readAheadBuffer.data() + (entry.m_offset - m_readAheadOffset), entry.m_size);
+    }
+    else if (entry.m_size >= ReadAheadSize)
+    {
+        // Large archives are read directly to their destination
+        m_fileStream.clear();
+        m_fileStream.seekg(m_dataOffset + entry.m_offset);
+        m_fileStream.read(reinterpret_cast<char*>(outData.data()), entry.m_size);
+        if (!m_fileStream)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        // Move the window to this entry. Archives are laid out in loading order, so the next ones are likely to be in it too
+        m_readAheadBuffer.resize(ReadAheadSize);
+        m_fileStream.clear();
+        m_fileStream.seekg(m_dataOffset + entry.m_offset);
+        m_fileStream.read(reinterpret_cast<char*>(m_readAheadBuffer.data()), ReadAheadSize);
+
+        // The window can be cut short by the end of the file
+        m_readAheadBuffer.resize(m_fileStream.gcount());
+        m_readAheadOffset = entry.m_offset;
+
+        if (m_readAheadBuffer.size() < entry.m_size)
+        {
+            m_readAheadBuffer.clear();
+            return false;
+        }
+        memcpy(outData.data(), m_readAheadBuffer.data(), entry.m_size);
+    }
+
+    if (entry.m_compressionMode == AssetCompressionMode::LZ4)
+    {
+        Compression::Decompress(outData, entry.m_uncompressedSize);
+    }
+
+    return true;
+}
+} // namespace aln
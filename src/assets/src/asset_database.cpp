@@ -0,0 +1,450 @@
+#include "asset_database.hpp"
+
+#include "asset_archive_header.hpp"
+#include "asset_service.hpp"
+
+#include <common/serialization/binary_archive.hpp>
+
+#include <tracy/Tracy.hpp>
+
+#include <algorithm>
+#include <assert.h>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace aln
+{
+namespace
+{
+/// @brief Read the dependencies listed in an asset archive's header, without reading its body
+Vector<AssetID> ReadDependencies(const std::filesystem::path& path)
+{
+    auto archive = BinaryFileArchive(path, IBinaryArchive::IOMode::Read);
+    if (!archive.IsValid())
+    {
+        return {};
+    }
+
+    AssetArchiveHeader header;
+    archive >> header;
+    if (!archive.IsValid() || !header.IsValid())
+    {
+        return {};
+    }
+    return header.GetDependencies();
+}
+
+bool IsInDirectory(const std::filesystem::path& path, const std::filesystem::path& directory)
+{
+    const auto relativePath = path.lexically_relative(directory);
+    return !relativePath.empty() && *relativePath.begin() != "..";
+}
+
+const Vector<AssetID> g_emptyAssetIDs;
+} // namespace
+
+void AssetDatabase::Initialize(const std::filesystem::path& rootDirectory, AssetService* pAssetService)
+{
+    ZoneScoped;
+
+    assert(pAssetService != nullptr);
+
+    m_rootDirectory = rootDirectory;
+    m_rootDirectory.make_preferred();
+    m_pAssetService = pAssetService;
+
+#ifdef __linux__
+    m_inotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+
+    ScanDirectory(m_rootDirectory);
+    m_lastPollingTime = std::chrono::steady_clock::now();
+}
+
+void AssetDatabase::Shutdown()
+{
+#ifdef __linux__
+    if (m_inotifyDescriptor >= 0)
+    {
+        close(m_inotifyDescriptor);
+        m_inotifyDescriptor = -1;
+    }
+    m_watchedDirectories.clear();
+#endif
+
+    m_entries.clear();
+    m_dependents.clear();
+    m_directories.clear();
+    m_pAssetService = nullptr;
+}
+
+bool AssetDatabase::IsAssetFile(const std::filesystem::path& path) const
+{
+    const auto extension = path.extension().string();
+    return extension.size() == 5 && m_pAssetService->IsAssetTypeRegistered(AssetTypeID(extension.substr(1)));
+}
+
+void AssetDatabase::ScanDirectory(const std::filesystem::path& directory)
+{
+    ZoneScoped;
+
+    std::error_code error;
+    if (!std::filesystem::is_directory(directory, error))
+    {
+        return;
+    }
+
+    Vector<std::filesystem::path> directories = {directory};
+    for (auto& directoryEntry : std::filesystem::recursive_directory_iterator(directory, error))
+    {
+        if (directoryEntry.is_directory())
+        {
+            directories.push_back(directoryEntry.path());
+        }
+        else if (IsAssetFile(directoryEntry.path()))
+        {
+            RefreshAsset(directoryEntry.path());
+        }
+    }
+
+    for (auto& subdirectory : directories)
+    {
+        auto it = std::lower_bound(m_directories.begin(), m_directories.end(), subdirectory);
+        if (it == m_directories.end() || *it != subdirectory)
+        {
+            m_directories.insert(it, subdirectory);
+            WatchDirectory(subdirectory);
+            m_revision++;
+        }
+    }
+}
+
+void AssetDatabase::WatchDirectory(const std::filesystem::path& directory)
+{
+#ifdef __linux__
+    if (m_inotifyDescriptor < 0)
+    {
+        return;
+    }
+
+    constexpr uint32_t mask = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+    const int watchDescriptor = inotify_add_watch(m_inotifyDescriptor, directory.c_str(), mask);
+    if (watchDescriptor >= 0)
+    {
+        m_watchedDirectories[watchDescriptor] = directory;
+    }
+#endif
+}
+
+void AssetDatabase::RemoveDirectory(const std::filesystem::path& directory)
+{
+    Vector<AssetID> removedAssets;
+    for (const auto& [assetID, entry] : m_entries)
+    {
+        if (IsInDirectory(assetID.GetAssetPath(), directory))
+        {
+            removedAssets.push_back(assetID);
+        }
+    }
+
+    for (const auto& assetID : removedAssets)
+    {
+        RemoveEntry(assetID);
+    }
+
+    // Watches of deleted directories are removed by the system
+    auto it = std::remove_if(m_directories.begin(), m_directories.end(), [&](const std::filesystem::path& indexedDirectory)
+        { return indexedDirectory == directory || IsInDirectory(indexedDirectory, directory); });
+    if (it != m_directories.end())
+    {
+        m_directories.erase(it, m_directories.end());
+        m_revision++;
+    }
+}
+
+void AssetDatabase::RefreshAsset(const std::filesystem::path& path)
+{
+    const AssetID assetID = AssetID(path.string());
+
+    std::error_code error;
+    const auto lastWriteTime = std::filesystem::last_write_time(path, error);
+    if (error)
+    {
+        // Deleted or moved away
+        RemoveEntry(assetID);
+        return;
+    }
+
+    auto it = m_entries.find(assetID);
+    if (it == m_entries.end())
+    {
+        AddEntry(assetID, lastWriteTime);
+        return;
+    }
+
+    auto& entry = it->second;
+    if (entry.m_lastWriteTime == lastWriteTime)
+    {
+        return;
+    }
+
+    entry.m_lastWriteTime = lastWriteTime;
+    SetDependencies(entry, ReadDependencies(path));
+    m_revision++;
+
+    m_pAssetService->ReloadAsset(assetID);
+}
+
+void AssetDatabase::AddEntry(const AssetID& assetID, std::filesystem::file_time_type lastWriteTime)
+{
+    auto& entry = m_entries[assetID];
+    entry.m_id = assetID;
+    entry.m_name = assetID.GetAssetName();
+    entry.m_lastWriteTime = lastWriteTime;
+    SetDependencies(entry, ReadDependencies(assetID.GetAssetPath()));
+
+    m_revision++;
+}
+
+void AssetDatabase::RemoveEntry(const AssetID& assetID)
+{
+    auto it = m_entries.find(assetID);
+    if (it == m_entries.end())
+    {
+        return;
+    }
+
+    SetDependencies(it->second, {});
+    m_entries.erase(it);
+
+    m_revision++;
+}
+
+void AssetDatabase::SetDependencies(AssetDatabaseEntry& entry, Vector<AssetID>&& dependencies)
+{
+    for (const auto& dependencyID : entry.m_dependencies)
+    {
+        auto& dependents = m_dependents[dependencyID];
+        dependents.erase(std::remove(dependents.begin(), dependents.end(), entry.m_id), dependents.end());
+        if (dependents.empty())
+        {
+            m_dependents.erase(dependencyID);
+        }
+    }
+
+    entry.m_dependencies = std::move(dependencies);
+
+    for (const auto& dependencyID : entry.m_dependencies)
+    {
+        m_dependents[dependencyID].push_back(entry.m_id);
+    }
+}
+
+void AssetDatabase::ProcessFileSystemNotifications()
+{
+#ifdef __linux__
+    ZoneScoped;
+
+    // Coalesce the events, a file is usually written to in several steps
+    Vector<std::filesystem::path> changedAssetPaths;
+    Vector<std::filesystem::path> createdDirectories;
+    bool rescanRequired = false;
+
+    alignas(inotify_event) char buffer[4096];
+    while (true)
+    {
+        const auto length = read(m_inotifyDescriptor, buffer, sizeof(buffer));
+        if (length <= 0)
+        {
+            break; // No more pending events
+        }
+
+        const inotify_event* pEvent = nullptr;
+        for (auto pCursor = buffer; pCursor < buffer + length; pCursor += sizeof(inotify_event) + pEvent->len)
+        {
+            pEvent = reinterpret_cast<const inotify_event*>(pCursor);
+
+            if (pEvent->mask & IN_Q_OVERFLOW)
+            {
+                rescanRequired = true;
+                continue;
+            }
+
+            auto it = m_watchedDirectories.find(pEvent->wd);
+            if (it == m_watchedDirectories.end())
+            {
+                continue;
+            }
+
+            if (pEvent->mask & IN_IGNORED)
+            {
+                m_watchedDirectories.erase(it);
+                continue;
+            }
+
+            if (pEvent->len == 0)
+            {
+                continue;
+            }
+
+            const auto path = it->second / pEvent->name;
+            if (pEvent->mask & IN_ISDIR)
+            {
+                if (pEvent->mask & (IN_CREATE | IN_MOVED_TO))
+                {
+                    createdDirectories.push_back(path);
+                }
+                else if (pEvent->mask & (IN_DELETE | IN_MOVED_FROM))
+                {
+                    RemoveDirectory(path);
+                }
+            }
+            else if (!(pEvent->mask & IN_CREATE) && IsAssetFile(path)) // Created files are indexed once written and closed
+            {
+                if (std::find(changedAssetPaths.begin(), changedAssetPaths.end(), path) == changedAssetPaths.end())
+                {
+                    changedAssetPaths.push_back(path);
+                }
+            }
+        }
+    }
+
+    if (rescanRequired)
+    {
+        // Events were lost, compare the whole directory
+        Poll();
+        return;
+    }
+
+    for (const auto& directory : createdDirectories)
+    {
+        ScanDirectory(directory);
+    }
+
+    for (const auto& path : changedAssetPaths)
+    {
+        RefreshAsset(path);
+    }
+#endif
+}
+
+void AssetDatabase::Poll()
+{
+    ZoneScoped;
+
+    Vector<std::filesystem::path> directories = {m_rootDirectory};
+    Vector<AssetID> foundAssets;
+
+    std::error_code error;
+    for (auto& directoryEntry : std::filesystem::recursive_directory_iterator(m_rootDirectory, error))
+    {
+        if (directoryEntry.is_directory())
+        {
+            directories.push_back(directoryEntry.path());
+        }
+        else if (IsAssetFile(directoryEntry.path()))
+        {
+            RefreshAsset(directoryEntry.path());
+            foundAssets.push_back(AssetID(directoryEntry.path().string()));
+        }
+    }
+
+    // Unindex the assets that disappeared
+    std::sort(foundAssets.begin(), foundAssets.end());
+    Vector<AssetID> removedAssets;
+    for (const auto& [assetID, entry] : m_entries)
+    {
+        if (!std::binary_search(foundAssets.begin(), foundAssets.end(), assetID))
+        {
+            removedAssets.push_back(assetID);
+        }
+    }
+
+    for (const auto& assetID : removedAssets)
+    {
+        RemoveEntry(assetID);
+    }
+
+    std::sort(directories.begin(), directories.end());
+    if (directories != m_directories)
+    {
+        for (const auto& directory : directories)
+        {
+            if (!std::binary_search(m_directories.begin(), m_directories.end(), directory))
+            {
+                WatchDirectory(directory);
+            }
+        }
+
+        m_directories = std::move(directories);
+        m_revision++;
+    }
+}
+
+void AssetDatabase::Update()
+{
+    ZoneScoped;
+
+#ifdef __linux__
+    if (m_inotifyDescriptor >= 0)
+    {
+        ProcessFileSystemNotifications();
+        return;
+    }
+#endif
+
+    const auto now = std::chrono::steady_clock::now();
+    if (now - m_lastPollingTime >= m_pollingInterval)
+    {
+        Poll();
+        m_lastPollingTime = now;
+    }
+}
+
+const AssetDatabaseEntry* AssetDatabase::FindEntry(const AssetID& assetID) const
+{
+    auto it = m_entries.find(assetID);
+    return (it != m_entries.end()) ? &it->second : nullptr;
+}
+
+Vector<AssetID> AssetDatabase::GetAssetsOfType(const AssetTypeID& typeID) const
+{
+    Vector<AssetID> assets;
+    for (const auto& [assetID, entry] : m_entries)
+    {
+        if (assetID.GetAssetTypeID() == typeID)
+        {
+            assets.push_back(assetID);
+        }
+    }
+    return assets;
+}
+
+Vector<AssetID> AssetDatabase::FindAssetsByNamePrefix(std::string_view prefix) const
+{
+    Vector<AssetID> assets;
+    for (const auto& [assetID, entry] : m_entries)
+    {
+        if (std::string_view(entry.m_name).starts_with(prefix))
+        {
+            assets.push_back(assetID);
+        }
+    }
+    return assets;
+}
+
+const Vector<AssetID>& AssetDatabase::GetDependencies(const AssetID& assetID) const
+{
+    auto pEntry = FindEntry(assetID);
+    return (pEntry != nullptr) ? pEntry->m_dependencies : g_emptyAssetIDs;
+}
+
+const Vector<AssetID>& AssetDatabase::GetDependents(const AssetID& assetID) const
+{
+    auto it = m_dependents.find(assetID);
+    return (it != m_dependents.end()) ? it->second : g_emptyAssetIDs;
+}
+} // namespace aln
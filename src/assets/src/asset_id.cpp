@@ -0,0 +1,69 @@
+#include "asset_id.hpp"
+
+#include <common/containers/hash_map.hpp>
+
+#include <assert.h>
+#include <mutex>
+#include <shared_mutex>
+
+namespace aln
+{
+namespace
+{
+/// @brief Global table of the interned asset paths, keyed by hash. Nodes are never removed, so references to the paths stay valid
+struct AssetPathTable
+{
+    std::shared_mutex m_mutex;
+    HashMap<uint64_t, std::string> m_paths;
+};
+
+AssetPathTable& GetAssetPathTable()
+{
+    static AssetPathTable table;
+    return table;
+}
+
+const std::string g_emptyPath;
+} // namespace
+
+AssetID::AssetID(const std::string& assetPath)
+{
+    if (assetPath.empty())
+    {
+        return;
+    }
+
+    assert(assetPath.size() > 4);
+    m_hash = Hash64(assetPath);
+    m_typeID = AssetTypeID(assetPath.substr(assetPath.size() - 4));
+
+    auto& table = GetAssetPathTable();
+    {
+        std::shared_lock lock(table.m_mutex);
+        auto it = table.m_paths.find(m_hash);
+        if (it != table.m_paths.end())
+        {
+            assert(it->second == assetPath); // Hash collision
+            return;
+        }
+    }
+
+    std::unique_lock lock(table.m_mutex);
+    table.m_paths.try_emplace(m_hash, assetPath);
+}
+
+const std::string& AssetID::GetAssetPath() const
+{
+    if (!IsValid())
+    {
+        return g_emptyPath;
+    }
+
+    auto& table = GetAssetPathTable();
+    std::shared_lock lock(table.m_mutex);
+
+    auto it = table.m_paths.find(m_hash);
+    assert(it != table.m_paths.end());
+    return it->second;
+}
+} // namespace aln
@@ -2,10 +2,14 @@
 
 #include "asset_service.hpp"
 
+#include <common/memory.hpp>
 #include <graphics/command_buffer.hpp>
 
 #include <vulkan/vulkan.hpp>
 
+#include <algorithm>
+#include <fstream>
+
 namespace aln
 {
 
@@ -23,11 +27,256 @@ AssetRecord* AssetService::GetOrCreateRecord(const AssetID& assetID)
     if (it.second)
     {
         it.first->second = AssetRecord(assetID);
+
+        auto loaderIt = m_loaders.find(assetID.GetAssetTypeID());
+        if (loaderIt != m_loaders.end())
+        {
+            it.first->second.m_lifetime = loaderIt->second->GetLifetime();
+        }
     }
 
     return &it.first->second;
 }
 
+void AssetService::ReleaseRecord(AssetRecord* pRecord)
+{
+    assert(pRecord->GetReferenceCount() == 0);
+    assert(!pRecord->IsCached());
+
+    auto& cache = m_residencyCaches[pRecord->GetAssetTypeID()];
+    const bool hasBudget = cache.m_budget.m_cpuBytes > 0 || cache.m_budget.m_gpuBytes > 0;
+    if (m_isShuttingDown || (pRecord->GetLifetime() == AssetLifetime::Instant && !hasBudget))
+    {
+        EvictRecord(pRecord);
+        return;
+    }
+
+    // Budgets are enforced on the next update, once the assets that are still loading know their footprint
+    cache.m_records.push_back(pRecord);
+    pRecord->m_isCached = true;
+}
+
+void AssetService::RemoveFromResidencyCache(AssetRecord* pRecord)
+{
+    assert(pRecord->IsCached());
+
+    auto& records = m_residencyCaches[pRecord->GetAssetTypeID()].m_records;
+    auto it = std::find(records.begin(), records.end(), pRecord);
+    assert(it != records.end());
+    records.erase(it);
+
+    pRecord->m_isCached = false;
+}
+
+void AssetService::EvictRecord(AssetRecord* pRecord)
+{
+    assert(!pRecord->IsCached());
+
+    AssetRequest& request = m_pendingRequests.emplace_back();
+    request.m_type = AssetRequest::Type::Unload;
+    request.m_status = AssetRequest::State::Pending;
+    request.m_pAssetRecord = pRecord;
+}
+
+void AssetService::EvictCachedRecords(AssetLifetime lifetime)
+{
+    std::lock_guard lock(m_mutex);
+
+    for (auto& [typeID, cache] : m_residencyCaches)
+    {
+        auto it = cache.m_records.begin();
+        while (it != cache.m_records.end())
+        {
+            auto pRecord = *it;
+            if (pRecord->GetLifetime() != lifetime)
+            {
+                ++it;
+                continue;
+            }
+
+            it = cache.m_records.erase(it);
+            pRecord->m_isCached = false;
+            EvictRecord(pRecord);
+            cache.m_stats.m_evictionCount++;
+        }
+    }
+}
+
+void AssetService::TrimResidencyCaches()
+{
+    ZoneScoped;
+
+    for (auto& [typeID, cache] : m_residencyCaches)
+    {
+        // Records still loading have no footprint yet, they are accounted for once loaded
+        const auto IsEvictable = [](const AssetRecord* pRecord)
+        { return pRecord->GetLifetime() == AssetLifetime::Instant && pRecord->IsLoaded(); };
+
+        size_t cpuBytes = 0;
+        size_t gpuBytes = 0;
+        for (const auto pRecord : cache.m_records)
+        {
+            if (IsEvictable(pRecord))
+            {
+                cpuBytes += pRecord->GetAsset()->GetCPUMemorySize();
+                gpuBytes += pRecord->GetAsset()->GetGPUMemorySize();
+            }
+        }
+
+        auto it = cache.m_records.begin();
+        while ((cpuBytes > cache.m_budget.m_cpuBytes || gpuBytes > cache.m_budget.m_gpuBytes) && it != cache.m_records.end())
+        {
+            auto pRecord = *it;
+            if (!IsEvictable(pRecord))
+            {
+                ++it;
+                continue;
+            }
+
+            cpuBytes -= pRecord->GetAsset()->GetCPUMemorySize();
+            gpuBytes -= pRecord->GetAsset()->GetGPUMemorySize();
+
+            it = cache.m_records.erase(it);
+            pRecord->m_isCached = false;
+            EvictRecord(pRecord);
+            cache.m_stats.m_evictionCount++;
+        }
+    }
+}
+
+bool AssetService::ReadAssetArchive(const AssetID& assetID, Vector<std::byte>& outData)
+{
+    ZoneScoped;
+
+    // Only the lookup is done under the lock, so that reads from different bundles do not wait on each other.
+    // Bundles are only unmounted when the service is idle, so they outlive the read
+    AssetBundle* pBundle = nullptr;
+    const AssetBundleEntry* pEntry = nullptr;
+    {
+        std::lock_guard lock(m_bundlesMutex);
+        for (auto it = m_bundles.rbegin(); it != m_bundles.rend() && pEntry == nullptr; ++it)
+        {
+            pEntry = (*it)->FindEntry(assetID);
+            pBundle = it->get();
+        }
+    }
+
+    if (pEntry != nullptr)
+    {
+        return pBundle->ReadEntry(*pEntry, outData);
+    }
+
+    // Loose file, read in one go
+    std::ifstream fileStream(assetID.GetAssetPath(), std::ios::binary | std::ios::in | std::ios::ate);
+    if (!fileStream.is_open())
+    {
+        return false;
+    }
+
+    const auto fileSize = (size_t) fileStream.tellg();
+    outData.resize(fileSize);
+    fileStream.seekg(0);
+    fileStream.read(reinterpret_cast<char*>(outData.data()), fileSize);
+
+    return (bool) fileStream;
+}
+
+bool AssetService::ReadAssetDependencies(const AssetID& assetID, Vector<AssetID>& outDependencies)
+{
+    ZoneScoped;
+
+    outDependencies.clear();
+
+    {
+        std::lock_guard lock(m_bundlesMutex);
+        for (auto it = m_bundles.rbegin(); it != m_bundles.rend(); ++it)
+        {
+            auto pEntry = (*it)->FindEntry(assetID);
+            if (pEntry != nullptr)
+            {
+                const auto dependencies = (*it)->GetDependencies(*pEntry);
+                outDependencies.insert(outDependencies.end(), dependencies.begin(), dependencies.end());
+                return true;
+            }
+        }
+    }
+
+    // Loose file, the header comes first
+    auto archive = BinaryFileArchive(assetID.GetAssetPath(), IBinaryArchive::IOMode::Read);
+    if (!archive.IsValid())
+    {
+        return false;
+    }
+
+    AssetArchiveHeader header;
+    archive >> header;
+    if (!archive.IsValid() || !header.IsValid())
+    {
+        return false;
+    }
+
+    outDependencies = header.GetDependencies();
+    return true;
+}
+
+void AssetService::PrefetchDependencies(const AssetID& assetID, Vector<IAssetHandle>& outHandles)
+{
+    ZoneScoped;
+
+    Vector<AssetID> assetsToVisit;
+    Vector<AssetID> dependencies;
+    ReadAssetDependencies(assetID, assetsToVisit);
+
+    while (!assetsToVisit.empty())
+    {
+        const auto dependencyID = assetsToVisit.back();
+        assetsToVisit.pop_back();
+
+        if (!dependencyID.IsValid())
+        {
+            continue;
+        }
+
+        bool isNewRequest = false;
+        {
+            std::lock_guard lock(m_mutex);
+
+            auto& handle = outHandles.emplace_back(IAssetHandle(dependencyID));
+            Load(handle);
+
+            // Assets already referenced are loaded or have a request of their own covering their dependencies
+            auto pRecord = FindRecord(dependencyID);
+            isNewRequest = pRecord->GetReferenceCount() == 1 && pRecord->IsUnloaded();
+        }
+
+        if (isNewRequest && ReadAssetDependencies(dependencyID, dependencies))
+        {
+            assetsToVisit.insert(assetsToVisit.end(), dependencies.begin(), dependencies.end());
+        }
+    }
+}
+
+bool AssetService::MountBundle(const std::filesystem::path& bundlePath)
+{
+    auto pBundle = std::make_unique<AssetBundle>();
+    if (!pBundle->Open(bundlePath))
+    {
+        return false;
+    }
+
+    std::lock_guard lock(m_bundlesMutex);
+    m_bundles.push_back(std::move(pBundle));
+    return true;
+}
+
+void AssetService::UnmountAllBundles()
+{
+    assert(IsIdle());
+
+    std::lock_guard lock(m_bundlesMutex);
+    m_bundles.clear();
+}
+
 AssetRequest* AssetService::FindActiveRequest(const AssetID id)
 {
     std::lock_guard lock(m_mutex);
@@ -47,10 +296,19 @@ AssetRequest* AssetService::FindActiveRequest(const AssetID id)
 void AssetService::Update()
 {
     ZoneScoped;
+    MemoryTagScope memoryTagScope(MemoryTag::Assets);
+
+    // Retired assets are kept for a number of frames, which are counted even when the loading task is still running
+    m_updateIdx++;
 
     if (m_isLoadingTaskRunning)
     {
-        if (m_loadingTask.GetIsComplete())
+        if (!m_loadingTask.GetIsComplete())
+        {
+            return;
+        }
+
+        if (IsGPUAvailable())
         {
             // Submit all the recorded command buffers (mostly cpu->gpu transfers tasks)
             bool transferCommandsRecorded = false;
@@ -101,22 +359,27 @@ void AssetService::Update()
             }
             m_graphicsQueueSubmission.Reset();
         }
-        else
-        {
-            return;
-        }
     }
 
     m_isLoadingTaskRunning = false;
 
+    // Loaders are not running anymore, reloaded assets can be swapped and retired ones unloaded
+    InstallReloadedAssets();
+    ReleaseRetiredAssets();
+
     m_mutex.lock();
 
+    TrimResidencyCaches();
+
+    // Requests conflicting with an in-flight one for the same asset are kept pending until it completes
+    Vector<AssetRequest> deferredRequests;
+
     // Filter pending requests and move them to active according to their status
     for (auto& pendingRequest : m_pendingRequests)
     {
         assert(pendingRequest.IsValid());
 
-        if (pendingRequest.m_pAssetRecord->GetAssetPath().empty())
+        if (!pendingRequest.m_pAssetRecord->GetAssetID().IsValid())
         {
             pendingRequest.m_status = AssetRequest::State::Complete;
             pendingRequest.m_pAssetRecord->m_status = AssetStatus::LoadingFailed;
@@ -124,21 +387,43 @@ void AssetService::Update()
         }
 
         auto pActiveRequest = FindActiveRequest(pendingRequest.m_pAssetRecord->GetAssetID());
-        if (pendingRequest.IsLoadingRequest())
+        if (pendingRequest.IsReloadingRequest())
+        {
+            auto pRecord = pendingRequest.m_pAssetRecord;
+            if (pActiveRequest != nullptr)
+            {
+                // Reload the latest version once the in-flight request is complete
+                deferredRequests.push_back(std::move(pendingRequest));
+            }
+            else if (pRecord->IsLoaded() && (pRecord->GetReferenceCount() == 0 || m_loaders.at(pRecord->GetAssetTypeID())->IsReloadableWhileReferenced()))
+            {
+                // The new version is loaded to its own record, the current one stays usable until it is swapped
+                auto& reloadedRecord = m_reloadedRecords.try_emplace(pRecord->GetAssetID(), pRecord->GetAssetID()).first->second;
+                reloadedRecord.m_cpuAccessRequired = pRecord->IsCPUAccessRequired();
+
+                pendingRequest.m_pReloadedRecord = &reloadedRecord;
+                pendingRequest.m_status = AssetRequest::State::Loading;
+                m_activeRequests.push_back(std::move(pendingRequest));
+            }
+            // Assets that are not loaded anymore will read the new version on their next load, and so will referenced assets whose users
+            // keep raw pointers to them
+        }
+        else if (pendingRequest.IsLoadingRequest())
         {
             if (pActiveRequest != nullptr)
             {
                 // A request for this asset is already active
                 if (pActiveRequest->IsUnloadingRequest())
                 {
-                    // TODO: Handle mismatching requests types
+                    // Reload once the unloading is complete
+                    deferredRequests.push_back(std::move(pendingRequest));
                 }
             }
             else
             {
                 if (pendingRequest.m_pAssetRecord->IsLoaded())
                 {
-                    // TODO: Asset already loaded
+                    // Asset already loaded, i.e. re-referenced before a queued unload was processed
                 }
                 else
                 {
@@ -150,12 +435,19 @@ void AssetService::Update()
         }
         else // Unloading request
         {
+            if (pendingRequest.m_pAssetRecord->GetReferenceCount() > 0)
+            {
+                // Re-referenced since the unload was queued
+                continue;
+            }
+
             if (pActiveRequest != nullptr)
             {
                 // A request for this asset is already active
-                if (pActiveRequest->IsLoadingRequest())
+                if (!pActiveRequest->IsUnloadingRequest())
                 {
-                    // TODO: Handle mismatching requests types
+                    // Unload once the loading is complete
+                    deferredRequests.push_back(std::move(pendingRequest));
                 }
             }
             else
@@ -175,6 +467,7 @@ void AssetService::Update()
     }
 
     m_pendingRequests.clear();
+    m_pendingRequests.swap(deferredRequests);
     m_mutex.unlock();
 
     // Handle active requests
@@ -188,17 +481,22 @@ void AssetService::Update()
 void AssetService::HandleActiveRequests(uint32_t threadIdx = 0)
 {
     ZoneScoped;
+    MemoryTagScope memoryTagScope(MemoryTag::Assets);
 
-    // Start command buffers that loaders will record to
-    m_transferCommandBuffer = m_pRenderDevice->GetTransferPersistentCommandPool(threadIdx).GetCommandBuffer();
-    m_graphicsCommandBuffer = m_pRenderDevice->GetGraphicsPersistentCommandPool(threadIdx).GetCommandBuffer();
-    m_pRenderDevice->SetDebugUtilsObjectName((vk::CommandBuffer) m_transferCommandBuffer, "Asset Service Transfer CB");
-    m_pRenderDevice->SetDebugUtilsObjectName((vk::CommandBuffer) m_graphicsCommandBuffer, "Asset Service Graphics CB");
+    const bool isGPUAvailable = IsGPUAvailable();
+    if (isGPUAvailable)
+    {
+        // Start command buffers that loaders will record to
+        m_transferCommandBuffer = m_pRenderDevice->GetTransferPersistentCommandPool(threadIdx).GetCommandBuffer();
+        m_graphicsCommandBuffer = m_pRenderDevice->GetGraphicsPersistentCommandPool(threadIdx).GetCommandBuffer();
+        m_pRenderDevice->SetDebugUtilsObjectName((vk::CommandBuffer) m_transferCommandBuffer, "Asset Service Transfer CB");
+        m_pRenderDevice->SetDebugUtilsObjectName((vk::CommandBuffer) m_graphicsCommandBuffer, "Asset Service Graphics CB");
 
-    m_transferQueueSubmission.Initialize(&m_transferCommandBuffer);
-    m_graphicsQueueSubmission.Initialize(&m_graphicsCommandBuffer);
+        m_transferQueueSubmission.Initialize(&m_transferCommandBuffer);
+        m_graphicsQueueSubmission.Initialize(&m_graphicsCommandBuffer);
 
-    m_stagingBuffer.FrameUpdate();
+        m_stagingBuffer.FrameUpdate();
+    }
 
     int32_t requestCount = (int32_t) m_activeRequests.size() - 1;
     for (auto idx = requestCount; idx >= 0; idx--)
@@ -207,13 +505,18 @@ void AssetService::HandleActiveRequests(uint32_t threadIdx = 0)
         pRequest->m_pLoader = m_loaders.at(pRequest->m_pAssetRecord->GetAssetTypeID()).get();
         pRequest->m_requestAssetLoad = std::bind(&AssetService::Load, this, std::placeholders::_1);
         pRequest->m_requestAssetUnload = std::bind(&AssetService::Unload, this, std::placeholders::_1);
+        pRequest->m_readAssetArchive = std::bind(&AssetService::ReadAssetArchive, this, std::placeholders::_1, std::placeholders::_2);
+        pRequest->m_prefetchDependencies = std::bind(&AssetService::PrefetchDependencies, this, std::placeholders::_1, std::placeholders::_2);
         pRequest->m_pRenderDevice = m_pRenderDevice;
 
-        pRequest->m_context.m_pTransferQueueSubmission = &m_transferQueueSubmission;
-        pRequest->m_context.m_pGraphicsQueueSubmission = &m_graphicsQueueSubmission;
-        pRequest->m_context.m_pStagingBuffer = &m_stagingBuffer;
+        if (isGPUAvailable)
+        {
+            pRequest->m_context.m_pTransferQueueSubmission = &m_transferQueueSubmission;
+            pRequest->m_context.m_pGraphicsQueueSubmission = &m_graphicsQueueSubmission;
+            pRequest->m_context.m_pStagingBuffer = &m_stagingBuffer;
+        }
 
-        if (pRequest->IsLoadingRequest())
+        if (pRequest->IsLoadingRequest() || pRequest->IsReloadingRequest())
         {
             switch (pRequest->m_status)
             {
@@ -229,7 +532,11 @@ void AssetService::HandleActiveRequests(uint32_t threadIdx = 0)
             break;
             case AssetRequest::State::Installing:
             {
-                pRequest->Install();
+                // Reloaded assets replace ones that might be in use, they are installed on the main thread
+                if (!pRequest->IsReloadingRequest())
+                {
+                    pRequest->Install();
+                }
             }
             break;
             }
@@ -248,6 +555,203 @@ void AssetService::HandleActiveRequests(uint32_t threadIdx = 0)
     }
 }
 
+void AssetService::RequireCPUAccess(const AssetID& assetID)
+{
+    std::lock_guard lock(m_mutex);
+
+    auto pRecord = GetOrCreateRecord(assetID);
+    assert(pRecord->IsUnloaded());
+    pRecord->m_cpuAccessRequired = true;
+}
+
+void AssetService::ReloadAsset(const AssetID& assetID)
+{
+    std::lock_guard lock(m_mutex);
+
+    auto it = m_assetCache.find(assetID);
+    if (it == m_assetCache.end())
+    {
+        return; // Never requested
+    }
+
+    AssetRequest& request = m_pendingRequests.emplace_back();
+    request.m_type = AssetRequest::Type::Reload;
+    request.m_status = AssetRequest::State::Pending;
+    request.m_pAssetRecord = &it->second;
+}
+
+void AssetService::InstallReloadedAssets()
+{
+    ZoneScoped;
+
+    for (int32_t idx = (int32_t) m_activeRequests.size() - 1; idx >= 0; idx--)
+    {
+        auto pRequest = &m_activeRequests[idx];
+        if (!pRequest->IsReloadingRequest() || pRequest->m_status != AssetRequest::State::Installing)
+        {
+            continue;
+        }
+
+        pRequest->Install();
+        if (!pRequest->IsComplete())
+        {
+            continue; // GPU transfers still in progress
+        }
+
+        auto pRecord = pRequest->m_pAssetRecord;
+        auto pReloadedRecord = pRequest->m_pReloadedRecord;
+        const auto assetID = pRecord->GetAssetID();
+        assert(pRecord->IsLoaded() && pReloadedRecord->IsLoaded());
+
+        {
+            std::lock_guard lock(m_mutex);
+
+            // The previous version and the dependencies it references are kept until the frames in flight are done with them
+            auto& retiredAsset = m_retiredAssets.emplace_back(RetiredAsset{.m_record = AssetRecord(assetID), .m_retiredUpdateIdx = m_updateIdx});
+            retiredAsset.m_record.m_pAsset = pRecord->m_pAsset;
+            retiredAsset.m_record.m_dependencies = std::move(pRecord->m_dependencies);
+            retiredAsset.m_record.m_status = AssetStatus::Loaded;
+
+            pRecord->m_pAsset = pReloadedRecord->m_pAsset;
+            pRecord->m_dependencies = std::move(pReloadedRecord->m_dependencies);
+            m_reloadedRecords.erase(assetID);
+        }
+
+        pRequest->Shutdown();
+        m_activeRequests.erase(m_activeRequests.begin() + idx);
+
+        ReinstallDependents(assetID);
+        m_assetReloadedEvent.Fire(assetID);
+    }
+}
+
+void AssetService::ReleaseRetiredAssets()
+{
+    ZoneScoped;
+
+    std::lock_guard lock(m_mutex);
+
+    auto it = m_retiredAssets.begin();
+    while (it != m_retiredAssets.end())
+    {
+        if (!m_isShuttingDown && m_updateIdx < it->m_retiredUpdateIdx + RetiredAssetUpdateCount)
+        {
+            ++it;
+            continue;
+        }
+
+        auto& record = it->m_record;
+        m_loaders.at(record.GetAssetTypeID())->UnloadAsset(&record);
+        for (const auto& dependencyID : record.GetDependencies())
+        {
+            IAssetHandle dependencyHandle(dependencyID);
+            Unload(dependencyHandle);
+        }
+
+        it = m_retiredAssets.erase(it);
+    }
+}
+
+void AssetService::ReinstallDependents(const AssetID& assetID)
+{
+    ZoneScoped;
+
+    std::lock_guard lock(m_mutex);
+
+    // Dependents are reinstalled breadth-first, so that an asset is reinstalled after the dependencies it reads from (i.e. texture -> material -> mesh)
+    Vector<AssetID> reinstalledAssets = {assetID};
+    for (auto reinstalledIdx = 0; reinstalledIdx < reinstalledAssets.size(); ++reinstalledIdx)
+    {
+        const auto reinstalledID = reinstalledAssets[reinstalledIdx];
+        for (auto& [dependentID, dependentRecord] : m_assetCache)
+        {
+            if (!dependentRecord.IsLoaded())
+            {
+                continue;
+            }
+
+            const auto& dependencyIDs = dependentRecord.GetDependencies();
+            if (std::find(dependencyIDs.begin(), dependencyIDs.end(), reinstalledID) == dependencyIDs.end() ||
+                std::find(reinstalledAssets.begin(), reinstalledAssets.end(), dependentID) != reinstalledAssets.end())
+            {
+                continue;
+            }
+
+            Vector<IAssetHandle> dependencies;
+            dependencies.reserve(dependencyIDs.size());
+            for (const auto& dependencyID : dependencyIDs)
+            {
+                auto& dependencyHandle = dependencies.emplace_back(dependencyID);
+                dependencyHandle.m_pAssetRecord = FindRecord(dependencyID);
+            }
+
+            m_loaders.at(dependentRecord.GetAssetTypeID())->InstallDependencies(&dependentRecord, dependencies);
+            reinstalledAssets.push_back(dependentID);
+        }
+    }
+}
+
+void AssetService::SetLifetime(const AssetID& assetID, AssetLifetime lifetime)
+{
+    std::lock_guard lock(m_mutex);
+
+    auto pRecord = GetOrCreateRecord(assetID);
+    pRecord->m_lifetime = lifetime;
+}
+
+void AssetService::ReleaseLevelAssets()
+{
+    EvictCachedRecords(AssetLifetime::Level);
+}
+
+void AssetService::FlushResidencyCaches()
+{
+    EvictCachedRecords(AssetLifetime::Instant);
+}
+
+HashMap<AssetTypeID, AssetResidencyStats> AssetService::GetResidencyStats()
+{
+    std::lock_guard lock(m_mutex);
+
+    HashMap<AssetTypeID, AssetResidencyStats> stats;
+    for (const auto& [typeID, cache] : m_residencyCaches)
+    {
+        auto& typeStats = stats[typeID];
+        typeStats = cache.m_stats;
+        for (const auto pRecord : cache.m_records)
+        {
+            typeStats.m_cachedAssetCount++;
+            if (pRecord->IsLoaded())
+            {
+                typeStats.m_cachedCPUBytes += pRecord->GetAsset()->GetCPUMemorySize();
+                typeStats.m_cachedGPUBytes += pRecord->GetAsset()->GetGPUMemorySize();
+            }
+        }
+    }
+    return stats;
+}
+
+HashMap<AssetTypeID, AssetMemoryUsage> AssetService::GetMemoryReport()
+{
+    std::lock_guard lock(m_mutex);
+
+    HashMap<AssetTypeID, AssetMemoryUsage> report;
+    for (const auto& [assetID, record] : m_assetCache)
+    {
+        if (!record.IsLoaded())
+        {
+            continue;
+        }
+
+        const auto pAsset = record.GetAsset();
+        auto& usage = report[record.GetAssetTypeID()];
+        usage.m_assetCount++;
+        usage.m_cpuBytes += pAsset->GetCPUMemorySize();
+        usage.m_gpuBytes += pAsset->GetGPUMemorySize();
+    }
+    return report;
+}
+
 void AssetService::Load(IAssetHandle& assetHandle)
 {
     if (!assetHandle.GetAssetID().IsValid())
@@ -264,6 +768,16 @@ void AssetService::Load(IAssetHandle& assetHandle)
     pRecord->AddReference();
     if (pRecord->GetReferenceCount() == 1)
     {
+        auto& stats = m_residencyCaches[pRecord->GetAssetTypeID()].m_stats;
+        if (pRecord->IsCached())
+        {
+            // Resurrect the unreferenced resident asset
+            RemoveFromResidencyCache(pRecord);
+            stats.m_hitCount++;
+            return;
+        }
+        stats.m_missCount++;
+
         AssetRequest& request = m_pendingRequests.emplace_back();
         request.m_type = AssetRequest::Type::Load;
         request.m_status = AssetRequest::State::Pending;
@@ -284,13 +798,12 @@ void AssetService::Unload(IAssetHandle& assetHandle)
     assetHandle.m_pAssetRecord = nullptr;
 
     auto pRecord = FindRecord(assetHandle.GetAssetID());
-    if (pRecord->GetReferenceCount() == 1)
+    assert(pRecord->GetReferenceCount() > 0);
+
+    pRecord->RemoveReference();
+    if (pRecord->GetReferenceCount() == 0)
     {
-        AssetRequest& request = m_pendingRequests.emplace_back();
-        request.m_type = AssetRequest::Type::Unload;
-        request.m_status = AssetRequest::State::Pending;
-        request.m_pAssetRecord = pRecord;
+        ReleaseRecord(pRecord);
     }
-    pRecord->RemoveReference();
 }
 } // namespace aln
\ No newline at end of file
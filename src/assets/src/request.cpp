@@ -1,6 +1,10 @@
 #include "request.hpp"
 #include "status.hpp"
 
+#include <common/profiling.hpp>
+
+#include <typeinfo>
+
 namespace aln
 {
 class AssetService;
@@ -8,15 +12,22 @@ class AssetService;
 void AssetRequest::Load()
 {
     ZoneScoped;
+    ALN_PROFILE_SCOPE(typeid(*m_pLoader).name(), ProfileCategory::AssetLoader);
+
+    auto pRecord = GetLoadingRecord();
 
-    if (!m_pLoader->LoadAsset(m_context, m_pAssetRecord)) // Load the resource
+    // Request the whole dependency closure up front so that it loads in parallel, instead of one dependency level per update
+    m_prefetchDependencies(pRecord->GetAssetID(), m_prefetchedDependencies);
+
+    Vector<std::byte> assetArchiveData;
+    if (!m_readAssetArchive(pRecord->GetAssetID(), assetArchiveData) || !m_pLoader->LoadAsset(m_context, pRecord, assetArchiveData)) // Load the resource
     {
         // TODO: Loading failed. Handle it !
         m_status = State::Failed;
         assert(0);
     }
 
-    if (!m_pAssetRecord->HasDependencies())
+    if (!pRecord->HasDependencies())
     {
         // Loading finished and no dependencies to wait for
         m_status = State::Installing;
@@ -26,7 +37,7 @@ void AssetRequest::Load()
         m_status = State::WaitingForDependencies;
 
         // Start loading the dependencies
-        auto& dependencies = m_pAssetRecord->GetDependencies();
+        auto& dependencies = pRecord->GetDependencies();
         m_dependencies.reserve(dependencies.size());
         for (auto& dependencyID : dependencies)
         {
@@ -68,10 +79,21 @@ void AssetRequest::Install()
         return;
     }
 
-    m_pLoader->InstallAsset(m_pAssetRecord->GetAssetID(), m_pAssetRecord, m_dependencies);
+    auto pRecord = GetLoadingRecord();
+
+    // GPU transfers are complete at this point, CPU copies of the uploaded data can be dropped
+    m_pLoader->UpdateResidency(pRecord);
+
+    m_pLoader->InstallAsset(pRecord->GetAssetID(), pRecord, m_dependencies);
     m_dependencies.clear();
 
-    m_pAssetRecord->m_status = AssetStatus::Loaded;
+    for (auto& dependencyHandle : m_prefetchedDependencies)
+    {
+        m_requestAssetUnload(dependencyHandle);
+    }
+    m_prefetchedDependencies.clear();
+
+    pRecord->m_status = AssetStatus::Loaded;
     m_status = State::Complete;
 }
 
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <assert.h>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace aln
+{
+template <typename Signature, size_t Capacity = 4 * sizeof(void*)>
+class Delegate;
+
+/// @brief Type-erased callable stored inline, in a fixed-size buffer. Binding never allocates.
+/// Callables that do not fit are rejected at compile time: capture a pointer to the state rather than the state itself
+/// @tparam Capacity: Size of the inline storage, in bytes
+template <typename R, typename... Args, size_t Capacity>
+class Delegate<R(Args...), Capacity>
+{
+    enum class Operation
+    {
+        Copy,
+        Move,
+        Destroy,
+    };
+
+    using Invoker = R (*)(void* pStorage, Args... args);
+    using Manager = void (*)(Operation operation, void* pDestination, void* pSource);
+
+  private:
+    alignas(std::max_align_t) std::byte m_storage[Capacity];
+    Invoker m_pInvoker = nullptr;
+    Manager m_pManager = nullptr;
+
+    template <typename TCallable>
+    static R Invoke(void* pStorage, Args... args)
+    {
+        return (*static_cast<TCallable*>(pStorage))(std::forward<Args>(args)...);
+    }
+
+    template <typename TCallable>
+    static void Manage(Operation operation, void* pDestination, void* pSource)
+    {
+        switch (operation)
+        {
+        case Operation::Copy:
+        {
+            if constexpr (std::is_copy_constructible_v<TCallable>)
+            {
+                new (pDestination) TCallable(*static_cast<const TCallable*>(pSource));
+            }
+            else
+            {
+                assert(false); // Copying a delegate bound to a move-only callable
+            }
+            break;
+        }
+        case Operation::Move:
+        {
+            new (pDestination) TCallable(std::move(*static_cast<TCallable*>(pSource)));
+            static_cast<TCallable*>(pSource)->~TCallable();
+            break;
+        }
+        case Operation::Destroy:
+        {
+            static_cast<TCallable*>(pSource)->~TCallable();
+            break;
+        }
+        }
+    }
+
+  public:
+    Delegate() = default;
+
+    template <typename TFunction, typename = std::enable_if_t<!std::is_same_v<std::decay_t<TFunction>, Delegate>>>
+    Delegate(TFunction&& function)
+    {
+        using TCallable = std::decay_t<TFunction>;
+        static_assert(std::is_invocable_r_v<R, TCallable&, Args...>, "Callable does not match the delegate's signature");
+        static_assert(sizeof(TCallable) <= Capacity, "Callable too large to be stored inline");
+        static_assert(alignof(TCallable) <= alignof(std::max_align_t), "Callable is over-aligned");
+
+        new (m_storage) TCallable(std::forward<TFunction>(function));
+        m_pInvoker = &Invoke<TCallable>;
+        m_pManager = &Manage<TCallable>;
+    }
+
+    Delegate(const Delegate& other) : m_pInvoker(other.m_pInvoker), m_pManager(other.m_pManager)
+    {
+        if (m_pManager != nullptr)
+        {
+            m_pManager(Operation::Copy, m_storage, const_cast<std::byte*>(other.m_storage));
+        }
+    }
+
+    Delegate(Delegate&& other) noexcept : m_pInvoker(other.m_pInvoker), m_pManager(other.m_pManager)
+    {
+        if (m_pManager != nullptr)
+        {
+            m_pManager(Operation::Move, m_storage, other.m_storage);
+            other.m_pInvoker = nullptr;
+            other.m_pManager = nullptr;
+        }
+    }
+
+    Delegate& operator=(const Delegate& other)
+    {
+        if (this != &other)
+        {
+            Reset();
+            m_pInvoker = other.m_pInvoker;
+            m_pManager = other.m_pManager;
+            if (m_pManager != nullptr)
+            {
+                m_pManager(Operation::Copy, m_storage, const_cast<std::byte*>(other.m_storage));
+            }
+        }
+        return *this;
+    }
+
+    Delegate& operator=(Delegate&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            m_pInvoker = other.m_pInvoker;
+            m_pManager = other.m_pManager;
+            if (m_pManager != nullptr)
+            {
+                m_pManager(Operation::Move, m_storage, other.m_storage);
+                other.m_pInvoker = nullptr;
+                other.m_pManager = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    ~Delegate() { Reset(); }
+
+    /// @brief Unbind the callable
+    void Reset()
+    {
+        if (m_pManager != nullptr)
+        {
+            m_pManager(Operation::Destroy, nullptr, m_storage);
+            m_pInvoker = nullptr;
+            m_pManager = nullptr;
+        }
+    }
+
+    bool IsBound() const { return m_pInvoker != nullptr; }
+    explicit operator bool() const { return IsBound(); }
+
+    R operator()(Args... args) const
+    {
+        assert(IsBound());
+        return m_pInvoker(const_cast<std::byte*>(m_storage), std::forward<Args>(args)...);
+    }
+};
+} // namespace aln
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <aln_common_export.h>
 
 #include <common/colors.hpp>
 #include <common/transform.hpp>
@@ -9,24 +10,19 @@
 
 namespace aln
 {
-/// @todo Support multiple threads drawing at the same time
+/// @brief Debug geometry recorded by a single thread. Use DebugDrawing::GetThreadContext to get the calling thread's one,
+/// so that systems updated in parallel can draw without synchronization
 class DrawingContext
 {
-    friend class GraphicsSystem;
-
   private:
-    Vector<DebugVertex> m_vertices; // CPU debug lines data
+    Vector<DebugVertex> m_vertices; // CPU debug lines data, two vertices per line
 
   public:
     void DrawLine(const Vec3& start, const Vec3& end, const RGBColor color)
     {
-        auto& startVertex = m_vertices.emplace_back();
-        startVertex.pos = start;
-        startVertex.color = color.ToVec3();
-
-        auto& endVertex = m_vertices.emplace_back();
-        endVertex.pos = end;
-        endVertex.color = color.ToVec3();
+        const auto packedColor = color.ToU32();
+        m_vertices.push_back({.pos = start, .color = packedColor});
+        m_vertices.push_back({.pos = end, .color = packedColor});
     }
 
     /// @brief Draw the 3 coordinate axis of the given transform
@@ -40,5 +36,25 @@ class DrawingContext
         DrawLine(transform.GetTranslation(), transform.GetTranslation() + y, RGBColor::Green); // y
         DrawLine(transform.GetTranslation(), transform.GetTranslation() + z, RGBColor::Blue);  // z
     }
+
+    /// @brief Remove all recorded geometry. Keeps the allocated memory for the next frames
+    void Clear() { m_vertices.clear(); }
+
+    const Vector<DebugVertex>& GetVertices() const { return m_vertices; }
+    uint32_t GetVertexCount() const { return m_vertices.size(); }
 };
-} // namespace aln
\ No newline at end of file
+
+namespace DebugDrawing
+{
+/// @brief Drawing context of the calling thread, created on first use. Lock-free once created
+ALN_COMMON_EXPORT DrawingContext& GetThreadContext();
+
+/// @brief Clear the geometry of every thread.
+/// Must be called from the frame loop thread, while no other thread draws
+ALN_COMMON_EXPORT void Clear();
+
+/// @brief Merge the geometry of every thread into a single contiguous buffer. Contexts are left untouched.
+/// Must be called from the frame loop thread, while no other thread draws
+ALN_COMMON_EXPORT void CollectVertices(Vector<DebugVertex>& outVertices);
+} // namespace DebugDrawing
+} // namespace aln
@@ -1,55 +1,158 @@
 #pragma once
 
-#include "uuid.hpp"
 #include "common/containers/vector.hpp"
+#include "delegate.hpp"
 
-#include <functional>
+#include <assert.h>
+#include <mutex>
+#include <stdint.h>
+#include <tuple>
+#include <type_traits>
 
 namespace aln
 {
+/// @brief Handle to a listener bound to an event, used to unbind it
+class EventListenerID
+{
+    template <typename... Args>
+    friend class Event;
+
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+  private:
+    uint32_t m_index = InvalidIndex;
+    uint32_t m_generation = 0;
+
+    EventListenerID(uint32_t index, uint32_t generation) : m_index(index), m_generation(generation) {}
+
+  public:
+    /// @brief Default construct an invalid id
+    EventListenerID() = default;
+
+    inline bool IsValid() const { return m_index != InvalidIndex; }
+
+    inline bool operator==(const EventListenerID& other) const { return m_index == other.m_index && m_generation == other.m_generation; }
+    inline bool operator!=(const EventListenerID& other) const { return !operator==(other); }
+};
+
 /// @brief Event emitting object. Functions can bind to it and be triggered when it's fired.
+/// Listeners are inline delegates stored in recycled slots: binding does not allocate once the slots exist, and unbinding is O(1)
 template <typename... Args>
 class Event
 {
-    using ListenerFunction = std::function<void(Args...)>;
+  public:
+    using ListenerDelegate = Delegate<void(Args...)>;
 
+  private:
     struct Listener
     {
-        UUID m_id = UUID::Generate();
-        ListenerFunction m_function;
-
-        Listener(ListenerFunction&& function) : m_function(function) {}
+        ListenerDelegate m_delegate; // Unbound in free slots
+        uint32_t m_generation = 0;   // Incremented when the slot is freed, so that stale ids can be detected
     };
 
-  private:
     Vector<Listener> m_listeners;
+    Vector<uint32_t> m_freeListenerIndices;
+    uint32_t m_listenerCount = 0;
 
   public:
     ~Event()
     {
-        assert(m_listeners.empty());
+        assert(m_listenerCount == 0);
     }
 
-    const UUID& BindListener(ListenerFunction&& listenerFunction)
+    template <typename TFunction>
+    EventListenerID BindListener(TFunction&& listenerFunction)
     {
-        auto& listener = m_listeners.emplace_back(std::forward<ListenerFunction>(listenerFunction));
-        return listener.m_id;
+        uint32_t listenerIdx;
+        if (m_freeListenerIndices.empty())
+        {
+            listenerIdx = m_listeners.size();
+            m_listeners.emplace_back();
+        }
+        else
+        {
+            listenerIdx = m_freeListenerIndices.back();
+            m_freeListenerIndices.pop_back();
+        }
+
+        auto& listener = m_listeners[listenerIdx];
+        listener.m_delegate = ListenerDelegate(std::forward<TFunction>(listenerFunction));
+        m_listenerCount++;
+
+        return EventListenerID(listenerIdx, listener.m_generation);
     }
 
-    void UnbindListener(const UUID& listenerID)
+    void UnbindListener(const EventListenerID& listenerID)
     {
-        auto it = std::find_if(m_listeners.begin(), m_listeners.end(), [&](Listener& listener)
-            { return listener.m_id == listenerID; });
-        assert(it != m_listeners.end());
-        m_listeners.erase(it);
+        assert(listenerID.IsValid() && listenerID.m_index < m_listeners.size());
+
+        auto& listener = m_listeners[listenerID.m_index];
+        assert(listener.m_generation == listenerID.m_generation && listener.m_delegate.IsBound()); // Stale id
+
+        listener.m_delegate.Reset();
+        listener.m_generation++;
+        m_freeListenerIndices.push_back(listenerID.m_index);
+        m_listenerCount--;
     }
 
+    bool HasListeners() const { return m_listenerCount > 0; }
+
     void Fire(Args... args) const
     {
-        for (auto& listener : m_listeners)
+        // Listeners bound while firing are not notified
+        const auto listenerCount = m_listeners.size();
+        for (uint32_t listenerIdx = 0; listenerIdx < listenerCount; ++listenerIdx)
+        {
+            const auto& listener = m_listeners[listenerIdx];
+            if (listener.m_delegate.IsBound())
+            {
+                listener.m_delegate(args...);
+            }
+        }
+    }
+};
+
+/// @brief Event whose firings are queued, then dispatched to the listeners in a single batch when its owner drains the queue, typically once per frame.
+/// Firing is thread safe. Arguments are stored by value until dispatch
+template <typename... Args>
+class DeferredEvent
+{
+    using QueuedArgs = std::tuple<std::decay_t<Args>...>;
+
+  private:
+    Event<Args...> m_event;
+
+    std::mutex m_queueMutex;
+    Vector<QueuedArgs> m_queue;
+    Vector<QueuedArgs> m_dispatchedQueue; // Swapped with the queue during dispatch, so that both keep their capacity
+
+  public:
+    template <typename TFunction>
+    EventListenerID BindListener(TFunction&& listenerFunction) { return m_event.BindListener(std::forward<TFunction>(listenerFunction)); }
+    void UnbindListener(const EventListenerID& listenerID) { m_event.UnbindListener(listenerID); }
+
+    void Fire(Args... args)
+    {
+        std::lock_guard lock(m_queueMutex);
+        m_queue.emplace_back(args...);
+    }
+
+    /// @brief Notify the listeners of all the events fired since the last dispatch, in order.
+    /// Events fired by the listeners themselves are queued for the next one
+    void Dispatch()
+    {
+        {
+            std::lock_guard lock(m_queueMutex);
+            std::swap(m_queue, m_dispatchedQueue);
+        }
+
+        for (auto& args : m_dispatchedQueue)
         {
-            listener.m_function(std::forward<Args>(args)...);
+            std::apply([&](auto&... unpackedArgs)
+                { m_event.Fire(unpackedArgs...); },
+                args);
         }
+        m_dispatchedQueue.clear();
     }
 };
-} // namespace aln
\ No newline at end of file
+} // namespace aln
@@ -3,4 +3,5 @@
 namespace aln::Maths
 {
 static constexpr float Epsilon = 0.000001;
+static constexpr float Pi = 3.14159265358979f;
 }
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "maths.hpp"
+#include "vec2.hpp"
+#include "vec3.hpp"
+
+#include <glm/gtc/packing.hpp>
+
+#include <stdint.h>
+
+/// --------------------------
+/// Quantization helpers used to pack vertex attributes in compact GPU formats
+/// --------------------------
+
+namespace aln::Maths
+{
+inline uint16_t FloatToHalf(float value) { return glm::packHalf1x16(value); }
+inline float HalfToFloat(uint16_t value) { return glm::unpackHalf1x16(value); }
+
+/// @brief Quantize a float in [-1, 1] to a signed normalized 16 bit integer
+inline int16_t FloatToSnorm16(float value) { return (int16_t) glm::packSnorm1x16(Clamp(value, -1.0f, 1.0f)); }
+inline float Snorm16ToFloat(int16_t value) { return glm::unpackSnorm1x16((uint16_t) value); }
+
+/// @brief Quantize a float in [0, 1] to an unsigned normalized 8 bit integer
+inline uint8_t FloatToUnorm8(float value) { return glm::packUnorm1x8(Clamp(value, 0.0f, 1.0f)); }
+inline float Unorm8ToFloat(uint8_t value) { return glm::unpackUnorm1x8(value); }
+
+/// @brief Encode a unit vector with the octahedral mapping. The result lies in [-1, 1]^2
+/// @note See "A Survey of Efficient Representations for Independent Unit Vectors" (Cigolle et al. 2014)
+inline Vec2 OctahedralEncode(const Vec3& normal)
+{
+    const auto l1Norm = Abs(normal.x) + Abs(normal.y) + Abs(normal.z);
+    Vec2 encoded = Vec2(normal.x, normal.y) / l1Norm;
+    if (normal.z < 0.0f)
+    {
+        const auto signX = encoded.x >= 0.0f ? 1.0f : -1.0f;
+        const auto signY = encoded.y >= 0.0f ? 1.0f : -1.0f;
+        encoded = Vec2((1.0f - Abs(encoded.y)) * signX, (1.0f - Abs(encoded.x)) * signY);
+    }
+    return encoded;
+}
+
+inline Vec3 OctahedralDecode(const Vec2& encoded)
+{
+    Vec3 normal = Vec3(encoded.x, encoded.y, 1.0f - Abs(encoded.x) - Abs(encoded.y));
+    const auto t = Max(-normal.z, 0.0f);
+    normal.x += normal.x >= 0.0f ? -t : t;
+    normal.y += normal.y >= 0.0f ? -t : t;
+    return normal.Normalized();
+}
+} // namespace aln::Maths
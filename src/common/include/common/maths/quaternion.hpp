@@ -2,13 +2,20 @@
 
 #include "angles.hpp"
 #include "constants.hpp"
+#include "maths.hpp"
+#include "simd.hpp"
+#include "trig.hpp"
 #include "vec3.hpp"
 
+#include "../containers/span.hpp"
+
 #include <aln_common_export.h>
 
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtx/quaternion.hpp>
 
+#include <limits>
+
 namespace aln
 {
 
@@ -18,15 +25,92 @@ class Vec3;
 class ALN_COMMON_EXPORT Quaternion
 {
     friend class Matrix4x4;
+    friend class Transform;
+    friend struct WideQuaternion;
 
   private:
     Quaternion(const glm::quat& quat) : w(quat.w), x(quat.x), y(quat.y), z(quat.z) {}
     glm::quat AsGLM() const { return glm::quat(w, x, y, z); }
 
-    bool IsNormalized() const { return *this == Normalized(); }
+    // SIMD kernels. Quaternions are loaded as a single (w, x, y, z) register
+    inline SIMD::Float4 ToSIMD() const { return SIMD::Load((const float*) this); }
+    inline void SetFromSIMD(SIMD::Float4 q) { SIMD::Store((float*) this, q); }
+    inline static Quaternion FromSIMD(SIMD::Float4 q)
+    {
+        Quaternion result;
+        result.SetFromSIMD(q);
+        return result;
+    }
+
+    /// @brief Hamilton product a * b
+    inline static SIMD::Float4 MultiplySIMD(SIMD::Float4 a, SIMD::Float4 b)
+    {
+        // Each lane of a scales a signed permutation of b
+        SIMD::Float4 result = SIMD::Mul(SIMD::SplatLane<0>(a), b);
+        result = SIMD::MulAdd(SIMD::SplatLane<1>(a), SIMD::Mul(SIMD::Shuffle<1, 0, 3, 2>(b), SIMD::Set(-1.0f, 1.0f, -1.0f, 1.0f)), result);
+        result = SIMD::MulAdd(SIMD::SplatLane<2>(a), SIMD::Mul(SIMD::Shuffle<2, 3, 0, 1>(b), SIMD::Set(-1.0f, 1.0f, 1.0f, -1.0f)), result);
+        result = SIMD::MulAdd(SIMD::SplatLane<3>(a), SIMD::Mul(SIMD::Shuffle<3, 2, 1, 0>(b), SIMD::Set(-1.0f, -1.0f, 1.0f, 1.0f)), result);
+        return result;
+    }
+
+    /// @brief Normalize a quaternion. Null quaternions become the identity
+    inline static SIMD::Float4 NormalizeSIMD(SIMD::Float4 q)
+    {
+        const SIMD::Float4 squaredLength = SIMD::Dot4(q, q);
+        if (SIMD::GetX(squaredLength) <= 0.0f)
+        {
+            return SIMD::Set(1.0f, 0.0f, 0.0f, 0.0f);
+        }
+        return SIMD::Div(q, SIMD::Sqrt(squaredLength));
+    }
+
+    /// @brief Rotate a vector (x, y, z, _) by a unit quaternion
+    inline static SIMD::Float4 RotateVectorSIMD(SIMD::Float4 q, SIMD::Float4 vector)
+    {
+        // v' = v + w * t + cross(q.xyz, t), with t = 2 * cross(q.xyz, v)
+        const SIMD::Float4 axis = SIMD::Shuffle<1, 2, 3, 0>(q);
+        const SIMD::Float4 t = SIMD::Mul(SIMD::Cross3(axis, vector), SIMD::Splat(2.0f));
+        return SIMD::Add(SIMD::MulAdd(SIMD::SplatLane<0>(q), t, vector), SIMD::Cross3(axis, t));
+    }
+
+    /// @brief Weights of a and b in their spherical interpolation, from the cosine of the angle between them.
+    /// The weight of b is negative when it is more than half a turn away, to take the shortest path
+    inline static void GetSlerpWeights(float cosTheta, float t, float& weightA, float& weightB)
+    {
+        const float bSign = cosTheta < 0.0f ? -1.0f : 1.0f;
+        cosTheta *= bSign;
+
+        // sin(theta) is close to 0, fall back to a linear interpolation
+        if (cosTheta > 1.0f - std::numeric_limits<float>::epsilon())
+        {
+            weightA = 1.0f - t;
+            weightB = t * bSign;
+            return;
+        }
+
+        const auto theta = (float) Maths::Acos(cosTheta);
+        const auto invSinTheta = 1.0f / Maths::Sin(theta);
+        weightA = Maths::Sin((1.0f - t) * theta) * invSinTheta;
+        weightB = Maths::Sin(t * theta) * invSinTheta * bSign;
+    }
+
+    inline static SIMD::Float4 SlerpSIMD(SIMD::Float4 a, SIMD::Float4 b, float t)
+    {
+        float weightA, weightB;
+        GetSlerpWeights(SIMD::GetX(SIMD::Dot4(a, b)), t, weightA, weightB);
+        return SIMD::MulAdd(a, SIMD::Splat(weightA), SIMD::Mul(b, SIMD::Splat(weightB)));
+    }
+
+    inline static SIMD::Float4 NLerpSIMD(SIMD::Float4 a, SIMD::Float4 b, float t)
+    {
+        const float bSign = SIMD::GetX(SIMD::Dot4(a, b)) < 0.0f ? -1.0f : 1.0f;
+        return NormalizeSIMD(SIMD::MulAdd(a, SIMD::Splat(1.0f - t), SIMD::Mul(b, SIMD::Splat(t * bSign))));
+    }
 
   public:
-    float w, x, y, z;
+    // Aligned so that quaternions load in a single SIMD register
+    alignas(16) float w;
+    float x, y, z;
 
     Quaternion() = default;
     Quaternion(float w, float x, float y, float z) : w(w), x(x), y(y), z(z) {}
@@ -40,23 +124,46 @@ class ALN_COMMON_EXPORT Quaternion
     EulerAnglesRadians ToEulerAngles() const;
     Matrix4x4 ToMatrix() const;
 
-    inline bool IsNearEqual(const Quaternion& other, float eps = Maths::Epsilon) const { return glm::all(glm::epsilonEqual(AsGLM(), other.AsGLM(), eps)); }
+    inline float SquaredLength() const { return w * w + x * x + y * y + z * z; }
+    /// @brief Cheap check, used in assertions
+    inline bool IsNormalized() const { return Maths::Abs(SquaredLength() - 1.0f) <= 4.0f * Maths::Epsilon; }
+
+    inline bool IsNearEqual(const Quaternion& other, float eps = Maths::Epsilon) const { return SIMD::AllNearEqual(ToSIMD(), other.ToSIMD(), eps); }
     bool operator==(const Quaternion& other) const { return IsNearEqual(other); }
     bool operator!=(const Quaternion& other) const { return !IsNearEqual(other); }
 
     Quaternion operator*(const Quaternion& other) const
     {
         assert(IsNormalized() && other.IsNormalized());
-        return Quaternion(AsGLM() * other.AsGLM());
+        return FromSIMD(MultiplySIMD(ToSIMD(), other.ToSIMD()));
+    }
+
+    inline Quaternion Inversed() const
+    {
+        const auto conjugate = Conjugated().ToSIMD();
+        return FromSIMD(SIMD::Div(conjugate, SIMD::Dot4(conjugate, conjugate)));
+    };
+    inline Quaternion Conjugated() const { return Quaternion(w, -x, -y, -z); }
+    inline Quaternion Normalized() const { return FromSIMD(NormalizeSIMD(ToSIMD())); };
+
+    inline Vec3 RotateVector(const Vec3& vector) const
+    {
+        Vec3 result;
+        SIMD::Store3(&result.x, RotateVectorSIMD(ToSIMD(), SIMD::Load3(&vector.x)));
+        return result;
     }
 
-    inline Quaternion Inversed() const { return Quaternion(glm::inverse(AsGLM())); };
-    inline Quaternion Conjugated() const { return Quaternion(glm::conjugate(AsGLM())); }
-    inline Quaternion Normalized() const { return Quaternion(glm::normalize(AsGLM())); };
+    static Quaternion Slerp(const Quaternion& a, const Quaternion& b, float t) { return FromSIMD(SlerpSIMD(a.ToSIMD(), b.ToSIMD(), t)); }
 
-    Vec3 RotateVector(const Vec3& vector) const;
+    /// @brief Normalized linear interpolation along the shortest path. Cheaper than Slerp and accurate enough for close rotations
+    static Quaternion NLerp(const Quaternion& a, const Quaternion& b, float t) { return FromSIMD(NLerpSIMD(a.ToSIMD(), b.ToSIMD(), t)); }
 
-    static Quaternion Slerp(const Quaternion& a, const Quaternion& b, float t) { return Quaternion(glm::slerp(a.AsGLM(), b.AsGLM(), t)); }
+    // ---- Batch operations. Results can alias the inputs
+    static void NormalizeBatch(Span<const Quaternion> quaternions, Span<Quaternion> results);
+    /// @brief results[i] = a[i] * b[i]
+    static void MultiplyBatch(Span<const Quaternion> a, Span<const Quaternion> b, Span<Quaternion> results);
+    static void SlerpBatch(Span<const Quaternion> a, Span<const Quaternion> b, float t, Span<Quaternion> results);
+    static void NLerpBatch(Span<const Quaternion> a, Span<const Quaternion> b, float t, Span<Quaternion> results);
 
     static const Quaternion Identity;
 };
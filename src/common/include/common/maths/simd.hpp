@@ -0,0 +1,331 @@
+#pragma once
+
+#include <assert.h>
+#include <bit>
+#include <cmath>
+#include <stdint.h>
+
+/// --------------------------
+/// Thin 4-wide float vector layer used by the math types' hot paths.
+/// Backed by SSE2 on x86, NEON on ARM64, and plain arrays elsewhere or when ALN_SIMD_FORCE_SCALAR is defined
+/// --------------------------
+
+#if defined(ALN_SIMD_FORCE_SCALAR)
+#define ALN_SIMD_SCALAR
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ALN_SIMD_SSE
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define ALN_SIMD_NEON
+#include <arm_neon.h>
+#else
+#define ALN_SIMD_SCALAR
+#endif
+
+namespace aln::SIMD
+{
+#if defined(ALN_SIMD_SSE)
+using Float4 = __m128;
+#elif defined(ALN_SIMD_NEON)
+using Float4 = float32x4_t;
+#else
+struct alignas(16) Float4
+{
+    float m_values[4];
+};
+#endif
+
+inline Float4 Set(float x, float y, float z, float w)
+{
+#if defined(ALN_SIMD_SSE)
+    return _mm_setr_ps(x, y, z, w);
+#elif defined(ALN_SIMD_NEON)
+    alignas(16) const float values[4] = {x, y, z, w};
+    return vld1q_f32(values);
+#else
+    return {{x, y, z, w}};
+#endif
+}
+
+inline Float4 Splat(float value)
+{
+#if defined(ALN_SIMD_SSE)
+    return _mm_set1_ps(value);
+#elif defined(ALN_SIMD_NEON)
+    return vdupq_n_f32(value);
+#else
+    return {{value, value, value, value}};
+#endif
+}
+
+inline Float4 Zero() { return Splat(0.0f); }
+
+/// @brief Load four floats from a 16 bytes aligned address
+inline Float4 Load(const float* pData)
+{
+    assert(((uintptr_t) pData & 15) == 0);
+#if defined(ALN_SIMD_SSE)
+    return _mm_load_ps(pData);
+#elif defined(ALN_SIMD_NEON)
+    return vld1q_f32(pData);
+#else
+    return {{pData[0], pData[1], pData[2], pData[3]}};
+#endif
+}
+
+/// @brief Load three floats, without reading past them. The last lane is set to 0
+inline Float4 Load3(const float* pData)
+{
+#if defined(ALN_SIMD_SSE)
+    const __m128 xy = _mm_castsi128_ps(_mm_loadl_epi64((const __m128i*) pData));
+    const __m128 z = _mm_load_ss(pData + 2);
+    return _mm_movelh_ps(xy, z);
+#elif defined(ALN_SIMD_NEON)
+    return vcombine_f32(vld1_f32(pData), vld1_lane_f32(pData + 2, vdup_n_f32(0.0f), 0));
+#else
+    return {{pData[0], pData[1], pData[2], 0.0f}};
+#endif
+}
+
+/// @brief Store four floats to a 16 bytes aligned address
+inline void Store(float* pData, Float4 v)
+{
+    assert(((uintptr_t) pData & 15) == 0);
+#if defined(ALN_SIMD_SSE)
+    _mm_store_ps(pData, v);
+#elif defined(ALN_SIMD_NEON)
+    vst1q_f32(pData, v);
+#else
+    for (auto i = 0; i < 4; ++i)
+    {
+        pData[i] = v.m_values[i];
+    }
+#endif
+}
+
+/// @brief Store the first three lanes, without writing past them
+inline void Store3(float* pData, Float4 v)
+{
+#if defined(ALN_SIMD_SSE)
+    _mm_storel_epi64((__m128i*) pData, _mm_castps_si128(v));
+    _mm_store_ss(pData + 2, _mm_movehl_ps(v, v));
+#elif defined(ALN_SIMD_NEON)
+    vst1_f32(pData, vget_low_f32(v));
+    vst1q_lane_f32(pData + 2, v, 2);
+#else
+    for (auto i = 0; i < 3; ++i)
+    {
+        pData[i] = v.m_values[i];
+    }
+#endif
+}
+
+inline float GetX(Float4 v)
+{
+#if defined(ALN_SIMD_SSE)
+    return _mm_cvtss_f32(v);
+#elif defined(ALN_SIMD_NEON)
+    return vgetq_lane_f32(v, 0);
+#else
+    return v.m_values[0];
+#endif
+}
+
+/// @brief Reorder the lanes of a vector. Result is (v[X], v[Y], v[Z], v[W])
+template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+inline Float4 Shuffle(Float4 v)
+{
+    static_assert(X < 4 && Y < 4 && Z < 4 && W < 4);
+#if defined(ALN_SIMD_SSE)
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(W, Z, Y, X));
+#elif defined(ALN_SIMD_NEON)
+    float32x4_t result = vdupq_n_f32(vgetq_lane_f32(v, X));
+    result = vsetq_lane_f32(vgetq_lane_f32(v, Y), result, 1);
+    result = vsetq_lane_f32(vgetq_lane_f32(v, Z), result, 2);
+    return vsetq_lane_f32(vgetq_lane_f32(v, W), result, 3);
+#else
+    return {{v.m_values[X], v.m_values[Y], v.m_values[Z], v.m_values[W]}};
+#endif
+}
+
+template <uint32_t Lane>
+inline Float4 SplatLane(Float4 v) { return Shuffle<Lane, Lane, Lane, Lane>(v); }
+
+#if defined(ALN_SIMD_SCALAR)
+namespace detail
+{
+template <typename TOperation>
+inline Float4 PerLane(Float4 a, Float4 b, TOperation operation)
+{
+    return {{operation(a.m_values[0], b.m_values[0]), operation(a.m_values[1], b.m_values[1]), operation(a.m_values[2], b.m_values[2]), operation(a.m_values[3], b.m_values[3])}};
+}
+} // namespace detail
+#endif
+
+inline Float4 Add(Float4 a, Float4 b)
+{
+#if defined(ALN_SIMD_SSE)
+    return _mm_add_ps(a, b);
+#elif defined(ALN_SIMD_NEON)
+    return vaddq_f32(a, b);
+#else
+    return detail::PerLane(a, b, [](float x, float y) { return x + y; });
+#endif
+}
+
+inline Float4 Sub(Float4 a, Float4 b)
+{
+#if defined(ALN_SIMD_SSE)
+    return _mm_sub_ps(a, b);
+#elif defined(ALN_SIMD_NEON)
+    return vsubq_f32(a, b);
+#else
+    return detail::PerLane(a, b, [](float x, float y) { return x - y; });
+#endif
+}
+
+inline Float4 Mul(Float4 a, Float4 b)
+{
+#if defined(ALN_SIMD_SSE)
+    return _mm_mul_ps(a, b);
+#elif defined(ALN_SIMD_NEON)
+    return vmulq_f32(a, b);
+#else
+    return detail::PerLane(a, b, [](float x, float y) { return x * y; });
+#endif
+}
+
+inline Float4 Div(Float4 a, Float4 b)
+{
+#if defined(ALN_SIMD_SSE)
+    return _mm_div_ps(a, b);
+#elif defined(ALN_SIMD_NEON)
+    return vdivq_f32(a, b);
+#else
+    return detail::PerLane(a, b, [](float x, float y) { return x / y; });
+#endif
+}
+
+/// @brief a * b + c
+inline Float4 MulAdd(Float4 a, Float4 b, Float4 c) { return Add(Mul(a, b), c); }
+
+inline Float4 Sqrt(Float4 v)
+{
+#if defined(ALN_SIMD_SSE)
+    return _mm_sqrt_ps(v);
+#elif defined(ALN_SIMD_NEON)
+    return vsqrtq_f32(v);
+#else
+    return {{std::sqrt(v.m_values[0]), std::sqrt(v.m_values[1]), std::sqrt(v.m_values[2]), std::sqrt(v.m_values[3])}};
+#endif
+}
+
+inline Float4 Abs(Float4 v)
+{
+#if defined(ALN_SIMD_SSE)
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+#elif defined(ALN_SIMD_NEON)
+    return vabsq_f32(v);
+#else
+    return {{std::abs(v.m_values[0]), std::abs(v.m_values[1]), std::abs(v.m_values[2]), std::abs(v.m_values[3])}};
+#endif
+}
+
+/// @brief Whether all lanes of a are strictly lower than the ones of b
+inline bool AllLess(Float4 a, Float4 b)
+{
+#if defined(ALN_SIMD_SSE)
+    return _mm_movemask_ps(_mm_cmplt_ps(a, b)) == 0xF;
+#elif defined(ALN_SIMD_NEON)
+    return vminvq_u32(vcltq_f32(a, b)) != 0;
+#else
+    return a.m_values[0] < b.m_values[0] && a.m_values[1] < b.m_values[1] && a.m_values[2] < b.m_values[2] && a.m_values[3] < b.m_values[3];
+#endif
+}
+
+/// @brief Whether all lanes of a and b are within eps of each other
+inline bool AllNearEqual(Float4 a, Float4 b, float eps) { return AllLess(Abs(Sub(a, b)), Splat(eps)); }
+
+/// @brief Linear interpolation between a and b by a t factor
+inline Float4 Lerp(Float4 a, Float4 b, Float4 t) { return MulAdd(Sub(b, a), t, a); }
+
+/// @brief Dot product of the first three lanes, in all lanes of the result
+inline Float4 Dot3(Float4 a, Float4 b)
+{
+    const Float4 product = Mul(a, b);
+    return Add(Add(SplatLane<0>(product), SplatLane<1>(product)), SplatLane<2>(product));
+}
+
+/// @brief Dot product of all four lanes, in all lanes of the result
+inline Float4 Dot4(Float4 a, Float4 b)
+{
+    const Float4 product = Mul(a, b);
+    const Float4 pairs = Add(product, Shuffle<1, 0, 3, 2>(product));
+    return Add(pairs, Shuffle<2, 3, 0, 1>(pairs));
+}
+
+/// @brief Cross product of the first three lanes. The last lane of the result is 0
+inline Float4 Cross3(Float4 a, Float4 b)
+{
+    const Float4 aYZX = Shuffle<1, 2, 0, 3>(a);
+    const Float4 bYZX = Shuffle<1, 2, 0, 3>(b);
+    const Float4 crossZXY = Sub(Mul(a, bYZX), Mul(aYZX, b));
+    return Shuffle<1, 2, 0, 3>(crossZXY);
+}
+
+/// @brief Lane-wise a <= b, as a mask with all bits set in the lanes where the comparison holds
+inline Float4 LessEqual(Float4 a, Float4 b)
+{
+#if defined(ALN_SIMD_SSE)
+    return _mm_cmple_ps(a, b);
+#elif defined(ALN_SIMD_NEON)
+    return vreinterpretq_f32_u32(vcleq_f32(a, b));
+#else
+    return detail::PerLane(a, b, [](float x, float y) { return std::bit_cast<float>(x <= y ? 0xFFFFFFFFu : 0u); });
+#endif
+}
+
+/// @brief Lanes of a where the mask is set, and of b elsewhere
+inline Float4 Select(Float4 mask, Float4 a, Float4 b)
+{
+#if defined(ALN_SIMD_SSE)
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+#elif defined(ALN_SIMD_NEON)
+    return vbslq_f32(vreinterpretq_u32_f32(mask), a, b);
+#else
+    Float4 result;
+    for (auto i = 0; i < 4; ++i)
+    {
+        result.m_values[i] = std::bit_cast<uint32_t>(mask.m_values[i]) != 0 ? a.m_values[i] : b.m_values[i];
+    }
+    return result;
+#endif
+}
+
+/// @brief Transpose the 4x4 matrix whose rows are r0 to r3.
+/// Switches four (x, y, z, w) vectors to the x, y, z and w components of the four vectors, and back
+inline void Transpose(Float4& r0, Float4& r1, Float4& r2, Float4& r3)
+{
+#if defined(ALN_SIMD_SSE)
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+#elif defined(ALN_SIMD_NEON)
+    const float32x4x2_t r01 = vtrnq_f32(r0, r1); // (a0, b0, a2, b2), (a1, b1, a3, b3)
+    const float32x4x2_t r23 = vtrnq_f32(r2, r3); // (c0, d0, c2, d2), (c1, d1, c3, d3)
+    r0 = vcombine_f32(vget_low_f32(r01.val[0]), vget_low_f32(r23.val[0]));
+    r1 = vcombine_f32(vget_low_f32(r01.val[1]), vget_low_f32(r23.val[1]));
+    r2 = vcombine_f32(vget_high_f32(r01.val[0]), vget_high_f32(r23.val[0]));
+    r3 = vcombine_f32(vget_high_f32(r01.val[1]), vget_high_f32(r23.val[1]));
+#else
+    Float4* rows[4] = {&r0, &r1, &r2, &r3};
+    for (auto row = 0; row < 4; ++row)
+    {
+        for (auto column = row + 1; column < 4; ++column)
+        {
+            const float value = rows[row]->m_values[column];
+            rows[row]->m_values[column] = rows[column]->m_values[row];
+            rows[column]->m_values[row] = value;
+        }
+    }
+#endif
+}
+} // namespace aln::SIMD
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "constants.hpp"
+#include "maths.hpp"
 #include "trig.hpp"
 
 #include <aln_common_export.h>
@@ -11,6 +12,8 @@
 #include <glm/gtx/norm.hpp>
 #include <glm/vec3.hpp>
 
+#include <cmath>
+
 namespace aln
 {
 
@@ -113,7 +116,10 @@ class ALN_COMMON_EXPORT Vec3
         return *this;
     }
 
-    inline bool IsNearEqual(const Vec3& other, float eps = Maths::Epsilon) const { return glm::all(glm::epsilonEqual(AsGLM(), other.AsGLM(), eps)); }
+    inline bool IsNearEqual(const Vec3& other, float eps = Maths::Epsilon) const
+    {
+        return Maths::Abs(x - other.x) < eps && Maths::Abs(y - other.y) < eps && Maths::Abs(z - other.z) < eps;
+    }
     inline bool IsNearZero(float eps = Maths::Epsilon) const { return IsNearEqual(Vec3::Zeroes); }
     bool operator==(const Vec3& other) const { return IsNearEqual(other); }
     bool operator!=(const Vec3& other) const { return !IsNearEqual(other); }
@@ -136,19 +142,19 @@ class ALN_COMMON_EXPORT Vec3
 
     Vec3 Scale(const Vec3& other) const { return *this * other; }
     Vec3 Translate(const Vec3& other) const { return *this + other; }
-    Vec3 Cross(const Vec3& other) const { return glm::cross(AsGLM(), other.AsGLM()); }
-    float Dot(const Vec3& other) const { return glm::dot(AsGLM(), other.AsGLM()); }
+    Vec3 Cross(const Vec3& other) const { return Vec3(y * other.z - z * other.y, z * other.x - x * other.z, x * other.y - y * other.x); }
+    float Dot(const Vec3& other) const { return x * other.x + y * other.y + z * other.z; }
 
     inline bool IsNormalized() const {return Maths::IsNearEqual(Magnitude(), 1.0); }
-    inline float Magnitude() const { return glm::length(AsGLM()); }
-    inline float SquaredMagnitude() const { return glm::length2(AsGLM()); }
-    inline Vec3 Sign() const { return glm::sign(AsGLM()); }
+    inline float Magnitude() const { return std::sqrt(SquaredMagnitude()); }
+    inline float SquaredMagnitude() const { return Dot(*this); }
+    inline Vec3 Sign() const { return Vec3(Maths::Sign(x), Maths::Sign(y), Maths::Sign(z)); }
 
-    inline Vec3 Normalized() const { return Vec3(glm::normalize(AsGLM())); }
+    inline Vec3 Normalized() const { return *this * (1.0f / Magnitude()); }
 
     /// @brief Linear interpolation between a and b by a t factor
-    inline static Vec3 Lerp(const Vec3& a, const Vec3& b, float t) { return glm::mix(a.AsGLM(), b.AsGLM(), t); }
-    inline static float Distance(const Vec3& a, const Vec3& b) { return glm::distance(a.AsGLM(), b.AsGLM()); }
+    inline static Vec3 Lerp(const Vec3& a, const Vec3& b, float t) { return a + (b - a) * t; }
+    inline static float Distance(const Vec3& a, const Vec3& b) { return (b - a).Magnitude(); }
     /// @brief Smallest angle between two vectors
     inline static Radians Angle(const Vec3& from, const Vec3& to)
     {
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "quaternion.hpp"
+#include "simd.hpp"
+#include "vec3.hpp"
+
+/// --------------------------
+/// Four vectors or quaternions in structure of arrays form, with one register per component.
+/// The batch kernels process four elements at a time with them, and the remaining ones with the single element SIMD path
+/// --------------------------
+
+namespace aln
+{
+struct WideVec3
+{
+    SIMD::Float4 x, y, z;
+
+    static WideVec3 Load(const Vec3& v0, const Vec3& v1, const Vec3& v2, const Vec3& v3)
+    {
+        WideVec3 result = {SIMD::Load3(&v0.x), SIMD::Load3(&v1.x), SIMD::Load3(&v2.x)};
+        auto row3 = SIMD::Load3(&v3.x);
+        SIMD::Transpose(result.x, result.y, result.z, row3);
+        return result;
+    }
+
+    void Store(Vec3& v0, Vec3& v1, Vec3& v2, Vec3& v3) const
+    {
+        auto row0 = x, row1 = y, row2 = z, row3 = SIMD::Zero();
+        SIMD::Transpose(row0, row1, row2, row3);
+        SIMD::Store3(&v0.x, row0);
+        SIMD::Store3(&v1.x, row1);
+        SIMD::Store3(&v2.x, row2);
+        SIMD::Store3(&v3.x, row3);
+    }
+
+    static WideVec3 Add(const WideVec3& a, const WideVec3& b) { return {SIMD::Add(a.x, b.x), SIMD::Add(a.y, b.y), SIMD::Add(a.z, b.z)}; }
+
+    /// @brief Component-wise product
+    static WideVec3 Mul(const WideVec3& a, const WideVec3& b) { return {SIMD::Mul(a.x, b.x), SIMD::Mul(a.y, b.y), SIMD::Mul(a.z, b.z)}; }
+
+    static WideVec3 Lerp(const WideVec3& a, const WideVec3& b, SIMD::Float4 t) { return {SIMD::Lerp(a.x, b.x, t), SIMD::Lerp(a.y, b.y, t), SIMD::Lerp(a.z, b.z, t)}; }
+
+    static WideVec3 Cross(const WideVec3& a, const WideVec3& b)
+    {
+        return {
+            SIMD::Sub(SIMD::Mul(a.y, b.z), SIMD::Mul(a.z, b.y)),
+            SIMD::Sub(SIMD::Mul(a.z, b.x), SIMD::Mul(a.x, b.z)),
+            SIMD::Sub(SIMD::Mul(a.x, b.y), SIMD::Mul(a.y, b.x)),
+        };
+    }
+};
+
+struct WideQuaternion
+{
+    SIMD::Float4 w, x, y, z;
+
+    static WideQuaternion Load(const Quaternion& q0, const Quaternion& q1, const Quaternion& q2, const Quaternion& q3)
+    {
+        WideQuaternion result = {q0.ToSIMD(), q1.ToSIMD(), q2.ToSIMD(), q3.ToSIMD()};
+        SIMD::Transpose(result.w, result.x, result.y, result.z);
+        return result;
+    }
+
+    void Store(Quaternion& q0, Quaternion& q1, Quaternion& q2, Quaternion& q3) const
+    {
+        auto row0 = w, row1 = x, row2 = y, row3 = z;
+        SIMD::Transpose(row0, row1, row2, row3);
+        q0.SetFromSIMD(row0);
+        q1.SetFromSIMD(row1);
+        q2.SetFromSIMD(row2);
+        q3.SetFromSIMD(row3);
+    }
+
+    static SIMD::Float4 Dot(const WideQuaternion& a, const WideQuaternion& b)
+    {
+        return SIMD::MulAdd(a.w, b.w, SIMD::MulAdd(a.x, b.x, SIMD::MulAdd(a.y, b.y, SIMD::Mul(a.z, b.z))));
+    }
+
+    /// @brief Hamilton product, a * b
+    static WideQuaternion Multiply(const WideQuaternion& a, const WideQuaternion& b)
+    {
+        return {
+            SIMD::Sub(SIMD::Sub(SIMD::Mul(a.w, b.w), SIMD::Mul(a.x, b.x)), SIMD::Add(SIMD::Mul(a.y, b.y), SIMD::Mul(a.z, b.z))),
+            SIMD::Add(SIMD::Add(SIMD::Mul(a.w, b.x), SIMD::Mul(a.x, b.w)), SIMD::Sub(SIMD::Mul(a.y, b.z), SIMD::Mul(a.z, b.y))),
+            SIMD::Add(SIMD::Sub(SIMD::Mul(a.w, b.y), SIMD::Mul(a.x, b.z)), SIMD::Add(SIMD::Mul(a.y, b.w), SIMD::Mul(a.z, b.x))),
+            SIMD::Add(SIMD::Add(SIMD::Mul(a.w, b.z), SIMD::Mul(a.x, b.y)), SIMD::Sub(SIMD::Mul(a.z, b.w), SIMD::Mul(a.y, b.x))),
+        };
+    }
+
+    /// @brief Null quaternions normalize to the identity, as with the single element path
+    static WideQuaternion Normalize(const WideQuaternion& q)
+    {
+        const auto squaredLength = Dot(q, q);
+        const auto length = SIMD::Sqrt(squaredLength);
+        const auto isNull = SIMD::LessEqual(squaredLength, SIMD::Zero());
+        return {
+            SIMD::Select(isNull, SIMD::Splat(1.0f), SIMD::Div(q.w, length)),
+            SIMD::Select(isNull, SIMD::Zero(), SIMD::Div(q.x, length)),
+            SIMD::Select(isNull, SIMD::Zero(), SIMD::Div(q.y, length)),
+            SIMD::Select(isNull, SIMD::Zero(), SIMD::Div(q.z, length)),
+        };
+    }
+
+    /// @brief Rotate vectors by unit quaternions
+    static WideVec3 RotateVector(const WideQuaternion& q, const WideVec3& vector)
+    {
+        // v' = v + w * t + cross(q.xyz, t), with t = 2 * cross(q.xyz, v)
+        const WideVec3 axis = {q.x, q.y, q.z};
+        const auto two = SIMD::Splat(2.0f);
+        auto t = WideVec3::Cross(axis, vector);
+        t = {SIMD::Mul(t.x, two), SIMD::Mul(t.y, two), SIMD::Mul(t.z, two)};
+        const auto cross = WideVec3::Cross(axis, t);
+        return {
+            SIMD::Add(SIMD::MulAdd(q.w, t.x, vector.x), cross.x),
+            SIMD::Add(SIMD::MulAdd(q.w, t.y, vector.y), cross.y),
+            SIMD::Add(SIMD::MulAdd(q.w, t.z, vector.z), cross.z),
+        };
+    }
+
+    /// @brief a * weightA + b * weightB, per lane
+    static WideQuaternion Blend(const WideQuaternion& a, SIMD::Float4 weightA, const WideQuaternion& b, SIMD::Float4 weightB)
+    {
+        return {
+            SIMD::MulAdd(a.w, weightA, SIMD::Mul(b.w, weightB)),
+            SIMD::MulAdd(a.x, weightA, SIMD::Mul(b.x, weightB)),
+            SIMD::MulAdd(a.y, weightA, SIMD::Mul(b.y, weightB)),
+            SIMD::MulAdd(a.z, weightA, SIMD::Mul(b.z, weightB)),
+        };
+    }
+
+    /// @brief Only the angles and their sines are computed one lane at a time
+    static WideQuaternion Slerp(const WideQuaternion& a, const WideQuaternion& b, float t)
+    {
+        alignas(16) float cosThetas[4];
+        alignas(16) float weightsA[4];
+        alignas(16) float weightsB[4];
+        SIMD::Store(cosThetas, Dot(a, b));
+        for (auto lane = 0; lane < 4; ++lane)
+        {
+            Quaternion::GetSlerpWeights(cosThetas[lane], t, weightsA[lane], weightsB[lane]);
+        }
+        return Blend(a, SIMD::Load(weightsA), b, SIMD::Load(weightsB));
+    }
+
+    static WideQuaternion NLerp(const WideQuaternion& a, const WideQuaternion& b, float t)
+    {
+        // Take the shortest path
+        const auto isSameHemisphere = SIMD::LessEqual(SIMD::Zero(), Dot(a, b));
+        const auto weightB = SIMD::Select(isSameHemisphere, SIMD::Splat(t), SIMD::Splat(-t));
+        return Normalize(Blend(a, SIMD::Splat(1.0f - t), b, weightB));
+    }
+};
+} // namespace aln
@@ -1,45 +1,40 @@
 #pragma once
 
+#include <aln_common_export.h>
+
 #include <assert.h>
 #include <cstdlib>
-#include <malloc.h>
 #include <memory>
-
-#ifdef ALN_DEBUG
-#include <tracy/Tracy.hpp>
-#endif
+#include <stdint.h>
 
 namespace aln
 {
-
-inline void* Allocate(size_t size, size_t alignment = 8)
+/// @brief Category an allocation is attributed to in the memory statistics
+enum class MemoryTag : uint8_t
 {
-    auto ptr = _aligned_malloc(size, alignment);
-#ifdef ALN_DEBUG
-    TracyAllocS(ptr, size, 15);
-#endif
-    return ptr;
-}
+    General,
+    Animation,
+    Entities,
+    Assets,
+    Render,
 
-inline void Free(void* ptr)
-{
-#ifdef ALN_DEBUG
-    TracyFreeS(ptr, 15);
-#endif
-    _aligned_free(ptr);
-}
+    Count,
+};
+
+/// @brief Allocate memory. Small allocations are served from a per-thread cache, larger ones go to the system heap.
+/// The allocation is attributed to the current thread's memory tag (see MemoryTagScope)
+ALN_COMMON_EXPORT void* Allocate(size_t size, size_t alignment = 8);
+
+/// @brief Allocate memory attributed to a specific tag
+ALN_COMMON_EXPORT void* Allocate(size_t size, size_t alignment, MemoryTag tag);
+
+/// @brief Free memory obtained from aln::Allocate. Memory can be freed from any thread
+ALN_COMMON_EXPORT void Free(void* ptr);
 
 #ifdef ALN_DEBUG
 // Simple version with no marking to be used by external libraries
-inline void* AllocateUnmarked(size_t size, size_t alignment = 8)
-{
-    return _aligned_malloc(size, alignment);
-}
-
-inline void FreeUnmarked(void* ptr)
-{
-    _aligned_free(ptr);
-}
+ALN_COMMON_EXPORT void* AllocateUnmarked(size_t size, size_t alignment = 8);
+ALN_COMMON_EXPORT void FreeUnmarked(void* ptr);
 #endif
 
 template <typename T, typename... ConstructorParameters>
@@ -62,4 +57,42 @@ inline void Delete(T*& ptr) noexcept
     ptr->~T();
     Free(ptr);
 }
-} // namespace aln
\ No newline at end of file
+
+/// @brief Attribute all the allocations made by the current thread to a tag for the lifetime of the scope.
+/// Scopes can be nested, the innermost one wins.
+class ALN_COMMON_EXPORT MemoryTagScope
+{
+  private:
+    MemoryTag m_previousTag;
+
+  public:
+    MemoryTagScope(MemoryTag tag);
+    ~MemoryTagScope();
+
+    MemoryTagScope(const MemoryTagScope&) = delete;
+    MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+};
+
+/// @brief Snapshot of the allocation counters of a memory tag
+struct MemoryTagStats
+{
+    int64_t m_liveBytes = 0;           // Bytes currently allocated
+    int64_t m_liveAllocationCount = 0; // Allocations not freed yet
+    int64_t m_highWaterMark = 0;       // Highest value reached by m_liveBytes
+    int64_t m_frameAllocationCount = 0; // Allocations made since the beginning of the frame
+    int64_t m_totalAllocationCount = 0; // Allocations made since the application started
+};
+
+namespace Memory
+{
+ALN_COMMON_EXPORT MemoryTagStats GetTagStats(MemoryTag tag);
+ALN_COMMON_EXPORT const char* GetTagName(MemoryTag tag);
+
+/// @brief Bytes reserved from the system for the per-thread caches
+ALN_COMMON_EXPORT size_t GetCachedHeapReservedBytes();
+
+/// @brief Mark a frame boundary: reset the per-frame allocation counters and the frame arena.
+/// Memory obtained from the frame arena during the previous frame must not be used anymore
+ALN_COMMON_EXPORT void BeginFrame();
+} // namespace Memory
+} // namespace aln
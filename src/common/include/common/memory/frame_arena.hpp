@@ -0,0 +1,100 @@
+#pragma once
+
+#include "../memory.hpp"
+
+#include <aln_common_export.h>
+
+#include <atomic>
+#include <mutex>
+#include <stddef.h>
+
+namespace aln
+{
+/// @brief Linear allocator for transient, frame-lifetime data. Allocating is a single atomic increment, and memory is never freed
+/// individually: the whole arena is reset at frame boundaries (see Memory::BeginFrame).
+/// When the arena is full, allocations fall back to the general heap and are released on reset.
+/// @note Thread safe
+class ALN_COMMON_EXPORT FrameArena
+{
+  private:
+    struct OverflowAllocation
+    {
+        OverflowAllocation* m_pNext;
+    };
+
+    std::byte* m_pBuffer = nullptr;
+    size_t m_capacity = 0;
+    std::atomic<size_t> m_offset = 0;
+    size_t m_highWaterMark = 0;
+
+    std::mutex m_overflowMutex;
+    OverflowAllocation* m_pOverflowAllocations = nullptr;
+    size_t m_overflowBytes = 0;
+
+  public:
+    static constexpr size_t DefaultCapacity = 8 * 1024 * 1024;
+
+    FrameArena(size_t capacity = DefaultCapacity);
+    ~FrameArena();
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    void* Allocate(size_t size, size_t alignment = 8);
+
+    /// @brief Construct an object in the arena. Its destructor will never be called
+    template <typename T, typename... ConstructorParameters>
+    T* New(ConstructorParameters&&... params)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Frame arena objects are never destroyed");
+        return aln::PlacementNew<T>(Allocate(sizeof(T), alignof(T)), std::forward<ConstructorParameters>(params)...);
+    }
+
+    /// @brief Release all the memory allocated since the last reset
+    /// @note Not thread safe: no other thread should allocate from the arena while it is being reset
+    void Reset();
+
+    size_t GetCapacity() const { return m_capacity; }
+    size_t GetUsedBytes() const { return m_offset.load(std::memory_order_relaxed); }
+    size_t GetOverflowBytes() const { return m_overflowBytes; }
+
+    /// @brief Highest number of bytes used in a single frame, overflow included
+    size_t GetHighWaterMark() const { return m_highWaterMark; }
+};
+
+/// @brief EASTL-compatible allocator for containers whose content only lives for the current frame
+class FrameArenaAllocator
+{
+  private:
+    FrameArena* m_pArena;
+
+  public:
+    FrameArenaAllocator(const char* pName = nullptr);
+    FrameArenaAllocator(const FrameArenaAllocator& other) : m_pArena(other.m_pArena) {}
+    FrameArenaAllocator(const FrameArenaAllocator& other, const char* pName) : m_pArena(other.m_pArena) {}
+
+    FrameArenaAllocator& operator=(const FrameArenaAllocator& other)
+    {
+        m_pArena = other.m_pArena;
+        return *this;
+    }
+
+    void* allocate(size_t n, int flags = 0) { return m_pArena->Allocate(n, 8); }
+    void* allocate(size_t n, size_t alignment, size_t offset, int flags = 0) { return m_pArena->Allocate(n, alignment); }
+    void deallocate(void* p, size_t n) {}
+
+    const char* get_name() const { return "FrameArena"; }
+    void set_name(const char* pName) {}
+
+    bool operator==(const FrameArenaAllocator& other) const { return m_pArena == other.m_pArena; }
+    bool operator!=(const FrameArenaAllocator& other) const { return m_pArena != other.m_pArena; }
+};
+
+namespace Memory
+{
+/// @brief The engine's frame arena, reset by Memory::BeginFrame
+ALN_COMMON_EXPORT FrameArena& GetFrameArena();
+} // namespace Memory
+
+inline FrameArenaAllocator::FrameArenaAllocator(const char* pName) : m_pArena(&Memory::GetFrameArena()) {}
+} // namespace aln
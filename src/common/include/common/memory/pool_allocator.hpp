@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../containers/vector.hpp"
+#include "../memory.hpp"
+
+#include <assert.h>
+#include <stddef.h>
+
+namespace aln
+{
+/// @brief Pool of fixed-size slots for objects of a single type. Slots are allocated in chunks and recycled through a free list,
+/// so creating and destroying objects does not hit the general heap.
+/// @note Not thread safe
+template <typename T, size_t SlotsPerChunk = 64>
+class PoolAllocator
+{
+  private:
+    union Slot
+    {
+        Slot* m_pNext;
+        alignas(T) std::byte m_storage[sizeof(T)];
+    };
+
+    Vector<Slot*> m_chunks;
+    Slot* m_pFreeList = nullptr;
+    size_t m_liveCount = 0;
+    MemoryTag m_tag;
+
+    void AllocateChunk()
+    {
+        auto pChunk = (Slot*) aln::Allocate(sizeof(Slot) * SlotsPerChunk, alignof(Slot), m_tag);
+        for (size_t slotIndex = 0; slotIndex < SlotsPerChunk; ++slotIndex)
+        {
+            pChunk[slotIndex].m_pNext = (slotIndex + 1 < SlotsPerChunk) ? &pChunk[slotIndex + 1] : m_pFreeList;
+        }
+        m_pFreeList = pChunk;
+        m_chunks.push_back(pChunk);
+    }
+
+  public:
+    PoolAllocator(MemoryTag tag = MemoryTag::General) : m_tag(tag) {}
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+    ~PoolAllocator()
+    {
+        assert(m_liveCount == 0);
+        for (auto pChunk : m_chunks)
+        {
+            aln::Free(pChunk);
+        }
+    }
+
+    template <typename... ConstructorParameters>
+    T* New(ConstructorParameters&&... params)
+    {
+        if (m_pFreeList == nullptr)
+        {
+            AllocateChunk();
+        }
+
+        auto pSlot = m_pFreeList;
+        m_pFreeList = pSlot->m_pNext;
+        m_liveCount++;
+
+        return aln::PlacementNew<T>(pSlot->m_storage, std::forward<ConstructorParameters>(params)...);
+    }
+
+    void Delete(T*& pObject)
+    {
+        assert(pObject != nullptr && m_liveCount > 0);
+        pObject->~T();
+
+        auto pSlot = reinterpret_cast<Slot*>(pObject);
+        pSlot->m_pNext = m_pFreeList;
+        m_pFreeList = pSlot;
+        m_liveCount--;
+
+        pObject = nullptr;
+    }
+
+    size_t GetLiveCount() const { return m_liveCount; }
+    size_t GetCapacity() const { return m_chunks.size() * SlotsPerChunk; }
+};
+} // namespace aln
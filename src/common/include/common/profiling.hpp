@@ -0,0 +1,143 @@
+#pragma once
+
+#include "event.hpp"
+#include "update_stages.hpp"
+
+#include <common/containers/vector.hpp>
+
+#include <aln_common_export.h>
+
+#include <ostream>
+#include <stdint.h>
+
+namespace aln
+{
+/// @brief What a profiled scope measures. Statistics are aggregated per (category, name)
+enum class ProfileCategory : uint8_t
+{
+    Frame,
+    UpdateStage,
+    EntitySystem,
+    WorldSystem,
+    AssetLoader,
+    RenderPass,
+    Custom,
+    Counter, // Not a timer: values are summed over the frame
+
+    Count,
+};
+
+/// @brief Aggregated statistics of a scope or counter over the rolling window.
+/// Values are in milliseconds for timers, and sums of the recorded values for counters
+struct ProfileScopeStats
+{
+    const char* m_name = nullptr;
+    ProfileCategory m_category = ProfileCategory::Custom;
+
+    float m_lastFrameValue = 0.0f; // Sum over the last frame
+    uint32_t m_lastFrameCallCount = 0;
+    float m_average = 0.0f;
+    float m_p50 = 0.0f;
+    float m_p95 = 0.0f;
+    float m_p99 = 0.0f;
+    float m_max = 0.0f;
+    uint64_t m_totalCallCount = 0;
+};
+
+/// @brief Fired at the end of a frame for every scope whose frame total went over its budget
+struct ProfileBudgetExceededInfo
+{
+    const char* m_name = nullptr;
+    ProfileCategory m_category = ProfileCategory::Custom;
+    float m_budgetMs = 0.0f;
+    float m_frameTimeMs = 0.0f;
+    uint64_t m_frameIdx = 0;
+};
+
+namespace Profiling
+{
+/// @brief Number of frames the percentiles are computed over
+constexpr uint32_t RollingWindowFrameCount = 128;
+
+/// @brief Number of samples each thread can record before the aggregation drains them. Samples past that are dropped and counted
+constexpr uint32_t ThreadBufferCapacity = 4096;
+
+/// @brief Current time in nanoseconds, from a monotonic clock
+ALN_COMMON_EXPORT int64_t GetTimestamp();
+
+/// @brief Push a finished timer sample to the calling thread's buffer. Lock-free.
+/// @param name: Must outlive the profiler (string literal, reflected type name...)
+ALN_COMMON_EXPORT void RecordScope(const char* name, ProfileCategory category, int64_t startTimestamp, int64_t endTimestamp);
+
+/// @brief Add to a counter for this frame. Lock-free.
+/// @param name: Must outlive the profiler (string literal, reflected type name...)
+ALN_COMMON_EXPORT void IncrementCounter(const char* name, int64_t value = 1);
+
+ALN_COMMON_EXPORT void SetEnabled(bool enabled);
+ALN_COMMON_EXPORT bool IsEnabled();
+
+/// @brief Mark the beginning of a frame
+ALN_COMMON_EXPORT void BeginFrame();
+
+/// @brief Mark the end of a frame: drain every thread's buffer, update the rolling statistics and check budgets.
+/// Must be called from the thread that owns the frame loop, while no other thread records samples for this frame
+ALN_COMMON_EXPORT void EndFrame();
+
+/// @brief Set the per-frame budget of a scope, in milliseconds. A budget of 0 removes it
+ALN_COMMON_EXPORT void SetBudget(const char* name, ProfileCategory category, float budgetMs);
+
+/// @brief Event fired from EndFrame when a scope exceeded its budget
+ALN_COMMON_EXPORT Event<const ProfileBudgetExceededInfo&>& GetBudgetExceededEvent();
+
+/// @brief Statistics of every scope recorded so far. Only call from the frame loop thread
+ALN_COMMON_EXPORT Vector<ProfileScopeStats> GetScopeStats();
+
+/// @brief Samples lost because a thread buffer was full since the application started
+ALN_COMMON_EXPORT uint64_t GetDroppedSampleCount();
+
+/// @brief Dump the current statistics as CSV, one line per scope
+ALN_COMMON_EXPORT void WriteCSV(std::ostream& stream);
+
+/// @brief Dump the current statistics as a JSON object
+ALN_COMMON_EXPORT void WriteJSON(std::ostream& stream);
+
+ALN_COMMON_EXPORT const char* GetCategoryName(ProfileCategory category);
+ALN_COMMON_EXPORT const char* GetUpdateStageName(UpdateStage stage);
+} // namespace Profiling
+
+/// @brief Time the enclosing scope
+class ProfileScope
+{
+  private:
+    const char* m_name;
+    ProfileCategory m_category;
+    int64_t m_startTimestamp = 0;
+
+  public:
+    ProfileScope(const char* name, ProfileCategory category = ProfileCategory::Custom)
+        : m_name(name), m_category(category)
+    {
+        if (Profiling::IsEnabled())
+        {
+            m_startTimestamp = Profiling::GetTimestamp();
+        }
+    }
+
+    ~ProfileScope()
+    {
+        if (m_startTimestamp != 0)
+        {
+            Profiling::RecordScope(m_name, m_category, m_startTimestamp, Profiling::GetTimestamp());
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+#define ALN_PROFILE_CONCAT_INNER(a, b) a##b
+#define ALN_PROFILE_CONCAT(a, b) ALN_PROFILE_CONCAT_INNER(a, b)
+
+/// @brief Time the enclosing scope under the given name and category
+#define ALN_PROFILE_SCOPE(name, category) aln::ProfileScope ALN_PROFILE_CONCAT(aln_profileScope_, __LINE__)(name, category)
+} // namespace aln
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <aln_common_export.h>
+
+#include <EASTL/functional.h>
+
+#include <assert.h>
+#include <atomic>
+#include <stdint.h>
+#include <string>
+
+namespace aln
+{
+/// @brief Lock-free allocator of 64-bit runtime handles, made of a slot index and a generation counter.
+/// Released slots are recycled with an incremented generation, so that stale handles can be detected.
+/// @note Slots are stored in lazily allocated blocks that are only freed along with the pool, which keeps concurrent reads safe.
+/// Slots are trivially destructible.
+class ALN_COMMON_EXPORT RuntimeIDPool
+{
+  public:
+    static constexpr uint64_t InvalidValue = UINT64_MAX;
+
+  private:
+    static constexpr uint32_t BlockSize = 4096;
+    static constexpr uint32_t MaxBlockCount = 4096;
+    static constexpr uint32_t EmptyFreeList = UINT32_MAX;
+
+    struct Slot
+    {
+        std::atomic<uint32_t> m_generation = 0;
+        std::atomic<uint32_t> m_nextFreeIndex = EmptyFreeList;
+    };
+
+    std::atomic<Slot*> m_blocks[MaxBlockCount] = {};
+    std::atomic<uint32_t> m_nextUnusedIndex = 0;
+
+    // Free list head. The index is stored in the low bits, and a tag incremented with each update in the high bits to prevent ABA issues
+    std::atomic<uint64_t> m_freeListHead = EmptyFreeList;
+
+    Slot& GetSlot(uint32_t index);
+
+  public:
+    RuntimeIDPool() = default;
+    RuntimeIDPool(const RuntimeIDPool&) = delete;
+    ~RuntimeIDPool();
+
+    uint64_t Allocate();
+    void Release(uint64_t value);
+
+    /// @brief Whether a handle's slot has not been released since it was allocated
+    bool IsAlive(uint64_t value);
+
+    static uint32_t GetIndex(uint64_t value) { return (uint32_t) value; }
+    static uint32_t GetGeneration(uint64_t value) { return (uint32_t) (value >> 32); }
+    static uint64_t MakeValue(uint32_t index, uint32_t generation) { return ((uint64_t) generation << 32) | index; }
+};
+
+/// @brief Compact runtime identifier, allocated from the pool of its tag type.
+/// Runtime IDs are only valid during the execution. Use UUIDs for persistent identifiers.
+/// @tparam Tag: Type providing the ID pool with a static `RuntimeIDPool& GetIDPool()` function.
+/// The pool should be defined in a single translation unit, so that it is shared across modules.
+template <typename Tag>
+class RuntimeID
+{
+  private:
+    uint64_t m_value = RuntimeIDPool::InvalidValue;
+
+    explicit RuntimeID(uint64_t value) : m_value(value) {}
+
+  public:
+    /// @brief Default construct an invalid id
+    RuntimeID() = default;
+
+    static RuntimeID Generate() { return RuntimeID(Tag::GetIDPool().Allocate()); }
+
+    /// @brief Return an id to the pool. Copies of the id will not be alive anymore
+    static void Release(const RuntimeID& id)
+    {
+        assert(id.IsValid());
+        Tag::GetIDPool().Release(id.m_value);
+    }
+
+    inline bool IsValid() const { return m_value != RuntimeIDPool::InvalidValue; }
+    inline bool IsAlive() const { return IsValid() && Tag::GetIDPool().IsAlive(m_value); }
+
+    inline uint64_t GetValue() const { return m_value; }
+    inline uint32_t GetIndex() const { return RuntimeIDPool::GetIndex(m_value); }
+    inline uint32_t GetGeneration() const { return RuntimeIDPool::GetGeneration(m_value); }
+
+    std::string ToString() const { return IsValid() ? std::to_string(GetIndex()) + ":" + std::to_string(GetGeneration()) : "Invalid ID"; }
+
+    inline bool operator==(const RuntimeID& other) const { return m_value == other.m_value; }
+    inline bool operator!=(const RuntimeID& other) const { return m_value != other.m_value; }
+    inline bool operator<(const RuntimeID& other) const { return m_value < other.m_value; }
+};
+} // namespace aln
+
+namespace eastl
+{
+template <typename Tag>
+struct hash<aln::RuntimeID<Tag>>
+{
+    size_t operator()(const aln::RuntimeID<Tag>& id) const { return eastl::hash<uint64_t>{}(id.GetValue()); }
+};
+} // namespace eastl
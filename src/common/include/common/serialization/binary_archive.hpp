@@ -3,8 +3,10 @@
 #include "../memory.hpp"
 #include "../containers/vector.hpp"
 
+#include <algorithm>
 #include <assert.h>
 #include <concepts>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 
@@ -18,7 +20,14 @@ class BinaryMemoryArchive;
 class BinaryFileArchive;
 
 template <typename T>
-concept TriviallyCopyableType = std::is_trivially_copyable_v<T>;
+concept CustomSerializable = requires(T a, BinaryMemoryArchive archive) {
+                                 a.Serialize<BinaryMemoryArchive>(archive);
+                                 a.Deserialize<BinaryMemoryArchive>(archive);
+                             };
+
+/// @brief Types serialized as raw bytes. Custom serialization takes precedence, so that trivially copyable types can still control their on-disk format
+template <typename T>
+concept TriviallyCopyableType = std::is_trivially_copyable_v<T> && !CustomSerializable<T>;
 
 template <typename T>
 concept ContiguousContainer = requires(T a) {
@@ -44,19 +53,13 @@ struct ArchiveAccess
     }
 };
 
-template <typename T>
-concept CustomSerializable = requires(T a, BinaryMemoryArchive archive) {
-                                 a.Serialize<BinaryMemoryArchive>(archive);
-                                 a.Deserialize<BinaryMemoryArchive>(archive);
-                             };
-
 template <typename T>
 concept Serializable = TriviallyCopyableType<T> || CustomSerializable<T>;
 
 /// @brief Base class for binary archives
 /// @note Supports IO operations for trivially copyable types and contiguous containers of trivially copyable types.
 /// "Recursive" containers are also supported
-/// @todo Handle state flags such as EoF or fail to signal user when something goes wrong
+/// @todo Memory archives do not detect reads past their end yet
 class IBinaryArchive
 {
   public:
@@ -78,88 +81,80 @@ class IBinaryArchive
 };
 
 /// @brief A binary file archive to write to or read from
+/// @note IO goes through a large staging buffer, so that serializing many small fields does not translate into as many stream calls.
+/// Reads and writes larger than the buffer bypass it.
 class BinaryFileArchive : public IBinaryArchive
 {
   private:
+    static constexpr size_t BufferSize = 256 * 1024;
+
     void* m_pFileStream = nullptr;
-    const std::filesystem::path& m_path;
+    std::filesystem::path m_path;
+
+    std::byte* m_pBuffer = nullptr;
+    size_t m_bufferPosition = 0;   // Read/Write cursor in the buffer
+    size_t m_bufferSize = 0;       // Number of valid bytes in the buffer (read mode only)
+    bool m_hasReadPastEnd = false; // A read asked for more bytes than the file had left (read mode only)
+
+    /// @brief Write the content of the buffer to the file
+    void FlushBuffer();
+
+    /// @brief Reserve space for a size field to be patched once the following block has been written
+    /// @return Position of the size field in the file
+    size_t BeginSizedBlock();
+
+    /// @brief Write the size of the block started at blockStartPosition
+    void EndSizedBlock(size_t blockStartPosition);
 
   public:
     BinaryFileArchive(BinaryFileArchive&) = delete;
-    BinaryFileArchive(const std::filesystem::path& path, IOMode mode) : IBinaryArchive(mode), m_path(path)
-    {
-        if (IsReading())
-        {
-            auto pFileStream = aln::New<std::ifstream>();
-            pFileStream->open(path.string(), std::ios::binary | std::ios::in);
-            m_pFileStream = pFileStream;
-        }
-        else
-        {
-            auto pFileStream = aln::New<std::ofstream>();
-            pFileStream->open(path.string(), std::ios::binary | std::ios::out);
-            m_pFileStream = pFileStream;
-        }
-    }
+    BinaryFileArchive(const std::filesystem::path& path, IOMode mode);
+    ~BinaryFileArchive();
 
-    ~BinaryFileArchive()
-    {
-        assert(m_pFileStream != nullptr);
+    /// @return false if some of the data could not be written to the file (write mode), or a read went past its end (read mode)
+    bool Close();
 
-        if (IsReading())
-        {
-            auto pFileStream = reinterpret_cast<std::ifstream*>(m_pFileStream);
-            aln::Delete(pFileStream);
-        }
-        else
-        {
-            auto pFileStream = reinterpret_cast<std::ofstream*>(m_pFileStream);
-            aln::Delete(pFileStream);
-        }
-    }
+    /// @brief Whether the file is open and, when reading, no read went past its end.
+    /// Check it once deserialization is done: reads past the end fill the destination with zeros instead of failing
+    bool IsValid() const override;
 
-    void Close()
+    void Write(const void* pData, size_t size)
     {
-        assert(m_pFileStream != nullptr);
-        if (IsReading())
+        assert(IsWriting());
+        if (m_bufferPosition + size <= BufferSize)
         {
-            auto pFileStream = reinterpret_cast<std::ifstream*>(m_pFileStream);
-            pFileStream->close();
+            memcpy(m_pBuffer + m_bufferPosition, pData, size);
+            m_bufferPosition += size;
         }
         else
         {
-            auto pFileStream = reinterpret_cast<std::ofstream*>(m_pFileStream);
-            pFileStream->close();
+            WriteUnbuffered(pData, size);
         }
     }
 
-    bool IsValid() const override
+    void Read(void* pData, size_t size)
     {
-        if (IsReading())
+        assert(IsReading());
+        if (m_bufferPosition + size <= m_bufferSize)
         {
-            auto pFileStream = reinterpret_cast<std::ifstream*>(m_pFileStream);
-            return pFileStream->is_open();
+            memcpy(pData, m_pBuffer + m_bufferPosition, size);
+            m_bufferPosition += size;
         }
         else
         {
-            auto pFileStream = reinterpret_cast<std::ofstream*>(m_pFileStream);
-            return pFileStream->is_open();
+            ReadUnbuffered(pData, size);
         }
     }
 
-    void Write(const void* pData, size_t size)
-    {
-        assert(IsWriting());
-        auto pFileStream = reinterpret_cast<std::ofstream*>(m_pFileStream);
-        pFileStream->write(reinterpret_cast<const char*>(pData), size);
-    }
+    /// @brief Slow paths of Write/Read, when the request does not fit in the buffer
+    void WriteUnbuffered(const void* pData, size_t size);
+    void ReadUnbuffered(void* pData, size_t size);
 
-    void Read(void* pData, size_t size)
-    {
-        assert(IsReading());
-        auto pFileStream = reinterpret_cast<std::ifstream*>(m_pFileStream);
-        pFileStream->read(reinterpret_cast<char*>(pData), size);
-    }
+    /// @brief Stream a block of data to the file, without staging it in an intermediate byte vector.
+    /// The block is prefixed by its size, and can be read back as a Vector<std::byte>
+    /// @param serializeFunction: Function writing the block's content, called with a memory archive that flushes to this file
+    template <typename Function>
+    BinaryFileArchive& WriteBlock(Function&& serializeFunction);
 
     // --------------------------
     //  Trivially copyable types
@@ -167,22 +162,14 @@ class BinaryFileArchive : public IBinaryArchive
     template <TriviallyCopyableType T>
     BinaryFileArchive& operator<<(const T& data)
     {
-        assert(IsWriting());
-
-        auto pFileStream = reinterpret_cast<std::ofstream*>(m_pFileStream);
-        pFileStream->write(reinterpret_cast<const char*>(&data), sizeof(T));
-
+        Write(&data, sizeof(T));
         return *this;
     }
 
     template <TriviallyCopyableType T>
     BinaryFileArchive& operator>>(T& data)
     {
-        assert(IsReading());
-
-        auto pFileStream = reinterpret_cast<std::ifstream*>(m_pFileStream);
-        pFileStream->read(reinterpret_cast<char*>(&data), sizeof(T));
-
+        Read(&data, sizeof(T));
         return *this;
     }
 
@@ -192,11 +179,8 @@ class BinaryFileArchive : public IBinaryArchive
     template <ContiguousContainer T>
     BinaryFileArchive& operator<<(const T& container)
     {
-        assert(IsWriting());
-        auto pFileStream = reinterpret_cast<std::ofstream*>(m_pFileStream);
-
-        auto size = container.size();
-        pFileStream->write(reinterpret_cast<const char*>(&size), sizeof(T::size_type));
+        typename T::size_type size = container.size();
+        Write(&size, sizeof(T::size_type));
         for (const auto& item : container)
         {
             *this << item;
@@ -208,11 +192,8 @@ class BinaryFileArchive : public IBinaryArchive
     template <ContiguousContainer T>
     BinaryFileArchive& operator>>(T& container)
     {
-        assert(IsReading());
-        auto pFileStream = reinterpret_cast<std::ifstream*>(m_pFileStream);
-
         typename T::size_type size;
-        pFileStream->read(reinterpret_cast<char*>(&size), sizeof(T::size_type));
+        Read(&size, sizeof(T::size_type));
 
         container.resize(size);
         for (auto i = 0; i < size; ++i)
@@ -227,12 +208,9 @@ class BinaryFileArchive : public IBinaryArchive
         requires ContiguousContainer<T> && TriviallyCopyableType<typename T::value_type>
     BinaryFileArchive& operator<<(const T& container)
     {
-        assert(IsWriting());
-        auto pFileStream = reinterpret_cast<std::ofstream*>(m_pFileStream);
-
-        auto size = container.size();
-        pFileStream->write(reinterpret_cast<const char*>(&size), sizeof(T::size_type));
-        pFileStream->write(reinterpret_cast<const char*>(container.data()), size * sizeof(T::value_type));
+        typename T::size_type size = container.size();
+        Write(&size, sizeof(T::size_type));
+        Write(container.data(), size * sizeof(T::value_type));
 
         return *this;
     }
@@ -241,14 +219,11 @@ class BinaryFileArchive : public IBinaryArchive
         requires ContiguousContainer<T> && TriviallyCopyableType<typename T::value_type>
     BinaryFileArchive& operator>>(T& container)
     {
-        assert(IsReading());
-        auto pFileStream = reinterpret_cast<std::ifstream*>(m_pFileStream);
-
         typename T::size_type size;
-        pFileStream->read(reinterpret_cast<char*>(&size), sizeof(T::size_type));
+        Read(&size, sizeof(T::size_type));
 
         container.resize(size);
-        pFileStream->read(reinterpret_cast<char*>(container.data()), size * sizeof(T::value_type));
+        Read(container.data(), size * sizeof(T::value_type));
 
         return *this;
     }
@@ -283,12 +258,19 @@ class BinaryFileArchive : public IBinaryArchive
 };
 
 /// @brief Archive view of an existing binary memory array
+/// @note Can also be used as a write-only staging area for a file archive, in which case the content is flushed to the file in chunks
 class BinaryMemoryArchive : public IBinaryArchive
 {
   private:
+    static constexpr size_t MinWriteCapacity = 4 * 1024;
+    static constexpr size_t StreamChunkSize = 256 * 1024;
+
+    Vector<std::byte> m_streamBuffer; // Storage of streaming archives
     Vector<std::byte>& m_memory;
     Vector<std::byte>::iterator m_pReader;
 
+    BinaryFileArchive* m_pStreamTarget = nullptr;
+
   public:
     BinaryMemoryArchive(BinaryMemoryArchive&) = delete;
     // TODO: Use span instead
@@ -300,12 +282,49 @@ class BinaryMemoryArchive : public IBinaryArchive
         }
     }
 
+    /// @brief Create a write archive streaming its content to a file archive
+    BinaryMemoryArchive(BinaryFileArchive& streamTarget) : IBinaryArchive(IOMode::Write), m_memory(m_streamBuffer), m_pStreamTarget(&streamTarget)
+    {
+        m_memory.reserve(StreamChunkSize);
+    }
+
+    ~BinaryMemoryArchive() { Flush(); }
+
     bool IsValid() const override { return m_pReader != m_memory.begin(); }
 
+    /// @brief Reserve memory for upcoming writes. Use when the final size of the data is known in advance
+    void Reserve(size_t size)
+    {
+        assert(IsWriting());
+        m_memory.reserve(m_memory.size() + size);
+    }
+
+    /// @brief Send the pending data of a streaming archive to its target file
+    void Flush();
+
     void Write(const void* pData, size_t size)
     {
         assert(IsWriting());
         auto pBytes = reinterpret_cast<const std::byte*>(pData);
+
+        const auto requiredSize = m_memory.size() + size;
+        if (requiredSize > m_memory.capacity())
+        {
+            if (m_pStreamTarget != nullptr)
+            {
+                Flush();
+                if (size >= StreamChunkSize)
+                {
+                    m_pStreamTarget->Write(pData, size);
+                    return;
+                }
+            }
+            else
+            {
+                // Grow geometrically from a reasonable minimum instead of reallocating on each of the first small writes
+                m_memory.reserve(std::max({requiredSize, 2 * m_memory.capacity(), MinWriteCapacity}));
+            }
+        }
         m_memory.insert(m_memory.end(), pBytes, pBytes + size);
     }
 
@@ -322,11 +341,7 @@ class BinaryMemoryArchive : public IBinaryArchive
     template <TriviallyCopyableType T>
     BinaryMemoryArchive& operator<<(const T& data)
     {
-        assert(IsWriting());
-
-        auto pData = reinterpret_cast<const std::byte*>(&data);
-        m_memory.insert(m_memory.end(), pData, pData + sizeof(T));
-
+        Write(&data, sizeof(T));
         return *this;
     }
 
@@ -385,9 +400,7 @@ class BinaryMemoryArchive : public IBinaryArchive
 
         auto containerSize = container.size();
         *this << containerSize;
-
-        auto pData = reinterpret_cast<const std::byte*>(container.data());
-        m_memory.insert(m_memory.end(), pData, pData + (containerSize * sizeof(T::value_type)));
+        Write(container.data(), containerSize * sizeof(T::value_type));
 
         return *this;
     }
@@ -438,6 +451,21 @@ class BinaryMemoryArchive : public IBinaryArchive
     friend BinaryMemoryArchive& operator<<(BinaryMemoryArchive& out, BinaryFileArchive& in);
 };
 
+template <typename Function>
+BinaryFileArchive& BinaryFileArchive::WriteBlock(Function&& serializeFunction)
+{
+    assert(IsWriting());
+
+    auto blockStartPosition = BeginSizedBlock();
+    {
+        BinaryMemoryArchive blockArchive(*this);
+        serializeFunction(blockArchive);
+    }
+    EndSizedBlock(blockStartPosition);
+
+    return *this;
+}
+
 // --------------------
 // Interop
 // --------------------
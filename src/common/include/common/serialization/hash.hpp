@@ -3,16 +3,174 @@
 #include <xxhash.h>
 
 #include <cctype>
+#include <stdint.h>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace aln
 {
 namespace hash
 {
 constexpr static uint32_t Seed = 'ALNH';
+
+/// @brief Compile-time implementations of XXH32 and XXH64, producing the same values as the library's runtime versions.
+/// Only used in constant evaluation, the library's versions are faster at runtime
+namespace detail
+{
+constexpr uint32_t Prime32_1 = 0x9E3779B1U;
+constexpr uint32_t Prime32_2 = 0x85EBCA77U;
+constexpr uint32_t Prime32_3 = 0xC2B2AE3DU;
+constexpr uint32_t Prime32_4 = 0x27D4EB2FU;
+constexpr uint32_t Prime32_5 = 0x165667B1U;
+
+constexpr uint64_t Prime64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t Prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t Prime64_3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t Prime64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t Prime64_5 = 0x27D4EB2F165667C5ULL;
+
+constexpr uint32_t RotateLeft32(uint32_t value, int bits) { return (value << bits) | (value >> (32 - bits)); }
+constexpr uint64_t RotateLeft64(uint64_t value, int bits) { return (value << bits) | (value >> (64 - bits)); }
+
+/// @brief Little-endian reads, as XXH specifies
+constexpr uint32_t Read32(const char* pData)
+{
+    return (uint32_t) (uint8_t) pData[0] | ((uint32_t) (uint8_t) pData[1] << 8) | ((uint32_t) (uint8_t) pData[2] << 16) | ((uint32_t) (uint8_t) pData[3] << 24);
+}
+constexpr uint64_t Read64(const char* pData) { return (uint64_t) Read32(pData) | ((uint64_t) Read32(pData + 4) << 32); }
+
+constexpr uint32_t Round32(uint32_t accumulator, uint32_t input) { return RotateLeft32(accumulator + input * Prime32_2, 13) * Prime32_1; }
+constexpr uint64_t Round64(uint64_t accumulator, uint64_t input) { return RotateLeft64(accumulator + input * Prime64_2, 31) * Prime64_1; }
+constexpr uint64_t MergeRound64(uint64_t accumulator, uint64_t value) { return (accumulator ^ Round64(0, value)) * Prime64_1 + Prime64_4; }
+
+constexpr uint32_t XXH32(std::string_view str, uint32_t seed)
+{
+    const char* pData = str.data();
+    const char* pEnd = pData + str.size();
+
+    uint32_t hash = 0;
+    if (str.size() >= 16)
+    {
+        uint32_t v1 = seed + Prime32_1 + Prime32_2;
+        uint32_t v2 = seed + Prime32_2;
+        uint32_t v3 = seed;
+        uint32_t v4 = seed - Prime32_1;
+        do
+        {
+            v1 = Round32(v1, Read32(pData));
+            v2 = Round32(v2, Read32(pData + 4));
+            v3 = Round32(v3, Read32(pData + 8));
+            v4 = Round32(v4, Read32(pData + 12));
+            pData += 16;
+        } while (pData <= pEnd - 16);
+        hash = RotateLeft32(v1, 1) + RotateLeft32(v2, 7) + RotateLeft32(v3, 12) + RotateLeft32(v4, 18);
+    }
+    else
+    {
+        hash = seed + Prime32_5;
+    }
+
+    hash += (uint32_t) str.size();
+
+    for (; pData + 4 <= pEnd; pData += 4)
+    {
+        hash = RotateLeft32(hash + Read32(pData) * Prime32_3, 17) * Prime32_4;
+    }
+    for (; pData < pEnd; ++pData)
+    {
+        hash = RotateLeft32(hash + (uint8_t) *pData * Prime32_5, 11) * Prime32_1;
+    }
+
+    hash ^= hash >> 15;
+    hash *= Prime32_2;
+    hash ^= hash >> 13;
+    hash *= Prime32_3;
+    hash ^= hash >> 16;
+    return hash;
 }
-inline static uint32_t Hash32(const std::string& str) { return XXH32(str.c_str(), str.size(), hash::Seed); }
-inline static uint32_t Hash32(const char* str) { return XXH32(str, strlen(str), hash::Seed); }
+
+constexpr uint64_t XXH64(std::string_view str, uint64_t seed)
+{
+    const char* pData = str.data();
+    const char* pEnd = pData + str.size();
+
+    uint64_t hash = 0;
+    if (str.size() >= 32)
+    {
+        uint64_t v1 = seed + Prime64_1 + Prime64_2;
+        uint64_t v2 = seed + Prime64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - Prime64_1;
+        do
+        {
+            v1 = Round64(v1, Read64(pData));
+            v2 = Round64(v2, Read64(pData + 8));
+            v3 = Round64(v3, Read64(pData + 16));
+            v4 = Round64(v4, Read64(pData + 24));
+            pData += 32;
+        } while (pData <= pEnd - 32);
+        hash = RotateLeft64(v1, 1) + RotateLeft64(v2, 7) + RotateLeft64(v3, 12) + RotateLeft64(v4, 18);
+        hash = MergeRound64(hash, v1);
+        hash = MergeRound64(hash, v2);
+        hash = MergeRound64(hash, v3);
+        hash = MergeRound64(hash, v4);
+    }
+    else
+    {
+        hash = seed + Prime64_5;
+    }
+
+    hash += (uint64_t) str.size();
+
+    for (; pData + 8 <= pEnd; pData += 8)
+    {
+        hash = RotateLeft64(hash ^ Round64(0, Read64(pData)), 27) * Prime64_1 + Prime64_4;
+    }
+    if (pData + 4 <= pEnd)
+    {
+        hash = RotateLeft64(hash ^ ((uint64_t) Read32(pData) * Prime64_1), 23) * Prime64_2 + Prime64_3;
+        pData += 4;
+    }
+    for (; pData < pEnd; ++pData)
+    {
+        hash = RotateLeft64(hash ^ ((uint8_t) *pData * Prime64_5), 11) * Prime64_1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= Prime64_2;
+    hash ^= hash >> 29;
+    hash *= Prime64_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+} // namespace detail
+} // namespace hash
+
+/// @brief Hash a string. Evaluated at compile time when possible
+constexpr uint32_t Hash32(std::string_view str)
+{
+    if (std::is_constant_evaluated())
+    {
+        return hash::detail::XXH32(str, hash::Seed);
+    }
+    return XXH32(str.data(), str.size(), hash::Seed);
+}
+
+/// @brief Hash a string. Evaluated at compile time when possible
+constexpr uint64_t Hash64(std::string_view str)
+{
+    if (std::is_constant_evaluated())
+    {
+        return hash::detail::XXH64(str, hash::Seed);
+    }
+    return XXH64(str.data(), str.size(), hash::Seed);
+}
+
+inline uint32_t Hash32(const std::string& str) { return Hash32(std::string_view(str)); }
+inline uint64_t Hash64(const std::string& str) { return Hash64(std::string_view(str)); }
+constexpr uint32_t Hash32(const char* str) { return Hash32(std::string_view(str)); }
+constexpr uint64_t Hash64(const char* str) { return Hash64(std::string_view(str)); }
 /// ...
 
-} // namespace aln
\ No newline at end of file
+} // namespace aln
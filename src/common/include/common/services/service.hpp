@@ -1,10 +1,34 @@
 #pragma once
 
+#include <aln_common_export.h>
+
+#include <stdint.h>
+#include <typeinfo>
+
 namespace aln
 {
 /// @brief Base class for services
 class IService
 {
-    /// @todo : Use a macro to generate unique IDs, kinda like for assets
+};
+
+/// @brief Maximum number of service types in an application
+constexpr uint32_t MaxServiceTypes = 32;
+
+/// @brief Index of each service type in the service providers' slot arrays
+class ServiceSlots
+{
+    /// @brief Get the slot of a type from its name, allocating it on first use.
+    /// Modules each cache their own copy of a type's slot, resolving it by name makes them agree on the index
+    ALN_COMMON_EXPORT static uint32_t GetOrAllocate(const char* typeName);
+
+  public:
+    /// @brief Slot of a service type. Resolved once, then a static read
+    template <typename T>
+    static uint32_t Get()
+    {
+        static const uint32_t slot = GetOrAllocate(typeid(T).name());
+        return slot;
+    }
 };
 } // namespace aln
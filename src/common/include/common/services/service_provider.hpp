@@ -2,38 +2,69 @@
 
 #include "service.hpp"
 
-#include <common/containers/hash_map.hpp>
+#include <common/containers/array.hpp>
 
-#include <typeindex>
+#include <assert.h>
+#include <type_traits>
 
 namespace aln
 {
+/// @brief Holds services in fixed slots indexed by type, so that lookups are a single array access.
+/// A provider can override another one, e.g. to give a preview world its own services: services it does not hold are looked up in its parent
 class ServiceProvider
 {
   private:
-    HashMap<std::type_index, IService*, std::hash<std::type_index>> m_services;
+    Array<IService*, MaxServiceTypes> m_services = {};
+    const ServiceProvider* m_pParent = nullptr;
 
   public:
+    ServiceProvider() = default;
+    explicit ServiceProvider(const ServiceProvider* pParent) : m_pParent(pParent) {}
+
+    /// @brief Set the provider to fall back on for the services this one does not hold
+    void SetParent(const ServiceProvider* pParent)
+    {
+        assert(pParent != this);
+        m_pParent = pParent;
+    }
+
     template <typename T>
     void RegisterService(T* pService)
     {
         static_assert(std::is_base_of_v<IService, T>);
+        assert(pService != nullptr);
 
-        auto typeID = std::type_index(typeid(T));
-        auto [it, emplaced] = m_services.try_emplace(typeID, pService);
-        assert(emplaced);
+        auto& pSlot = m_services[ServiceSlots::Get<T>()];
+        assert(pSlot == nullptr);
+        pSlot = pService;
     }
 
     template <typename T>
-    T* GetService()
+    void UnregisterService()
     {
-        auto typeID = std::type_index(typeid(T));
-        return (T*) m_services[typeID];
+        static_assert(std::is_base_of_v<IService, T>);
+        m_services[ServiceSlots::Get<T>()] = nullptr;
+    }
+
+    template <typename T>
+    T* GetService() const
+    {
+        static_assert(std::is_base_of_v<IService, T>);
+
+        const auto slot = ServiceSlots::Get<T>();
+        for (auto pProvider = this; pProvider != nullptr; pProvider = pProvider->m_pParent)
+        {
+            if (auto pService = pProvider->m_services[slot]; pService != nullptr)
+            {
+                return static_cast<T*>(pService);
+            }
+        }
+        return nullptr;
     }
 
     void UnregisterAllServices()
     {
-        m_services.clear();
+        m_services.fill(nullptr);
     }
 };
-} // namespace aln
\ No newline at end of file
+} // namespace aln
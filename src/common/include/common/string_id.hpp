@@ -5,29 +5,74 @@
 #include "serialization/hash.hpp"
 #include "containers/hash_map.hpp"
 
+#include <string>
+#include <string_view>
+#include <type_traits>
+
 namespace aln
 {
-class ALN_COMMON_EXPORT StringID
+/// @brief Identifier built from the hash of a string.
+/// Hashing is constexpr, IDs built from literals in constant expressions cost nothing at runtime:
+/// @code static constexpr StringID SpeedID = StringID("Speed"); @endcode
+/// Debug builds register the strings hashed at runtime, to look them up from IDs and detect collisions
+/// @note Define ALN_STRING_ID_64 to use 64-bit hashes. Serialized IDs are not compatible between both sizes
+class StringID
 {
+  public:
+#ifdef ALN_STRING_ID_64
+    using HashType = uint64_t;
+#else
+    using HashType = uint32_t;
+#endif
+
   private:
-    uint32_t m_hash;
+    HashType m_hash;
+
+    static constexpr HashType Hash(std::string_view str)
+    {
+#ifdef ALN_STRING_ID_64
+        return Hash64(str);
+#else
+        return Hash32(str);
+#endif
+    }
+
+#ifdef ALN_DEBUG
+    /// @brief Register the string an ID was built from. Asserts if another string was registered with the same hash
+    ALN_COMMON_EXPORT static void RegisterDebugString(HashType hash, std::string_view str);
+#endif
 
   public:
     StringID() = default;
-    StringID(const std::string& str) : m_hash(Hash32(str)) {}
-    StringID(const char* str) : m_hash(Hash32(str)) {}
-    StringID(uint32_t hash) : m_hash(hash) {}
+    constexpr StringID(std::string_view str) : m_hash(Hash(str))
+    {
+#ifdef ALN_DEBUG
+        if (!std::is_constant_evaluated())
+        {
+            RegisterDebugString(m_hash, str);
+        }
+#endif
+    }
+    constexpr StringID(const char* str) : StringID(std::string_view(str)) {}
+    StringID(const std::string& str) : StringID(std::string_view(str)) {}
+    constexpr StringID(HashType hash) : m_hash(hash) {}
+
+    constexpr HashType GetHash() const { return m_hash; }
+    constexpr bool IsValid() const { return m_hash != 0; }
 
-    inline uint32_t GetHash() const { return m_hash; }
-    bool IsValid() const { return m_hash != 0; }
+    constexpr bool operator==(const StringID& id) const { return m_hash == id.m_hash; }
+    constexpr bool operator!=(const StringID& id) const { return m_hash != id.m_hash; }
+    constexpr bool operator<(const StringID& id) const { return m_hash < id.m_hash; }
 
-    bool operator==(const StringID& id) const { return m_hash == id.m_hash; }
-    bool operator!=(const StringID& id) const { return m_hash != id.m_hash; }
-    bool operator<(const StringID& id) const { return m_hash < id.m_hash; }
+    /// @brief String this ID was built from, for debugging purposes
+    /// @return An empty string in release builds, or if the ID was built in a constant expression or from a hash
+    ALN_COMMON_EXPORT std::string_view GetDebugString() const;
 
-    static StringID InvalidID;
+    static const StringID InvalidID;
 };
 
+inline constexpr StringID StringID::InvalidID = StringID((StringID::HashType) 0);
+
 // StringID must be trivial to easily be serialized
 static_assert(std::is_trivial_v<StringID>);
 
@@ -38,6 +83,6 @@ namespace eastl
 template <>
 struct hash<aln::StringID>
 {
-    size_t operator()(const aln::StringID& id) const { return id.GetHash(); }
+    size_t operator()(const aln::StringID& id) const { return (size_t) id.GetHash(); }
 };
-} // namespace eastl
\ No newline at end of file
+} // namespace eastl
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace aln
+{
+/// @brief Pixel formats of texture assets. Shared by the asset converter and the runtime loader
+enum class TextureFormat : uint8_t
+{
+    RGBA8, // Uncompressed
+    BC1,   // RGB, 1-bit alpha. 4 bits per pixel
+    BC3,   // RGBA. 8 bits per pixel
+    BC5,   // Two channels (i.e. tangent-space normals). 8 bits per pixel
+    BC7,   // High quality RGBA. 8 bits per pixel
+};
+
+inline bool IsBlockCompressed(TextureFormat format) { return format != TextureFormat::RGBA8; }
+
+/// @brief Size in bytes of a 4x4 block for compressed formats, of a pixel otherwise
+inline uint32_t GetTextureFormatElementSize(TextureFormat format)
+{
+    switch (format)
+    {
+    case TextureFormat::RGBA8:
+        return 4;
+    case TextureFormat::BC1:
+        return 8;
+    case TextureFormat::BC3:
+    case TextureFormat::BC5:
+    case TextureFormat::BC7:
+        return 16;
+    }
+    assert(false);
+    return 0;
+}
+
+inline uint32_t GetMipDimension(uint32_t baseDimension, uint32_t mipLevel)
+{
+    const auto dimension = baseDimension >> mipLevel;
+    return dimension > 0 ? dimension : 1;
+}
+
+/// @brief Number of levels in a full mip chain, down to 1x1
+inline uint32_t GetMipChainLength(uint32_t width, uint32_t height)
+{
+    auto largest = width > height ? width : height;
+    uint32_t levels = 1;
+    while (largest > 1)
+    {
+        largest >>= 1;
+        levels++;
+    }
+    return levels;
+}
+
+/// @brief Size in bytes of a single mip level
+inline size_t GetMipByteSize(TextureFormat format, uint32_t width, uint32_t height)
+{
+    if (IsBlockCompressed(format))
+    {
+        const size_t blockCountX = (width + 3) / 4;
+        const size_t blockCountY = (height + 3) / 4;
+        return blockCountX * blockCountY * GetTextureFormatElementSize(format);
+    }
+    return (size_t) width * height * GetTextureFormatElementSize(format);
+}
+} // namespace aln
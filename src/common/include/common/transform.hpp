@@ -4,6 +4,9 @@
 #include "maths/quaternion.hpp"
 #include "maths/vec3.hpp"
 #include "maths/angles.hpp"
+#include "maths/simd.hpp"
+
+#include "containers/span.hpp"
 
 #include <aln_common_export.h>
 
@@ -18,27 +21,24 @@ class Matrix4x4;
 class ALN_COMMON_EXPORT Transform
 {
   private:
-    Vec3 m_translation;
+    // The rotation is 16 bytes aligned for the SIMD kernels, which pads transforms to 48 bytes whatever the member order
     Quaternion m_rotation;
+    Vec3 m_translation;
     Vec3 m_scale;
 
-    /// @brief Helper function to check if a quaternion is normalized.
-    /// @note Very ineficient, it's only use is for assertions which will be stripped in release.
-    bool IsQuaternionNormalized(const Quaternion& q)
-    {
-        auto n = q.Normalized();
-        return q.IsNearEqual(n);
-    };
+    // Fused SIMD kernels, shared by the single and batch operations. The result can alias the inputs
+    static void ComposeKernel(const Transform& a, const Transform& b, Transform& result);
+    static void InterpolateKernel(const Transform& a, const Transform& b, float factor, Transform& result);
 
   public:
-    Transform() : m_translation(0.0f, 0.0f, 0.0f),
-                  m_rotation(1.0f, 0.0f, 0.0f, 0.0f),
+    Transform() : m_rotation(1.0f, 0.0f, 0.0f, 0.0f),
+                  m_translation(0.0f, 0.0f, 0.0f),
                   m_scale(1.0f, 1.0f, 1.0f){};
     Transform(const Matrix4x4& matrix);
     Transform(const Vec3& translation, const Quaternion& rotation, const Vec3& scale)
-        : m_translation(translation), m_rotation(rotation), m_scale(scale)
+        : m_rotation(rotation), m_translation(translation), m_scale(scale)
     {
-        assert(IsQuaternionNormalized(rotation));
+        assert(rotation.IsNormalized());
     }
 
     inline const Vec3& GetTranslation() const { return m_translation; }
@@ -51,7 +51,7 @@ class ALN_COMMON_EXPORT Transform
 
     inline void SetRotation(const Quaternion& rotation)
     {
-        assert(IsQuaternionNormalized(rotation));
+        assert(rotation.IsNormalized());
         m_rotation = rotation;
     }
 
@@ -70,11 +70,9 @@ class ALN_COMMON_EXPORT Transform
 
     static Transform Interpolate(const Transform& a, const Transform& b, float factor)
     {
-        auto translation = Vec3::Lerp(a.m_translation, b.m_translation, factor);
-        auto rotation = Quaternion::Slerp(a.m_rotation, b.m_rotation, factor);
-        auto scale = Vec3::Lerp(a.m_scale, b.m_scale, factor);
-
-        return Transform(translation, rotation, scale);
+        Transform result;
+        InterpolateKernel(a, b, factor, result);
+        return result;
     };
 
     /// @brief Get the delta between two transforms. Scale is ignored !
@@ -95,8 +93,11 @@ class ALN_COMMON_EXPORT Transform
 
     Vec3 TransformPoint(const Vec3& point) const
     {
-        Vec3 out = m_rotation.RotateVector(m_scale.Scale(point));
-        out = out + m_translation;
+        const auto scaledPoint = SIMD::Mul(SIMD::Load3(&m_scale.x), SIMD::Load3(&point.x));
+        const auto rotatedPoint = Quaternion::RotateVectorSIMD(m_rotation.ToSIMD(), scaledPoint);
+
+        Vec3 out;
+        SIMD::Store3(&out.x, SIMD::Add(rotatedPoint, SIMD::Load3(&m_translation.x)));
         return out;
     }
 
@@ -122,7 +123,15 @@ class ALN_COMMON_EXPORT Transform
     /// @brief Transform composition (right-to-left)
     Transform operator*(const Transform& b) const;
 
+    // ---- Batch operations. Results can alias the inputs
+    /// @brief results[i] = a[i] * b[i]
+    static void ComposeBatch(Span<const Transform> a, Span<const Transform> b, Span<Transform> results);
+    static void InterpolateBatch(Span<const Transform> a, Span<const Transform> b, float factor, Span<Transform> results);
+
     static const Transform Identity;
 };
 
+// Transform arrays are serialized as raw memory in asset archives. Changing the layout requires bumping the asset archive version
+static_assert(sizeof(Transform) == 48 && alignof(Transform) == 16);
+
 } // namespace aln
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <common/maths/quantization.hpp>
 #include <common/maths/vec2.hpp>
 #include <common/maths/vec3.hpp>
 #include <common/maths/vec4.hpp>
@@ -9,19 +10,37 @@
 namespace aln
 {
 
-#pragma warning(disable : 4324)
+/// @brief Axis-aligned bounds of a mesh, used to quantize vertex positions to snorm16.
+/// Positions are stored relative to the center and normalized by the half extent, and expanded back in the vertex shaders.
+struct MeshBounds
+{
+    Vec3 m_center;
+    Vec3 m_halfExtent;
 
+    Array<int16_t, 4> EncodePosition(const Vec3& position) const
+    {
+        const auto normalized = (position - m_center) / m_halfExtent;
+        return {Maths::FloatToSnorm16(normalized.x), Maths::FloatToSnorm16(normalized.y), Maths::FloatToSnorm16(normalized.z), 0};
+    }
+
+    Vec3 DecodePosition(const Array<int16_t, 4>& encoded) const
+    {
+        const auto normalized = Vec3(Maths::Snorm16ToFloat(encoded[0]), Maths::Snorm16ToFloat(encoded[1]), Maths::Snorm16ToFloat(encoded[2]));
+        return m_center + normalized * m_halfExtent;
+    }
+};
+
+/// @brief Compact static mesh vertex (20 bytes)
 struct Vertex
 {
-  public:
-    alignas(16) Vec3 pos;
-    alignas(16) Vec3 color;
-    alignas(16) Vec2 texCoord;
-    alignas(16) Vec3 normal;
+    Array<int16_t, 4> pos;       // snorm16, relative to the mesh bounds. w is padding
+    Array<int16_t, 2> normal;    // Octahedral encoding, snorm16
+    Array<uint16_t, 2> texCoord; // Half floats
+    Array<uint8_t, 4> color;     // unorm8
 
     bool operator==(const Vertex& other) const
     {
-        return pos == other.pos && color == other.color && texCoord == other.texCoord && normal == other.normal;
+        return pos == other.pos && normal == other.normal && texCoord == other.texCoord && color == other.color;
     }
 
     bool operator!=(const Vertex& other) const
@@ -30,22 +49,26 @@ struct Vertex
     }
 };
 
-struct SkinnedVertex : public Vertex
+/// @brief Compact skinned mesh vertex (28 bytes). Supports skeletons of up to 256 bones.
+struct SkinnedVertex
 {
-    alignas(16) Vec3 pos;
-    alignas(16) Vec3 color;
-    alignas(16) Vec2 texCoord;
-    alignas(16) Vec3 normal;
-    alignas(16) Vec4 weights;
-    alignas(16) Array<uint32_t, 4> boneIndices;
+    Array<int16_t, 4> pos;       // snorm16, relative to the mesh bounds. w is padding
+    Array<int16_t, 2> normal;    // Octahedral encoding, snorm16
+    Array<uint16_t, 2> texCoord; // Half floats
+    Array<uint8_t, 4> color;     // unorm8
+    Array<uint8_t, 4> boneIndices;
+    Array<uint8_t, 4> weights; // unorm8, summing up to 255
 };
 
+static_assert(sizeof(Vertex) == 20);
+static_assert(sizeof(SkinnedVertex) == 28);
+
 struct DebugVertex
 {
-    alignas(16) Vec3 pos;
-    alignas(16) Vec3 color;
+    Vec3 pos;
+    uint32_t color; // RGBA8 unorm, see RGBColor::ToU32
 };
 
-#pragma warning(default : 4324)
+static_assert(sizeof(DebugVertex) == 16);
 
 } // namespace aln
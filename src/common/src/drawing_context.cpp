@@ -0,0 +1,59 @@
+#include "drawing_context.hpp"
+
+#include "memory.hpp"
+
+#include <mutex>
+
+namespace aln
+{
+namespace
+{
+// Contexts are created on a thread's first draw and live as long as the application, worker threads are never torn down
+std::mutex g_threadContextsMutex;
+Vector<DrawingContext*> g_threadContexts;
+} // namespace
+
+namespace DebugDrawing
+{
+DrawingContext& GetThreadContext()
+{
+    thread_local DrawingContext* pThreadContext = nullptr;
+    if (pThreadContext == nullptr)
+    {
+        pThreadContext = aln::New<DrawingContext>();
+
+        std::lock_guard lock(g_threadContextsMutex);
+        g_threadContexts.push_back(pThreadContext);
+    }
+    return *pThreadContext;
+}
+
+void Clear()
+{
+    std::lock_guard lock(g_threadContextsMutex);
+    for (auto pContext : g_threadContexts)
+    {
+        pContext->Clear();
+    }
+}
+
+void CollectVertices(Vector<DebugVertex>& outVertices)
+{
+    std::lock_guard lock(g_threadContextsMutex);
+
+    uint32_t vertexCount = 0;
+    for (const auto pContext : g_threadContexts)
+    {
+        vertexCount += pContext->GetVertexCount();
+    }
+
+    outVertices.clear();
+    outVertices.reserve(vertexCount);
+    for (const auto pContext : g_threadContexts)
+    {
+        const auto& vertices = pContext->GetVertices();
+        outVertices.insert(outVertices.end(), vertices.begin(), vertices.end());
+    }
+}
+} // namespace DebugDrawing
+} // namespace aln
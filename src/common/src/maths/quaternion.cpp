@@ -3,6 +3,7 @@
 #include "maths/angles.hpp"
 #include "maths/matrix4x4.hpp"
 #include "maths/vec3.hpp"
+#include "maths/wide.hpp"
 
 namespace aln
 {
@@ -55,9 +56,91 @@ EulerAnglesRadians Quaternion::ToEulerAngles() const
     return EulerAnglesRadians((Radians) vec.y, (Radians) vec.x, (Radians) vec.z);
 }
 
-Matrix4x4 Quaternion::ToMatrix() const { return Matrix4x4(glm::toMat4(AsGLM())); }
+Matrix4x4 Quaternion::ToMatrix() const
+{
+    const float xx = x * x, yy = y * y, zz = z * z;
+    const float xy = x * y, xz = x * z, yz = y * z;
+    const float wx = w * x, wy = w * y, wz = w * z;
+
+    Matrix4x4 matrix;
+    matrix[0] = {1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f};
+    matrix[1] = {2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f};
+    matrix[2] = {2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f};
+    matrix[3] = {0.0f, 0.0f, 0.0f, 1.0f};
+    return matrix;
+}
+
+void Quaternion::NormalizeBatch(Span<const Quaternion> quaternions, Span<Quaternion> results)
+{
+    assert(quaternions.size() == results.size());
+
+    const auto count = results.size();
+    auto i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const auto q = WideQuaternion::Load(quaternions[i], quaternions[i + 1], quaternions[i + 2], quaternions[i + 3]);
+        WideQuaternion::Normalize(q).Store(results[i], results[i + 1], results[i + 2], results[i + 3]);
+    }
+    for (; i < count; ++i)
+    {
+        results[i].SetFromSIMD(NormalizeSIMD(quaternions[i].ToSIMD()));
+    }
+}
+
+void Quaternion::MultiplyBatch(Span<const Quaternion> a, Span<const Quaternion> b, Span<Quaternion> results)
+{
+    assert(a.size() == results.size() && b.size() == results.size());
+
+    const auto count = results.size();
+    auto i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const auto wideA = WideQuaternion::Load(a[i], a[i + 1], a[i + 2], a[i + 3]);
+        const auto wideB = WideQuaternion::Load(b[i], b[i + 1], b[i + 2], b[i + 3]);
+        WideQuaternion::Multiply(wideA, wideB).Store(results[i], results[i + 1], results[i + 2], results[i + 3]);
+    }
+    for (; i < count; ++i)
+    {
+        assert(a[i].IsNormalized() && b[i].IsNormalized());
+        results[i].SetFromSIMD(MultiplySIMD(a[i].ToSIMD(), b[i].ToSIMD()));
+    }
+}
 
-Vec3 Quaternion::RotateVector(const Vec3& vector) const { return glm::rotate(AsGLM(), vector.AsGLM()); }
+void Quaternion::SlerpBatch(Span<const Quaternion> a, Span<const Quaternion> b, float t, Span<Quaternion> results)
+{
+    assert(a.size() == results.size() && b.size() == results.size());
+
+    const auto count = results.size();
+    auto i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const auto wideA = WideQuaternion::Load(a[i], a[i + 1], a[i + 2], a[i + 3]);
+        const auto wideB = WideQuaternion::Load(b[i], b[i + 1], b[i + 2], b[i + 3]);
+        WideQuaternion::Slerp(wideA, wideB, t).Store(results[i], results[i + 1], results[i + 2], results[i + 3]);
+    }
+    for (; i < count; ++i)
+    {
+        results[i].SetFromSIMD(SlerpSIMD(a[i].ToSIMD(), b[i].ToSIMD(), t));
+    }
+}
+
+void Quaternion::NLerpBatch(Span<const Quaternion> a, Span<const Quaternion> b, float t, Span<Quaternion> results)
+{
+    assert(a.size() == results.size() && b.size() == results.size());
+
+    const auto count = results.size();
+    auto i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const auto wideA = WideQuaternion::Load(a[i], a[i + 1], a[i + 2], a[i + 3]);
+        const auto wideB = WideQuaternion::Load(b[i], b[i + 1], b[i + 2], b[i + 3]);
+        WideQuaternion::NLerp(wideA, wideB, t).Store(results[i], results[i + 1], results[i + 2], results[i + 3]);
+    }
+    for (; i < count; ++i)
+    {
+        results[i].SetFromSIMD(NLerpSIMD(a[i].ToSIMD(), b[i].ToSIMD(), t));
+    }
+}
 
 const Quaternion Quaternion::Identity = Quaternion(1.0f, 0.0f, 0.0f, 0.0f);
 
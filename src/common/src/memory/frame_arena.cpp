@@ -0,0 +1,69 @@
+#include "memory/frame_arena.hpp"
+
+#include <algorithm>
+
+namespace aln
+{
+FrameArena::FrameArena(size_t capacity) : m_capacity(capacity)
+{
+    m_pBuffer = (std::byte*) aln::Allocate(capacity, 64, MemoryTag::General);
+    assert(m_pBuffer != nullptr);
+}
+
+FrameArena::~FrameArena()
+{
+    Reset();
+    aln::Free(m_pBuffer);
+}
+
+void* FrameArena::Allocate(size_t size, size_t alignment)
+{
+    assert((alignment & (alignment - 1)) == 0);
+
+    // Reserve enough room to align the pointer regardless of the current offset
+    const auto reservedSize = size + alignment - 1;
+    const auto offset = m_offset.fetch_add(reservedSize, std::memory_order_relaxed);
+    if (offset + reservedSize <= m_capacity)
+    {
+        auto address = reinterpret_cast<uintptr_t>(m_pBuffer + offset);
+        address = (address + alignment - 1) & ~(uintptr_t) (alignment - 1);
+        return reinterpret_cast<void*>(address);
+    }
+
+    // The arena is full: fall back to the heap. The block is prefixed with a link so that it can be released on reset
+    const auto headerSize = std::max(sizeof(OverflowAllocation), alignment);
+    auto pBlock = (std::byte*) aln::Allocate(headerSize + size, std::max(alignof(OverflowAllocation), alignment));
+
+    std::lock_guard lock(m_overflowMutex);
+    auto pOverflow = reinterpret_cast<OverflowAllocation*>(pBlock);
+    pOverflow->m_pNext = m_pOverflowAllocations;
+    m_pOverflowAllocations = pOverflow;
+    m_overflowBytes += size;
+
+    return pBlock + headerSize;
+}
+
+void FrameArena::Reset()
+{
+    const auto usedBytes = std::min(m_offset.load(std::memory_order_relaxed), m_capacity) + m_overflowBytes;
+    m_highWaterMark = std::max(m_highWaterMark, usedBytes);
+
+    while (m_pOverflowAllocations != nullptr)
+    {
+        auto pNext = m_pOverflowAllocations->m_pNext;
+        aln::Free(m_pOverflowAllocations);
+        m_pOverflowAllocations = pNext;
+    }
+    m_overflowBytes = 0;
+    m_offset.store(0, std::memory_order_relaxed);
+}
+
+namespace Memory
+{
+FrameArena& GetFrameArena()
+{
+    static FrameArena arena;
+    return arena;
+}
+} // namespace Memory
+} // namespace aln
@@ -0,0 +1,457 @@
+#include "memory.hpp"
+#include "memory/frame_arena.hpp"
+
+#include <array>
+#include <assert.h>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+#ifdef ALN_DEBUG
+#include <tracy/Tracy.hpp>
+#endif
+
+namespace aln
+{
+namespace
+{
+// -------------------------------------------------
+// System heap
+// -------------------------------------------------
+
+void* SystemAllocate(size_t size, size_t alignment)
+{
+#ifdef _MSC_VER
+    return _aligned_malloc(size, alignment);
+#else
+    return std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#endif
+}
+
+void SystemFree(void* ptr)
+{
+#ifdef _MSC_VER
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+// -------------------------------------------------
+// Size classes
+// -------------------------------------------------
+
+/// @brief Every allocation is preceded by a header, used to route it back to the right heap and update the stats
+struct alignas(16) AllocationHeader
+{
+    uint64_t m_size;     // Requested size
+    uint16_t m_offset;   // Offset from the start of the underlying block to the user pointer
+    uint8_t m_sizeClass; // LargeAllocation for allocations served by the system heap
+    MemoryTag m_tag;
+};
+static_assert(sizeof(AllocationHeader) == 16);
+
+constexpr size_t MinAlignment = alignof(AllocationHeader);
+constexpr uint8_t LargeAllocation = UINT8_MAX;
+
+// Block sizes, header included. Spaced so that the internal fragmentation stays under 25%
+constexpr std::array<uint32_t, 21> SizeClasses = {32, 48, 64, 80, 96, 128, 160, 192, 256, 320, 384, 512, 640, 768, 1024, 1280, 1536, 2048, 2560, 3072, 4096};
+constexpr size_t MaxSmallBlockSize = SizeClasses.back();
+constexpr size_t SizeClassCount = SizeClasses.size();
+
+/// @brief Block size / 16 -> size class lookup table
+constexpr auto SizeClassLookup = []()
+{
+    std::array<uint8_t, MaxSmallBlockSize / MinAlignment + 1> lookup = {};
+    uint8_t sizeClass = 0;
+    for (size_t entry = 0; entry < lookup.size(); ++entry)
+    {
+        while (SizeClasses[sizeClass] < entry * MinAlignment)
+        {
+            sizeClass++;
+        }
+        lookup[entry] = sizeClass;
+    }
+    return lookup;
+}();
+
+// -------------------------------------------------
+// Shared free lists
+// -------------------------------------------------
+
+struct FreeBlock
+{
+    FreeBlock* m_pNext;
+};
+
+/// @brief Free list shared by all threads for a size class. Threads exchange blocks with it in batches
+/// @note Blocks are carved from spans that are never returned to the system
+struct CentralFreeList
+{
+    static constexpr size_t SpanSize = 64 * 1024;
+
+    std::mutex m_mutex;
+    FreeBlock* m_pHead = nullptr;
+    uint32_t m_count = 0;
+};
+
+struct CentralHeap
+{
+    std::array<CentralFreeList, SizeClassCount> m_freeLists;
+    std::atomic<size_t> m_reservedBytes = 0;
+};
+
+/// @brief The central heap is never destroyed, so that memory can still be freed during static destruction
+CentralHeap& GetCentralHeap()
+{
+    alignas(CentralHeap) static std::byte storage[sizeof(CentralHeap)];
+    static CentralHeap* pHeap = new (storage) CentralHeap();
+    return *pHeap;
+}
+
+/// @brief Move up to count blocks from the central free list to the output list
+/// @return The number of blocks moved
+uint32_t FetchFromCentralHeap(uint8_t sizeClass, uint32_t count, FreeBlock*& pOutHead)
+{
+    auto& heap = GetCentralHeap();
+    auto& freeList = heap.m_freeLists[sizeClass];
+    const auto blockSize = SizeClasses[sizeClass];
+
+    std::lock_guard lock(freeList.m_mutex);
+    if (freeList.m_pHead == nullptr)
+    {
+        // Carve a new span
+        auto pSpan = (std::byte*) SystemAllocate(CentralFreeList::SpanSize, MinAlignment);
+        if (pSpan == nullptr)
+        {
+            return 0;
+        }
+        heap.m_reservedBytes.fetch_add(CentralFreeList::SpanSize, std::memory_order_relaxed);
+
+        const auto blockCount = CentralFreeList::SpanSize / blockSize;
+        for (size_t blockIndex = 0; blockIndex < blockCount; ++blockIndex)
+        {
+            auto pBlock = reinterpret_cast<FreeBlock*>(pSpan + blockIndex * blockSize);
+            pBlock->m_pNext = freeList.m_pHead;
+            freeList.m_pHead = pBlock;
+        }
+        freeList.m_count += (uint32_t) blockCount;
+    }
+
+    uint32_t fetchedCount = 0;
+    while (fetchedCount < count && freeList.m_pHead != nullptr)
+    {
+        auto pBlock = freeList.m_pHead;
+        freeList.m_pHead = pBlock->m_pNext;
+
+        pBlock->m_pNext = pOutHead;
+        pOutHead = pBlock;
+        fetchedCount++;
+    }
+    freeList.m_count -= fetchedCount;
+    return fetchedCount;
+}
+
+void ReleaseToCentralHeap(uint8_t sizeClass, FreeBlock* pHead, FreeBlock* pTail, uint32_t count)
+{
+    auto& freeList = GetCentralHeap().m_freeLists[sizeClass];
+
+    std::lock_guard lock(freeList.m_mutex);
+    pTail->m_pNext = freeList.m_pHead;
+    freeList.m_pHead = pHead;
+    freeList.m_count += count;
+}
+
+// -------------------------------------------------
+// Thread caches
+// -------------------------------------------------
+
+/// @brief Per-thread free lists. Allocations and frees hit them without any synchronization,
+/// the central heap is only accessed to transfer batches of blocks
+struct ThreadCache
+{
+    static constexpr uint32_t BatchSize = 32;
+    static constexpr uint32_t MaxCachedBlocks = 4 * BatchSize;
+
+    FreeBlock* m_heads[SizeClassCount];
+    uint32_t m_counts[SizeClassCount];
+    bool m_isShutdown;
+};
+
+// Trivial type, so that it stays accessible while other thread locals are destroyed
+thread_local ThreadCache t_threadCache = {};
+thread_local MemoryTag t_currentTag = MemoryTag::General;
+
+/// @brief Return the cached blocks to the central heap when a thread exits
+struct ThreadCacheReleaser
+{
+    bool m_isRegistered = false;
+
+    ~ThreadCacheReleaser()
+    {
+        auto& cache = t_threadCache;
+        for (uint8_t sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+        {
+            auto pHead = cache.m_heads[sizeClass];
+            if (pHead != nullptr)
+            {
+                auto pTail = pHead;
+                while (pTail->m_pNext != nullptr)
+                {
+                    pTail = pTail->m_pNext;
+                }
+                ReleaseToCentralHeap(sizeClass, pHead, pTail, cache.m_counts[sizeClass]);
+            }
+            cache.m_heads[sizeClass] = nullptr;
+            cache.m_counts[sizeClass] = 0;
+        }
+        cache.m_isShutdown = true;
+    }
+};
+thread_local ThreadCacheReleaser t_threadCacheReleaser;
+
+void* AllocateSmallBlock(uint8_t sizeClass)
+{
+    auto& cache = t_threadCache;
+    if (cache.m_isShutdown)
+    {
+        FreeBlock* pBlock = nullptr;
+        FetchFromCentralHeap(sizeClass, 1, pBlock);
+        return pBlock;
+    }
+
+    if (cache.m_heads[sizeClass] == nullptr)
+    {
+        // Touch the releaser so that it gets constructed, and its destructor registered for this thread
+        t_threadCacheReleaser.m_isRegistered = true;
+        cache.m_counts[sizeClass] += FetchFromCentralHeap(sizeClass, ThreadCache::BatchSize, cache.m_heads[sizeClass]);
+        if (cache.m_heads[sizeClass] == nullptr)
+        {
+            return nullptr;
+        }
+    }
+
+    auto pBlock = cache.m_heads[sizeClass];
+    cache.m_heads[sizeClass] = pBlock->m_pNext;
+    cache.m_counts[sizeClass]--;
+    return pBlock;
+}
+
+void FreeSmallBlock(void* pBlockMemory, uint8_t sizeClass)
+{
+    auto pBlock = reinterpret_cast<FreeBlock*>(pBlockMemory);
+
+    auto& cache = t_threadCache;
+    if (cache.m_isShutdown)
+    {
+        pBlock->m_pNext = nullptr;
+        ReleaseToCentralHeap(sizeClass, pBlock, pBlock, 1);
+        return;
+    }
+
+    pBlock->m_pNext = cache.m_heads[sizeClass];
+    cache.m_heads[sizeClass] = pBlock;
+    cache.m_counts[sizeClass]++;
+
+    // Give a batch back when the cache grows too large, i.e. for producer/consumer patterns where blocks are freed on another thread
+    if (cache.m_counts[sizeClass] > ThreadCache::MaxCachedBlocks)
+    {
+        auto pHead = cache.m_heads[sizeClass];
+        auto pTail = pHead;
+        for (uint32_t i = 1; i < ThreadCache::BatchSize; ++i)
+        {
+            pTail = pTail->m_pNext;
+        }
+        cache.m_heads[sizeClass] = pTail->m_pNext;
+        cache.m_counts[sizeClass] -= ThreadCache::BatchSize;
+
+        ReleaseToCentralHeap(sizeClass, pHead, pTail, ThreadCache::BatchSize);
+    }
+}
+
+// -------------------------------------------------
+// Statistics
+// -------------------------------------------------
+
+struct alignas(64) TagCounters
+{
+    std::atomic<int64_t> m_liveBytes = 0;
+    std::atomic<int64_t> m_liveAllocationCount = 0;
+    std::atomic<int64_t> m_highWaterMark = 0;
+    std::atomic<int64_t> m_frameAllocationCount = 0;
+    std::atomic<int64_t> m_totalAllocationCount = 0;
+};
+
+std::array<TagCounters, (size_t) MemoryTag::Count> g_tagCounters;
+
+void RecordAllocation(MemoryTag tag, size_t size)
+{
+    auto& counters = g_tagCounters[(size_t) tag];
+    const auto liveBytes = counters.m_liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    counters.m_liveAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    counters.m_frameAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    counters.m_totalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    auto highWaterMark = counters.m_highWaterMark.load(std::memory_order_relaxed);
+    while (liveBytes > highWaterMark && !counters.m_highWaterMark.compare_exchange_weak(highWaterMark, liveBytes, std::memory_order_relaxed))
+    {
+    }
+}
+
+void RecordFree(MemoryTag tag, size_t size)
+{
+    auto& counters = g_tagCounters[(size_t) tag];
+    counters.m_liveBytes.fetch_sub(size, std::memory_order_relaxed);
+    counters.m_liveAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+// -------------------------------------------------
+// Allocation
+// -------------------------------------------------
+
+void* AllocateInternal(size_t size, size_t alignment, MemoryTag tag)
+{
+    assert((alignment & (alignment - 1)) == 0);
+
+    AllocationHeader* pHeader = nullptr;
+    if (alignment <= MinAlignment && size + sizeof(AllocationHeader) <= MaxSmallBlockSize)
+    {
+        const auto blockSize = size + sizeof(AllocationHeader);
+        const auto sizeClass = SizeClassLookup[(blockSize + MinAlignment - 1) / MinAlignment];
+
+        auto pBlock = AllocateSmallBlock(sizeClass);
+        if (pBlock == nullptr)
+        {
+            return nullptr;
+        }
+
+        pHeader = reinterpret_cast<AllocationHeader*>(pBlock);
+        pHeader->m_offset = sizeof(AllocationHeader);
+        pHeader->m_sizeClass = sizeClass;
+    }
+    else
+    {
+        // Place the header right before the aligned user pointer
+        const auto offset = alignment > sizeof(AllocationHeader) ? alignment : sizeof(AllocationHeader);
+        assert(offset <= UINT16_MAX);
+
+        auto pBlock = (std::byte*) SystemAllocate(size + offset, offset);
+        if (pBlock == nullptr)
+        {
+            return nullptr;
+        }
+
+        pHeader = reinterpret_cast<AllocationHeader*>(pBlock + offset - sizeof(AllocationHeader));
+        pHeader->m_offset = (uint16_t) offset;
+        pHeader->m_sizeClass = LargeAllocation;
+    }
+
+    pHeader->m_size = size;
+    pHeader->m_tag = tag;
+    RecordAllocation(tag, size);
+
+    return pHeader + 1;
+}
+
+void FreeInternal(void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    auto pHeader = reinterpret_cast<AllocationHeader*>(ptr) - 1;
+    RecordFree(pHeader->m_tag, pHeader->m_size);
+
+    auto pBlock = reinterpret_cast<std::byte*>(ptr) - pHeader->m_offset;
+    if (pHeader->m_sizeClass == LargeAllocation)
+    {
+        SystemFree(pBlock);
+    }
+    else
+    {
+        FreeSmallBlock(pBlock, pHeader->m_sizeClass);
+    }
+}
+} // namespace
+
+void* Allocate(size_t size, size_t alignment, MemoryTag tag)
+{
+    auto ptr = AllocateInternal(size, alignment, tag);
+#ifdef ALN_DEBUG
+    TracyAllocS(ptr, size, 15);
+#endif
+    return ptr;
+}
+
+void* Allocate(size_t size, size_t alignment) { return Allocate(size, alignment, t_currentTag); }
+
+void Free(void* ptr)
+{
+#ifdef ALN_DEBUG
+    TracyFreeS(ptr, 15);
+#endif
+    FreeInternal(ptr);
+}
+
+#ifdef ALN_DEBUG
+void* AllocateUnmarked(size_t size, size_t alignment) { return AllocateInternal(size, alignment, t_currentTag); }
+void FreeUnmarked(void* ptr) { FreeInternal(ptr); }
+#endif
+
+MemoryTagScope::MemoryTagScope(MemoryTag tag) : m_previousTag(t_currentTag) { t_currentTag = tag; }
+MemoryTagScope::~MemoryTagScope() { t_currentTag = m_previousTag; }
+
+namespace Memory
+{
+MemoryTagStats GetTagStats(MemoryTag tag)
+{
+    assert(tag < MemoryTag::Count);
+    const auto& counters = g_tagCounters[(size_t) tag];
+
+    MemoryTagStats stats;
+    stats.m_liveBytes = counters.m_liveBytes.load(std::memory_order_relaxed);
+    stats.m_liveAllocationCount = counters.m_liveAllocationCount.load(std::memory_order_relaxed);
+    stats.m_highWaterMark = counters.m_highWaterMark.load(std::memory_order_relaxed);
+    stats.m_frameAllocationCount = counters.m_frameAllocationCount.load(std::memory_order_relaxed);
+    stats.m_totalAllocationCount = counters.m_totalAllocationCount.load(std::memory_order_relaxed);
+    return stats;
+}
+
+const char* GetTagName(MemoryTag tag)
+{
+    switch (tag)
+    {
+    case MemoryTag::General:
+        return "General";
+    case MemoryTag::Animation:
+        return "Animation";
+    case MemoryTag::Entities:
+        return "Entities";
+    case MemoryTag::Assets:
+        return "Assets";
+    case MemoryTag::Render:
+        return "Render";
+    default:
+        assert(false);
+        return "Unknown";
+    }
+}
+
+size_t GetCachedHeapReservedBytes() { return GetCentralHeap().m_reservedBytes.load(std::memory_order_relaxed); }
+
+void BeginFrame()
+{
+    for (auto& counters : g_tagCounters)
+    {
+        counters.m_frameAllocationCount.store(0, std::memory_order_relaxed);
+    }
+    GetFrameArena().Reset();
+}
+} // namespace Memory
+} // namespace aln
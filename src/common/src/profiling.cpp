@@ -0,0 +1,390 @@
+#include "profiling.hpp"
+
+#include <common/containers/array.hpp>
+#include <common/containers/hash_map.hpp>
+#include <common/memory.hpp>
+
+#include <algorithm>
+#include <array>
+#include <assert.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+
+namespace aln
+{
+namespace
+{
+// -------------------------------------------------
+// Per-thread sample buffers
+// -------------------------------------------------
+
+struct Sample
+{
+    const char* m_name;
+    int64_t m_value; // Duration in nanoseconds for timers, value for counters
+    ProfileCategory m_category;
+};
+
+/// @brief Single producer (the owning thread), single consumer (EndFrame) ring buffer
+struct ThreadSampleBuffer
+{
+    std::array<Sample, Profiling::ThreadBufferCapacity> m_samples;
+    std::atomic<uint32_t> m_writeIdx = 0;
+    std::atomic<uint32_t> m_readIdx = 0;
+
+    bool Push(const Sample& sample)
+    {
+        const auto writeIdx = m_writeIdx.load(std::memory_order_relaxed);
+        const auto readIdx = m_readIdx.load(std::memory_order_acquire);
+        if (writeIdx - readIdx >= Profiling::ThreadBufferCapacity)
+        {
+            return false;
+        }
+
+        m_samples[writeIdx % Profiling::ThreadBufferCapacity] = sample;
+        m_writeIdx.store(writeIdx + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename Function>
+    void Drain(Function&& function)
+    {
+        auto readIdx = m_readIdx.load(std::memory_order_relaxed);
+        const auto writeIdx = m_writeIdx.load(std::memory_order_acquire);
+        for (; readIdx != writeIdx; ++readIdx)
+        {
+            function(m_samples[readIdx % Profiling::ThreadBufferCapacity]);
+        }
+        m_readIdx.store(readIdx, std::memory_order_release);
+    }
+};
+
+std::atomic<bool> g_enabled = true;
+std::atomic<uint64_t> g_droppedSampleCount = 0;
+
+// Buffers are created on a thread's first sample and live as long as the application, worker threads are never torn down
+std::mutex g_threadBuffersMutex;
+Vector<ThreadSampleBuffer*> g_threadBuffers;
+
+ThreadSampleBuffer* GetThreadBuffer()
+{
+    thread_local ThreadSampleBuffer* pThreadBuffer = nullptr;
+    if (pThreadBuffer == nullptr)
+    {
+        pThreadBuffer = aln::New<ThreadSampleBuffer>();
+
+        std::lock_guard lock(g_threadBuffersMutex);
+        g_threadBuffers.push_back(pThreadBuffer);
+    }
+    return pThreadBuffer;
+}
+
+void PushSample(const Sample& sample)
+{
+    if (!GetThreadBuffer()->Push(sample))
+    {
+        g_droppedSampleCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// -------------------------------------------------
+// Aggregation. Only touched by the frame loop thread
+// -------------------------------------------------
+
+struct ScopeEntry
+{
+    const char* m_name = nullptr;
+    ProfileCategory m_category = ProfileCategory::Custom;
+    float m_budgetMs = 0.0f;
+
+    int64_t m_frameValue = 0;
+    uint32_t m_frameCallCount = 0;
+
+    float m_lastFrameValue = 0.0f;
+    uint32_t m_lastFrameCallCount = 0;
+    uint64_t m_totalCallCount = 0;
+
+    // Rolling window of per-frame values
+    Array<float, Profiling::RollingWindowFrameCount> m_history = {};
+    uint32_t m_historyCount = 0;
+    uint32_t m_historyHead = 0;
+
+    void PushFrameValue(float value)
+    {
+        m_history[m_historyHead] = value;
+        m_historyHead = (m_historyHead + 1) % Profiling::RollingWindowFrameCount;
+        m_historyCount = std::min(m_historyCount + 1, Profiling::RollingWindowFrameCount);
+    }
+};
+
+struct CategoryEntries
+{
+    HashMap<const void*, uint32_t, std::hash<const void*>> m_entryIndicesByPointer; // Fast path, the same call site always passes the same pointer
+    HashMap<std::string, uint32_t, std::hash<std::string>> m_entryIndicesByName;    // Different pointers can hold the same name
+};
+
+Vector<ScopeEntry> g_entries;
+std::array<CategoryEntries, (size_t) ProfileCategory::Count> g_categoryEntries;
+
+std::chrono::steady_clock::time_point g_clockStart = std::chrono::steady_clock::now();
+int64_t g_frameStartTimestamp = 0;
+uint64_t g_frameIdx = 0;
+
+Event<const ProfileBudgetExceededInfo&> g_budgetExceededEvent;
+
+uint32_t FindOrCreateEntry(const char* name, ProfileCategory category)
+{
+    assert(name != nullptr && category < ProfileCategory::Count);
+
+    auto& categoryEntries = g_categoryEntries[(size_t) category];
+
+    auto pointerIt = categoryEntries.m_entryIndicesByPointer.find(name);
+    if (pointerIt != categoryEntries.m_entryIndicesByPointer.end())
+    {
+        return pointerIt->second;
+    }
+
+    uint32_t entryIdx;
+    auto nameIt = categoryEntries.m_entryIndicesByName.find(name);
+    if (nameIt != categoryEntries.m_entryIndicesByName.end())
+    {
+        entryIdx = nameIt->second;
+    }
+    else
+    {
+        entryIdx = g_entries.size();
+        auto& entry = g_entries.emplace_back();
+        entry.m_name = name;
+        entry.m_category = category;
+        categoryEntries.m_entryIndicesByName.emplace(name, entryIdx);
+    }
+
+    categoryEntries.m_entryIndicesByPointer.emplace(name, entryIdx);
+    return entryIdx;
+}
+
+float ToFrameValue(const ScopeEntry& entry)
+{
+    if (entry.m_category == ProfileCategory::Counter)
+    {
+        return (float) entry.m_frameValue;
+    }
+    return (float) ((double) entry.m_frameValue / 1'000'000.0);
+}
+
+void WriteJSONString(std::ostream& stream, const char* str)
+{
+    stream << '"';
+    for (; *str != '\0'; ++str)
+    {
+        if (*str == '"' || *str == '\\')
+        {
+            stream << '\\';
+        }
+        stream << *str;
+    }
+    stream << '"';
+}
+} // namespace
+
+namespace Profiling
+{
+int64_t GetTimestamp()
+{
+    // Offset from a start point so that 0 is never a valid timestamp
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - g_clockStart).count() + 1;
+}
+
+void RecordScope(const char* name, ProfileCategory category, int64_t startTimestamp, int64_t endTimestamp)
+{
+    assert(category != ProfileCategory::Counter);
+    assert(endTimestamp >= startTimestamp);
+    PushSample({.m_name = name, .m_value = endTimestamp - startTimestamp, .m_category = category});
+}
+
+void IncrementCounter(const char* name, int64_t value)
+{
+    if (IsEnabled())
+    {
+        PushSample({.m_name = name, .m_value = value, .m_category = ProfileCategory::Counter});
+    }
+}
+
+void SetEnabled(bool enabled) { g_enabled.store(enabled, std::memory_order_relaxed); }
+bool IsEnabled() { return g_enabled.load(std::memory_order_relaxed); }
+
+void BeginFrame()
+{
+    g_frameStartTimestamp = IsEnabled() ? GetTimestamp() : 0;
+}
+
+void EndFrame()
+{
+    if (g_frameStartTimestamp != 0)
+    {
+        RecordScope("Frame", ProfileCategory::Frame, g_frameStartTimestamp, GetTimestamp());
+        g_frameStartTimestamp = 0;
+    }
+
+    {
+        std::lock_guard lock(g_threadBuffersMutex);
+        for (auto pThreadBuffer : g_threadBuffers)
+        {
+            pThreadBuffer->Drain([](const Sample& sample)
+                {
+                    auto& entry = g_entries[FindOrCreateEntry(sample.m_name, sample.m_category)];
+                    entry.m_frameValue += sample.m_value;
+                    entry.m_frameCallCount++;
+                });
+        }
+    }
+
+    for (auto& entry : g_entries)
+    {
+        const auto frameValue = ToFrameValue(entry);
+
+        entry.m_lastFrameValue = frameValue;
+        entry.m_lastFrameCallCount = entry.m_frameCallCount;
+        entry.m_totalCallCount += entry.m_frameCallCount;
+        entry.PushFrameValue(frameValue);
+
+        if (entry.m_budgetMs > 0.0f && frameValue > entry.m_budgetMs)
+        {
+            ProfileBudgetExceededInfo info = {
+                .m_name = entry.m_name,
+                .m_category = entry.m_category,
+                .m_budgetMs = entry.m_budgetMs,
+                .m_frameTimeMs = frameValue,
+                .m_frameIdx = g_frameIdx,
+            };
+            g_budgetExceededEvent.Fire(info);
+        }
+
+        entry.m_frameValue = 0;
+        entry.m_frameCallCount = 0;
+    }
+
+    g_frameIdx++;
+}
+
+void SetBudget(const char* name, ProfileCategory category, float budgetMs)
+{
+    assert(category != ProfileCategory::Counter);
+    assert(budgetMs >= 0.0f);
+    g_entries[FindOrCreateEntry(name, category)].m_budgetMs = budgetMs;
+}
+
+Event<const ProfileBudgetExceededInfo&>& GetBudgetExceededEvent() { return g_budgetExceededEvent; }
+
+Vector<ProfileScopeStats> GetScopeStats()
+{
+    Vector<ProfileScopeStats> stats;
+    stats.reserve(g_entries.size());
+
+    Array<float, RollingWindowFrameCount> sortedHistory;
+    for (const auto& entry : g_entries)
+    {
+        auto& entryStats = stats.emplace_back();
+        entryStats.m_name = entry.m_name;
+        entryStats.m_category = entry.m_category;
+        entryStats.m_lastFrameValue = entry.m_lastFrameValue;
+        entryStats.m_lastFrameCallCount = entry.m_lastFrameCallCount;
+        entryStats.m_totalCallCount = entry.m_totalCallCount;
+
+        const auto count = entry.m_historyCount;
+        if (count == 0)
+        {
+            continue;
+        }
+
+        std::copy(entry.m_history.begin(), entry.m_history.begin() + count, sortedHistory.begin());
+        std::sort(sortedHistory.begin(), sortedHistory.begin() + count);
+
+        float sum = 0.0f;
+        for (uint32_t idx = 0; idx < count; ++idx)
+        {
+            sum += sortedHistory[idx];
+        }
+
+        // Nearest-rank percentiles
+        auto percentile = [&](float p)
+        { return sortedHistory[(uint32_t) (p * (count - 1) + 0.5f)]; };
+
+        entryStats.m_average = sum / count;
+        entryStats.m_p50 = percentile(0.50f);
+        entryStats.m_p95 = percentile(0.95f);
+        entryStats.m_p99 = percentile(0.99f);
+        entryStats.m_max = sortedHistory[count - 1];
+    }
+
+    return stats;
+}
+
+uint64_t GetDroppedSampleCount() { return g_droppedSampleCount.load(std::memory_order_relaxed); }
+
+void WriteCSV(std::ostream& stream)
+{
+    stream << "category,name,last_frame,last_frame_calls,average,p50,p95,p99,max,total_calls\n";
+    for (const auto& stats : GetScopeStats())
+    {
+        stream << GetCategoryName(stats.m_category) << ",\"" << stats.m_name << "\"," << stats.m_lastFrameValue << ","
+               << stats.m_lastFrameCallCount << "," << stats.m_average << "," << stats.m_p50 << "," << stats.m_p95 << ","
+               << stats.m_p99 << "," << stats.m_max << "," << stats.m_totalCallCount << "\n";
+    }
+}
+
+void WriteJSON(std::ostream& stream)
+{
+    stream << "{\"frame\":" << g_frameIdx << ",\"window_frames\":" << RollingWindowFrameCount << ",\"dropped_samples\":" << GetDroppedSampleCount() << ",\"scopes\":[";
+
+    bool first = true;
+    for (const auto& stats : GetScopeStats())
+    {
+        if (!first)
+        {
+            stream << ",";
+        }
+        first = false;
+
+        stream << "{\"category\":\"" << GetCategoryName(stats.m_category) << "\",\"name\":";
+        WriteJSONString(stream, stats.m_name);
+        stream << ",\"last_frame\":" << stats.m_lastFrameValue << ",\"last_frame_calls\":" << stats.m_lastFrameCallCount
+               << ",\"average\":" << stats.m_average << ",\"p50\":" << stats.m_p50 << ",\"p95\":" << stats.m_p95
+               << ",\"p99\":" << stats.m_p99 << ",\"max\":" << stats.m_max << ",\"total_calls\":" << stats.m_totalCallCount << "}";
+    }
+
+    stream << "]}";
+}
+
+const char* GetCategoryName(ProfileCategory category)
+{
+    constexpr std::array<const char*, (size_t) ProfileCategory::Count> CategoryNames = {
+        "Frame",
+        "UpdateStage",
+        "EntitySystem",
+        "WorldSystem",
+        "AssetLoader",
+        "RenderPass",
+        "Custom",
+        "Counter",
+    };
+    assert(category < ProfileCategory::Count);
+    return CategoryNames[(size_t) category];
+}
+
+const char* GetUpdateStageName(UpdateStage stage)
+{
+    constexpr std::array<const char*, (size_t) UpdateStage::NumStages> StageNames = {
+        "FrameStart",
+        "PrePhysics",
+        "Physics",
+        "PostPhysics",
+        "FrameEnd",
+    };
+    assert(stage < UpdateStage::NumStages);
+    return StageNames[(size_t) stage];
+}
+} // namespace Profiling
+} // namespace aln
@@ -0,0 +1,97 @@
+#include "runtime_id.hpp"
+
+#include "memory.hpp"
+
+namespace aln
+{
+RuntimeIDPool::~RuntimeIDPool()
+{
+    for (auto& block : m_blocks)
+    {
+        auto pBlock = block.load(std::memory_order_relaxed);
+        if (pBlock != nullptr)
+        {
+            aln::Free(pBlock);
+        }
+    }
+}
+
+RuntimeIDPool::Slot& RuntimeIDPool::GetSlot(uint32_t index)
+{
+    const auto blockIndex = index / BlockSize;
+    assert(blockIndex < MaxBlockCount);
+
+    auto& block = m_blocks[blockIndex];
+    auto pBlock = block.load(std::memory_order_acquire);
+    if (pBlock == nullptr)
+    {
+        // Several threads might race to allocate the block, only one of them wins
+        auto pNewBlock = (Slot*) aln::Allocate(sizeof(Slot) * BlockSize, alignof(Slot));
+        for (uint32_t slotIndex = 0; slotIndex < BlockSize; ++slotIndex)
+        {
+            aln::PlacementNew<Slot>(&pNewBlock[slotIndex]);
+        }
+
+        if (block.compare_exchange_strong(pBlock, pNewBlock, std::memory_order_acq_rel))
+        {
+            pBlock = pNewBlock;
+        }
+        else
+        {
+            aln::Free(pNewBlock);
+        }
+    }
+    return pBlock[index % BlockSize];
+}
+
+uint64_t RuntimeIDPool::Allocate()
+{
+    // Recycle a released slot if possible
+    auto head = m_freeListHead.load(std::memory_order_acquire);
+    while (GetIndex(head) != EmptyFreeList)
+    {
+        const auto index = GetIndex(head);
+        auto& slot = GetSlot(index);
+
+        const auto newHead = MakeValue(slot.m_nextFreeIndex.load(std::memory_order_relaxed), GetGeneration(head) + 1);
+        if (m_freeListHead.compare_exchange_weak(head, newHead, std::memory_order_acq_rel))
+        {
+            return MakeValue(index, slot.m_generation.load(std::memory_order_relaxed));
+        }
+    }
+
+    // Otherwise use a new one
+    const auto index = m_nextUnusedIndex.fetch_add(1, std::memory_order_relaxed);
+    assert(index != EmptyFreeList);
+
+    auto& slot = GetSlot(index);
+    return MakeValue(index, slot.m_generation.load(std::memory_order_relaxed));
+}
+
+void RuntimeIDPool::Release(uint64_t value)
+{
+    const auto index = GetIndex(value);
+    auto& slot = GetSlot(index);
+
+    // Invalidate the existing handles
+    auto expectedGeneration = GetGeneration(value);
+    [[maybe_unused]] const auto wasAlive = slot.m_generation.compare_exchange_strong(expectedGeneration, expectedGeneration + 1, std::memory_order_relaxed);
+    assert(wasAlive); // Double release
+
+    auto head = m_freeListHead.load(std::memory_order_relaxed);
+    do
+    {
+        slot.m_nextFreeIndex.store(GetIndex(head), std::memory_order_relaxed);
+    } while (!m_freeListHead.compare_exchange_weak(head, MakeValue(index, GetGeneration(head) + 1), std::memory_order_release, std::memory_order_relaxed));
+}
+
+bool RuntimeIDPool::IsAlive(uint64_t value)
+{
+    const auto index = GetIndex(value);
+    if (index >= m_nextUnusedIndex.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+    return GetSlot(index).m_generation.load(std::memory_order_relaxed) == GetGeneration(value);
+}
+} // namespace aln
@@ -2,6 +2,197 @@
 
 namespace aln
 {
+// --------------------
+// File archive
+// --------------------
+
+BinaryFileArchive::BinaryFileArchive(const std::filesystem::path& path, IOMode mode) : IBinaryArchive(mode), m_path(path)
+{
+    m_pBuffer = (std::byte*) aln::Allocate(BufferSize);
+
+    // Buffering is handled by the archive itself
+    if (IsReading())
+    {
+        auto pFileStream = aln::New<std::ifstream>();
+        pFileStream->rdbuf()->pubsetbuf(nullptr, 0);
+        pFileStream->open(path, std::ios::binary | std::ios::in);
+        m_pFileStream = pFileStream;
+    }
+    else
+    {
+        auto pFileStream = aln::New<std::ofstream>();
+        pFileStream->rdbuf()->pubsetbuf(nullptr, 0);
+        pFileStream->open(path, std::ios::binary | std::ios::out);
+        m_pFileStream = pFileStream;
+    }
+}
+
+BinaryFileArchive::~BinaryFileArchive()
+{
+    assert(m_pFileStream != nullptr);
+
+    if (IsReading())
+    {
+        auto pFileStream = reinterpret_cast<std::ifstream*>(m_pFileStream);
+        aln::Delete(pFileStream);
+    }
+    else
+    {
+        FlushBuffer();
+        auto pFileStream = reinterpret_cast<std::ofstream*>(m_pFileStream);
+        aln::Delete(pFileStream);
+    }
+
+    aln::Free(m_pBuffer);
+}
+
+bool BinaryFileArchive::Close()
+{
+    assert(m_pFileStream != nullptr);
+    if (IsReading())
+    {
+        auto pFileStream = reinterpret_cast<std::ifstream*>(m_pFileStream);
+        pFileStream->close();
+        return !m_hasReadPastEnd;
+    }
+    else
+    {
+        FlushBuffer();
+        auto pFileStream = reinterpret_cast<std::ofstream*>(m_pFileStream);
+        pFileStream->close();
+        return !pFileStream->fail();
+    }
+}
+
+bool BinaryFileArchive::IsValid() const
+{
+    if (IsReading())
+    {
+        auto pFileStream = reinterpret_cast<std::ifstream*>(m_pFileStream);
+        return pFileStream->is_open() && !m_hasReadPastEnd;
+    }
+    else
+    {
+        auto pFileStream = reinterpret_cast<std::ofstream*>(m_pFileStream);
+        return pFileStream->is_open();
+    }
+}
+
+void BinaryFileArchive::FlushBuffer()
+{
+    assert(IsWriting());
+    if (m_bufferPosition > 0)
+    {
+        auto pFileStream = reinterpret_cast<std::ofstream*>(m_pFileStream);
+        pFileStream->write(reinterpret_cast<const char*>(m_pBuffer), m_bufferPosition);
+        m_bufferPosition = 0;
+    }
+}
+
+void BinaryFileArchive::WriteUnbuffered(const void* pData, size_t size)
+{
+    FlushBuffer();
+    if (size < BufferSize)
+    {
+        memcpy(m_pBuffer, pData, size);
+        m_bufferPosition = size;
+    }
+    else
+    {
+        auto pFileStream = reinterpret_cast<std::ofstream*>(m_pFileStream);
+        pFileStream->write(reinterpret_cast<const char*>(pData), size);
+    }
+}
+
+void BinaryFileArchive::ReadUnbuffered(void* pData, size_t size)
+{
+    auto pFileStream = reinterpret_cast<std::ifstream*>(m_pFileStream);
+    auto pBytes = reinterpret_cast<std::byte*>(pData);
+
+    // Once the end has been reached, every following read yields zeros. Sizes read back as 0, so
+    // deserialization runs to completion without allocating for garbage, and the caller checks IsValid() afterwards
+    if (m_hasReadPastEnd)
+    {
+        memset(pBytes, 0, size);
+        return;
+    }
+
+    // Consume what is left in the buffer
+    const auto bufferedSize = m_bufferSize - m_bufferPosition;
+    memcpy(pBytes, m_pBuffer + m_bufferPosition, bufferedSize);
+    pBytes += bufferedSize;
+    size -= bufferedSize;
+    m_bufferPosition = 0;
+    m_bufferSize = 0;
+
+    size_t readSize;
+    if (size >= BufferSize)
+    {
+        pFileStream->read(reinterpret_cast<char*>(pBytes), size);
+        readSize = (size_t) pFileStream->gcount();
+    }
+    else
+    {
+        pFileStream->read(reinterpret_cast<char*>(m_pBuffer), BufferSize);
+        m_bufferSize = (size_t) pFileStream->gcount();
+
+        readSize = std::min(size, m_bufferSize);
+        memcpy(pBytes, m_pBuffer, readSize);
+        m_bufferPosition = readSize;
+    }
+
+    if (readSize < size)
+    {
+        memset(pBytes + readSize, 0, size - readSize);
+        m_hasReadPastEnd = true;
+    }
+}
+
+size_t BinaryFileArchive::BeginSizedBlock()
+{
+    assert(IsWriting());
+    FlushBuffer();
+
+    auto pFileStream = reinterpret_cast<std::ofstream*>(m_pFileStream);
+    auto blockStartPosition = (size_t) pFileStream->tellp();
+
+    Vector<std::byte>::size_type placeholderSize = 0;
+    Write(&placeholderSize, sizeof(placeholderSize));
+
+    return blockStartPosition;
+}
+
+void BinaryFileArchive::EndSizedBlock(size_t blockStartPosition)
+{
+    assert(IsWriting());
+    FlushBuffer();
+
+    auto pFileStream = reinterpret_cast<std::ofstream*>(m_pFileStream);
+    auto blockEndPosition = pFileStream->tellp();
+
+    Vector<std::byte>::size_type blockSize = (size_t) blockEndPosition - blockStartPosition - sizeof(blockSize);
+    pFileStream->seekp(blockStartPosition);
+    pFileStream->write(reinterpret_cast<const char*>(&blockSize), sizeof(blockSize));
+    pFileStream->seekp(blockEndPosition);
+}
+
+// --------------------
+// Memory archive
+// --------------------
+
+void BinaryMemoryArchive::Flush()
+{
+    if (m_pStreamTarget != nullptr && !m_memory.empty())
+    {
+        m_pStreamTarget->Write(m_memory.data(), m_memory.size());
+        m_memory.clear();
+    }
+}
+
+// --------------------
+// Interop
+// --------------------
+
 /// @brief Save the full file in memory
 BinaryMemoryArchive& operator<<(BinaryMemoryArchive& out, BinaryFileArchive& in)
 {
@@ -9,9 +200,12 @@ BinaryMemoryArchive& operator<<(BinaryMemoryArchive& out, BinaryFileArchive& in)
     auto pFileStream = reinterpret_cast<std::ifstream*>(in.m_pFileStream);
 
     // Find the file's size
+    pFileStream->clear();
     pFileStream->seekg(0, pFileStream->end);
     auto size = (size_t) pFileStream->tellg();
     pFileStream->seekg(0, pFileStream->beg);
+    in.m_bufferPosition = 0;
+    in.m_bufferSize = 0;
 
     // Write the archive size
     out << size;
@@ -22,6 +216,10 @@ BinaryMemoryArchive& operator<<(BinaryMemoryArchive& out, BinaryFileArchive& in)
 
     auto pEnd = out.m_memory.data() + originalSize;
     pFileStream->read(reinterpret_cast<char*>(pEnd), size);
+    if ((size_t) pFileStream->gcount() < size)
+    {
+        in.m_hasReadPastEnd = true;
+    }
 
     return out;
 };
@@ -32,6 +230,7 @@ BinaryMemoryArchive& operator>>(BinaryMemoryArchive& in, BinaryFileArchive& out)
     auto pFileStream = reinterpret_cast<std::ofstream*>(out.m_pFileStream);
 
     // Overwrite the content of the file by reopening it
+    out.m_bufferPosition = 0;
     pFileStream->close();
     pFileStream->open(out.m_path, std::ios::binary | std::ios::out);
 
@@ -40,7 +239,7 @@ BinaryMemoryArchive& operator>>(BinaryMemoryArchive& in, BinaryFileArchive& out)
     in >> size;
 
     // Write the data from the current reading position to the end
-    pFileStream->write(reinterpret_cast<const char*>(in.m_memory.data()), size);
+    pFileStream->write(reinterpret_cast<const char*>(&*in.m_pReader), size);
 
     // Update the reader ptr to point to the new end
     in.m_pReader += size;
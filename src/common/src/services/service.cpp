@@ -0,0 +1,21 @@
+#include "services/service.hpp"
+
+#include "containers/hash_map.hpp"
+#include "string_id.hpp"
+
+#include <assert.h>
+#include <mutex>
+
+namespace aln
+{
+uint32_t ServiceSlots::GetOrAllocate(const char* typeName)
+{
+    static std::mutex mutex;
+    static HashMap<StringID, uint32_t> slots;
+
+    std::lock_guard lock(mutex);
+    auto [it, emplaced] = slots.try_emplace(StringID(typeName), (uint32_t) slots.size());
+    assert(it->second < MaxServiceTypes); // Increase MaxServiceTypes
+    return it->second;
+}
+} // namespace aln
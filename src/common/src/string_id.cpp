@@ -1,6 +1,59 @@
 #include "string_id.hpp"
 
+#ifdef ALN_DEBUG
+#include <assert.h>
+#include <mutex>
+#include <shared_mutex>
+#endif
+
 namespace aln
 {
-StringID StringID::InvalidID = StringID((uint32_t) 0);
-}
\ No newline at end of file
+#ifdef ALN_DEBUG
+namespace
+{
+/// @brief Global table of the strings hashed at runtime, keyed by hash. Nodes are never removed, so views of the strings stay valid
+struct StringIDDebugTable
+{
+    std::shared_mutex m_mutex;
+    HashMap<StringID::HashType, std::string> m_strings;
+};
+
+StringIDDebugTable& GetDebugTable()
+{
+    static StringIDDebugTable table;
+    return table;
+}
+} // namespace
+
+void StringID::RegisterDebugString(HashType hash, std::string_view str)
+{
+    auto& table = GetDebugTable();
+    {
+        std::shared_lock lock(table.m_mutex);
+        auto it = table.m_strings.find(hash);
+        if (it != table.m_strings.end())
+        {
+            assert(it->second == str); // Hash collision
+            return;
+        }
+    }
+
+    std::unique_lock lock(table.m_mutex);
+    table.m_strings.try_emplace(hash, std::string(str));
+}
+#endif
+
+std::string_view StringID::GetDebugString() const
+{
+#ifdef ALN_DEBUG
+    auto& table = GetDebugTable();
+    std::shared_lock lock(table.m_mutex);
+    auto it = table.m_strings.find(m_hash);
+    if (it != table.m_strings.end())
+    {
+        return it->second;
+    }
+#endif
+    return {};
+}
+} // namespace aln
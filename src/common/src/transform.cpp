@@ -1,13 +1,56 @@
 #include "transform.hpp"
 
 #include "maths/matrix4x4.hpp"
+#include "maths/wide.hpp"
 
 namespace aln
 {
 
+void Transform::ComposeKernel(const Transform& a, const Transform& b, Transform& result)
+{
+    assert(a.m_rotation.IsNormalized() && b.m_rotation.IsNormalized());
+
+    const auto aRotation = a.m_rotation.ToSIMD();
+    const auto aScale = SIMD::Load3(&a.m_scale.x);
+
+    const auto scaledTranslation = SIMD::Mul(aScale, SIMD::Load3(&b.m_translation.x));
+    const auto translation = SIMD::Add(SIMD::Load3(&a.m_translation.x), Quaternion::RotateVectorSIMD(aRotation, scaledTranslation));
+    const auto rotation = Quaternion::NormalizeSIMD(Quaternion::MultiplySIMD(aRotation, b.m_rotation.ToSIMD())); // Same order as matrices
+    const auto scale = SIMD::Mul(aScale, SIMD::Load3(&b.m_scale.x));
+
+    SIMD::Store3(&result.m_translation.x, translation);
+    result.m_rotation.SetFromSIMD(rotation);
+    SIMD::Store3(&result.m_scale.x, scale);
+}
+
+void Transform::InterpolateKernel(const Transform& a, const Transform& b, float factor, Transform& result)
+{
+    const auto t = SIMD::Splat(factor);
+    const auto translation = SIMD::Lerp(SIMD::Load3(&a.m_translation.x), SIMD::Load3(&b.m_translation.x), t);
+    const auto rotation = Quaternion::SlerpSIMD(a.m_rotation.ToSIMD(), b.m_rotation.ToSIMD(), factor);
+    const auto scale = SIMD::Lerp(SIMD::Load3(&a.m_scale.x), SIMD::Load3(&b.m_scale.x), t);
+
+    SIMD::Store3(&result.m_translation.x, translation);
+    result.m_rotation.SetFromSIMD(rotation);
+    SIMD::Store3(&result.m_scale.x, scale);
+
+    assert(result.m_rotation.IsNormalized());
+}
+
 Matrix4x4 Transform::ToMatrix() const
 {
-    return m_translation.ToTranslationMatrix() * m_rotation.ToMatrix() * m_scale.ToScalingMatrix();
+    // Equivalent to T * R * S, without the intermediate matrix products
+    const auto& q = m_rotation;
+    const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+    Matrix4x4 matrix;
+    matrix[0] = {(1.0f - 2.0f * (yy + zz)) * m_scale.x, 2.0f * (xy + wz) * m_scale.x, 2.0f * (xz - wy) * m_scale.x, 0.0f};
+    matrix[1] = {2.0f * (xy - wz) * m_scale.y, (1.0f - 2.0f * (xx + zz)) * m_scale.y, 2.0f * (yz + wx) * m_scale.y, 0.0f};
+    matrix[2] = {2.0f * (xz + wy) * m_scale.z, 2.0f * (yz - wx) * m_scale.z, (1.0f - 2.0f * (xx + yy)) * m_scale.z, 0.0f};
+    matrix[3] = {m_translation.x, m_translation.y, m_translation.z, 1.0f};
+    return matrix;
 }
 
 Transform Transform::GetInverse() const
@@ -16,8 +59,14 @@ Transform Transform::GetInverse() const
     inverse.m_scale.x = Maths::SafeDivide(1.0f, m_scale.x);
     inverse.m_scale.y = Maths::SafeDivide(1.0f, m_scale.y);
     inverse.m_scale.z = Maths::SafeDivide(1.0f, m_scale.z);
-    inverse.m_rotation = m_rotation.Inversed();
-    inverse.m_translation = inverse.m_rotation.RotateVector(inverse.m_scale.Scale(m_translation) * - 1.0f);
+
+    const auto conjugate = SIMD::Mul(m_rotation.ToSIMD(), SIMD::Set(1.0f, -1.0f, -1.0f, -1.0f));
+    const auto rotation = SIMD::Div(conjugate, SIMD::Dot4(conjugate, conjugate));
+    const auto scaledTranslation = SIMD::Mul(SIMD::Load3(&inverse.m_scale.x), SIMD::Load3(&m_translation.x));
+    const auto translation = Quaternion::RotateVectorSIMD(rotation, SIMD::Sub(SIMD::Zero(), scaledTranslation));
+
+    inverse.m_rotation.SetFromSIMD(rotation);
+    SIMD::Store3(&inverse.m_translation.x, translation);
 
     return inverse;
 }
@@ -36,19 +85,77 @@ bool Transform::operator!=(const Transform& rhs) const
 
 Transform& Transform::operator*=(const Transform& b)
 {
-    m_translation = m_translation + m_rotation.RotateVector(m_scale.Scale(b.m_translation));
-    m_rotation = (m_rotation * b.m_rotation).Normalized(); // glm quaternion multiplication is the same as matrices
-    m_scale = m_scale.Scale(b.m_scale);
+    ComposeKernel(*this, b, *this);
     return *this;
 }
 
 Transform Transform::operator*(const Transform& b) const
 {
-    Transform res = *this;
-    res *= b;
+    Transform res;
+    ComposeKernel(*this, b, res);
     return res;
 }
 
+void Transform::ComposeBatch(Span<const Transform> a, Span<const Transform> b, Span<Transform> results)
+{
+    assert(a.size() == results.size() && b.size() == results.size());
+
+    // Four transforms at a time, all loaded before any result is stored so that results can alias the inputs
+    const auto count = results.size();
+    auto i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const auto aRotation = WideQuaternion::Load(a[i].m_rotation, a[i + 1].m_rotation, a[i + 2].m_rotation, a[i + 3].m_rotation);
+        const auto aTranslation = WideVec3::Load(a[i].m_translation, a[i + 1].m_translation, a[i + 2].m_translation, a[i + 3].m_translation);
+        const auto aScale = WideVec3::Load(a[i].m_scale, a[i + 1].m_scale, a[i + 2].m_scale, a[i + 3].m_scale);
+        const auto bRotation = WideQuaternion::Load(b[i].m_rotation, b[i + 1].m_rotation, b[i + 2].m_rotation, b[i + 3].m_rotation);
+        const auto bTranslation = WideVec3::Load(b[i].m_translation, b[i + 1].m_translation, b[i + 2].m_translation, b[i + 3].m_translation);
+        const auto bScale = WideVec3::Load(b[i].m_scale, b[i + 1].m_scale, b[i + 2].m_scale, b[i + 3].m_scale);
+
+        const auto translation = WideVec3::Add(aTranslation, WideQuaternion::RotateVector(aRotation, WideVec3::Mul(aScale, bTranslation)));
+        const auto rotation = WideQuaternion::Normalize(WideQuaternion::Multiply(aRotation, bRotation));
+        const auto scale = WideVec3::Mul(aScale, bScale);
+
+        translation.Store(results[i].m_translation, results[i + 1].m_translation, results[i + 2].m_translation, results[i + 3].m_translation);
+        rotation.Store(results[i].m_rotation, results[i + 1].m_rotation, results[i + 2].m_rotation, results[i + 3].m_rotation);
+        scale.Store(results[i].m_scale, results[i + 1].m_scale, results[i + 2].m_scale, results[i + 3].m_scale);
+    }
+    for (; i < count; ++i)
+    {
+        ComposeKernel(a[i], b[i], results[i]);
+    }
+}
+
+void Transform::InterpolateBatch(Span<const Transform> a, Span<const Transform> b, float factor, Span<Transform> results)
+{
+    assert(a.size() == results.size() && b.size() == results.size());
+
+    const auto t = SIMD::Splat(factor);
+    const auto count = results.size();
+    auto i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const auto aRotation = WideQuaternion::Load(a[i].m_rotation, a[i + 1].m_rotation, a[i + 2].m_rotation, a[i + 3].m_rotation);
+        const auto aTranslation = WideVec3::Load(a[i].m_translation, a[i + 1].m_translation, a[i + 2].m_translation, a[i + 3].m_translation);
+        const auto aScale = WideVec3::Load(a[i].m_scale, a[i + 1].m_scale, a[i + 2].m_scale, a[i + 3].m_scale);
+        const auto bRotation = WideQuaternion::Load(b[i].m_rotation, b[i + 1].m_rotation, b[i + 2].m_rotation, b[i + 3].m_rotation);
+        const auto bTranslation = WideVec3::Load(b[i].m_translation, b[i + 1].m_translation, b[i + 2].m_translation, b[i + 3].m_translation);
+        const auto bScale = WideVec3::Load(b[i].m_scale, b[i + 1].m_scale, b[i + 2].m_scale, b[i + 3].m_scale);
+
+        const auto translation = WideVec3::Lerp(aTranslation, bTranslation, t);
+        const auto rotation = WideQuaternion::Slerp(aRotation, bRotation, factor);
+        const auto scale = WideVec3::Lerp(aScale, bScale, t);
+
+        translation.Store(results[i].m_translation, results[i + 1].m_translation, results[i + 2].m_translation, results[i + 3].m_translation);
+        rotation.Store(results[i].m_rotation, results[i + 1].m_rotation, results[i + 2].m_rotation, results[i + 3].m_rotation);
+        scale.Store(results[i].m_scale, results[i + 1].m_scale, results[i + 2].m_scale, results[i + 3].m_scale);
+    }
+    for (; i < count; ++i)
+    {
+        InterpolateKernel(a[i], b[i], factor, results[i]);
+    }
+}
+
 const Transform Transform::Identity = Transform();
 
-} // namespace aln
\ No newline at end of file
+} // namespace aln
@@ -0,0 +1,85 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <common/containers/vector.hpp>
+#include <common/serialization/binary_archive.hpp>
+
+#include <filesystem>
+
+namespace aln
+{
+namespace
+{
+std::filesystem::path GetTestFilePath(const char* name)
+{
+    return std::filesystem::temp_directory_path() / name;
+}
+} // namespace
+
+TEST_CASE("Binary file archive round trip", "[serialization]")
+{
+    const auto path = GetTestFilePath("aln_binary_archive_round_trip.bin");
+
+    Vector<uint32_t> smallVector = {1, 2, 3};
+    Vector<std::byte> largeVector(1024 * 1024, std::byte(0xAB));
+    {
+        BinaryFileArchive archive(path, IBinaryArchive::IOMode::Write);
+        archive << 42u;
+        archive << smallVector;
+        archive << largeVector;
+    }
+
+    uint32_t value = 0;
+    Vector<uint32_t> readSmallVector;
+    Vector<std::byte> readLargeVector;
+    {
+        BinaryFileArchive archive(path, IBinaryArchive::IOMode::Read);
+        archive >> value;
+        archive >> readSmallVector;
+        archive >> readLargeVector;
+        REQUIRE(archive.IsValid());
+    }
+
+    REQUIRE(value == 42u);
+    REQUIRE(readSmallVector == smallVector);
+    REQUIRE(readLargeVector == largeVector);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Binary file archive reads past the end", "[serialization]")
+{
+    const auto path = GetTestFilePath("aln_binary_archive_truncated.bin");
+    {
+        BinaryFileArchive archive(path, IBinaryArchive::IOMode::Write);
+        archive << (uint16_t) 7;
+    }
+
+    SECTION("Small read")
+    {
+        BinaryFileArchive archive(path, IBinaryArchive::IOMode::Read);
+        uint64_t value = 0xFFFFFFFFFFFFFFFF;
+        archive >> value;
+        REQUIRE_FALSE(archive.IsValid());
+        REQUIRE(value == 7);
+
+        // Following reads yield zeros, so containers come back empty
+        Vector<uint32_t> vector = {1, 2, 3};
+        archive >> vector;
+        REQUIRE(vector.empty());
+        REQUIRE_FALSE(archive.IsValid());
+    }
+
+    SECTION("Large read")
+    {
+        BinaryFileArchive archive(path, IBinaryArchive::IOMode::Read);
+        Vector<std::byte> data(1024 * 1024, std::byte(0xAB));
+        archive.Read(data.data(), data.size());
+        REQUIRE_FALSE(archive.IsValid());
+        REQUIRE(data[0] == std::byte(7));
+        REQUIRE(data[2] == std::byte(0));
+        REQUIRE(data.back() == std::byte(0));
+    }
+
+    std::filesystem::remove(path);
+}
+} // namespace aln
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <common/containers/vector.hpp>
+#include <common/maths/quaternion.hpp>
+#include <common/maths/vec3.hpp>
+#include <common/transform.hpp>
+
+#include <glm/glm.hpp>
+#include <glm/gtx/quaternion.hpp>
+#include <glm/gtx/transform.hpp>
+
+#include <random>
+
+/// --------------------------
+/// Reference implementations of the transform operations on top of glm, which the previous implementation converted to for every operation.
+/// Shared by the tests checking the SIMD kernels and by the maths benchmark
+/// --------------------------
+
+namespace aln
+{
+inline glm::vec3 ToGLM(const Vec3& vec) { return glm::vec3(vec.x, vec.y, vec.z); }
+inline glm::quat ToGLM(const Quaternion& quat) { return glm::quat(quat.w, quat.x, quat.y, quat.z); }
+inline Vec3 FromGLM(const glm::vec3& vec) { return Vec3(vec.x, vec.y, vec.z); }
+inline Quaternion FromGLM(const glm::quat& quat) { return Quaternion(quat.w, quat.x, quat.y, quat.z); }
+
+inline Transform ComposeGLM(const Transform& a, const Transform& b)
+{
+    const auto aRotation = ToGLM(a.GetRotation());
+    const auto translation = ToGLM(a.GetTranslation()) + glm::rotate(aRotation, ToGLM(a.GetScale()) * ToGLM(b.GetTranslation()));
+    const auto rotation = glm::normalize(aRotation * ToGLM(b.GetRotation()));
+    const auto scale = ToGLM(a.GetScale()) * ToGLM(b.GetScale());
+    return Transform(FromGLM(translation), FromGLM(rotation), FromGLM(scale));
+}
+
+inline Transform InverseGLM(const Transform& transform)
+{
+    const auto scale = 1.0f / ToGLM(transform.GetScale());
+    const auto rotation = glm::inverse(ToGLM(transform.GetRotation()));
+    const auto translation = glm::rotate(rotation, scale * ToGLM(transform.GetTranslation()) * -1.0f);
+    return Transform(FromGLM(translation), FromGLM(rotation), FromGLM(scale));
+}
+
+inline Transform InterpolateGLM(const Transform& a, const Transform& b, float factor)
+{
+    const auto translation = glm::mix(ToGLM(a.GetTranslation()), ToGLM(b.GetTranslation()), factor);
+    const auto rotation = glm::slerp(ToGLM(a.GetRotation()), ToGLM(b.GetRotation()), factor);
+    const auto scale = glm::mix(ToGLM(a.GetScale()), ToGLM(b.GetScale()), factor);
+    return Transform(FromGLM(translation), FromGLM(rotation), FromGLM(scale));
+}
+
+inline glm::mat4x4 ToMatrixGLM(const Transform& transform)
+{
+    return glm::translate(ToGLM(transform.GetTranslation())) * glm::toMat4(ToGLM(transform.GetRotation())) * glm::scale(ToGLM(transform.GetScale()));
+}
+
+/// @brief Random transforms with normalized rotations and positive scales
+inline Vector<Transform> GenerateTransforms(uint32_t count, uint32_t seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scaleDistribution(0.5f, 2.0f);
+
+    Vector<Transform> transforms;
+    transforms.reserve(count);
+    for (auto i = 0; i < count; ++i)
+    {
+        const auto translation = Vec3(distribution(generator), distribution(generator), distribution(generator)) * 10.0f;
+        const auto rotation = Quaternion(distribution(generator), distribution(generator), distribution(generator), distribution(generator)).Normalized();
+        const auto scale = Vec3(scaleDistribution(generator), scaleDistribution(generator), scaleDistribution(generator));
+        transforms.emplace_back(translation, rotation, scale);
+    }
+    return transforms;
+}
+} // namespace aln
@@ -0,0 +1,37 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <common/serialization/hash.hpp>
+
+#include <string>
+
+namespace aln
+{
+// Reference values from the xxHash library, with a null seed
+static_assert(hash::detail::XXH32("", 0) == 0x02CC5D05);
+static_assert(hash::detail::XXH64("", 0) == 0xEF46DB3751D8E999);
+static_assert(hash::detail::XXH32("The quick brown fox jumps over the lazy dog", 0) == 0xE85EA4DE);
+static_assert(hash::detail::XXH64("The quick brown fox jumps over the lazy dog", 0) == 0x0B242D361FDA71BC);
+
+TEST_CASE("Compile-time hashes match the xxHash library", "[hash]")
+{
+    // Every length up to 64 goes through the stripe loops and all the tail paths. Bytes above 0x7F check the unsigned reads
+    std::string data;
+    for (auto length = 0; length <= 64; ++length)
+    {
+        for (const uint32_t seed : {0u, hash::Seed})
+        {
+            REQUIRE(hash::detail::XXH32(data, seed) == XXH32(data.data(), data.size(), seed));
+            REQUIRE(hash::detail::XXH64(data, seed) == XXH64(data.data(), data.size(), seed));
+        }
+        data.push_back((char) (length * 37 + 11));
+    }
+}
+
+TEST_CASE("Hashes folded at compile time match the runtime ones", "[hash]")
+{
+    constexpr auto hash32 = Hash32("SpeedParameter");
+    constexpr auto hash64 = Hash64("SpeedParameter");
+    REQUIRE(hash32 == Hash32(std::string("SpeedParameter")));
+    REQUIRE(hash64 == Hash64(std::string("SpeedParameter")));
+}
+} // namespace aln
@@ -0,0 +1,199 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "glm_reference.hpp"
+
+#include <common/containers/vector.hpp>
+#include <common/maths/matrix4x4.hpp>
+#include <common/maths/quaternion.hpp>
+#include <common/maths/vec3.hpp>
+#include <common/transform.hpp>
+
+/// --------------------------
+/// Compares the SIMD math kernels with the previous implementation, which converted to glm types for every operation.
+/// Not part of the test suite: run the maths_benchmark executable directly, in an optimized build. Results are checked by the transform tests
+/// --------------------------
+
+namespace aln
+{
+namespace
+{
+constexpr uint32_t TransformCount = 1024;
+} // namespace
+
+TEST_CASE("Transform composition", "[benchmark]")
+{
+    const auto a = GenerateTransforms(TransformCount, 1);
+    const auto b = GenerateTransforms(TransformCount, 2);
+    Vector<Transform> results(TransformCount);
+
+    BENCHMARK("glm")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            results[i] = ComposeGLM(a[i], b[i]);
+        }
+        return results.back();
+    };
+
+    BENCHMARK("SIMD")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            results[i] = a[i] * b[i];
+        }
+        return results.back();
+    };
+
+    BENCHMARK("SIMD batch")
+    {
+        Transform::ComposeBatch(a, b, results);
+        return results.back();
+    };
+}
+
+TEST_CASE("Transform inverse", "[benchmark]")
+{
+    const auto transforms = GenerateTransforms(TransformCount, 3);
+    Vector<Transform> results(TransformCount);
+
+    BENCHMARK("glm")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            results[i] = InverseGLM(transforms[i]);
+        }
+        return results.back();
+    };
+
+    BENCHMARK("SIMD")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            results[i] = transforms[i].GetInverse();
+        }
+        return results.back();
+    };
+}
+
+TEST_CASE("Transform interpolation", "[benchmark]")
+{
+    const auto a = GenerateTransforms(TransformCount, 4);
+    const auto b = GenerateTransforms(TransformCount, 5);
+    Vector<Transform> results(TransformCount);
+    constexpr float factor = 0.3f;
+
+    BENCHMARK("glm")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            results[i] = InterpolateGLM(a[i], b[i], factor);
+        }
+        return results.back();
+    };
+
+    BENCHMARK("SIMD")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            results[i] = Transform::Interpolate(a[i], b[i], factor);
+        }
+        return results.back();
+    };
+
+    BENCHMARK("SIMD batch")
+    {
+        Transform::InterpolateBatch(a, b, factor, results);
+        return results.back();
+    };
+}
+
+TEST_CASE("Transform to matrix", "[benchmark]")
+{
+    const auto transforms = GenerateTransforms(TransformCount, 6);
+    Vector<glm::mat4x4> glmResults(TransformCount);
+    Vector<Matrix4x4> results(TransformCount);
+
+    BENCHMARK("glm")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            glmResults[i] = ToMatrixGLM(transforms[i]);
+        }
+        return glmResults.back();
+    };
+
+    BENCHMARK("Direct")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            results[i] = transforms[i].ToMatrix();
+        }
+        return results.back();
+    };
+}
+
+TEST_CASE("Quaternion operations", "[benchmark]")
+{
+    const auto a = GenerateTransforms(TransformCount, 7);
+    const auto b = GenerateTransforms(TransformCount, 8);
+    Vector<Quaternion> aRotations, bRotations;
+    Vector<Vec3> vectors;
+    for (auto i = 0; i < TransformCount; ++i)
+    {
+        aRotations.push_back(a[i].GetRotation());
+        bRotations.push_back(b[i].GetRotation());
+        vectors.push_back(b[i].GetTranslation());
+    }
+    Vector<Quaternion> results(TransformCount);
+    Vector<Vec3> rotatedVectors(TransformCount);
+
+    BENCHMARK("Multiply - glm")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            results[i] = FromGLM(ToGLM(aRotations[i]) * ToGLM(bRotations[i]));
+        }
+        return results.back();
+    };
+
+    BENCHMARK("Multiply - SIMD batch")
+    {
+        Quaternion::MultiplyBatch(aRotations, bRotations, results);
+        return results.back();
+    };
+
+    BENCHMARK("Slerp - glm")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            results[i] = FromGLM(glm::slerp(ToGLM(aRotations[i]), ToGLM(bRotations[i]), 0.3f));
+        }
+        return results.back();
+    };
+
+    BENCHMARK("Slerp - SIMD batch")
+    {
+        Quaternion::SlerpBatch(aRotations, bRotations, 0.3f, results);
+        return results.back();
+    };
+
+    BENCHMARK("Rotate vector - glm")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            rotatedVectors[i] = FromGLM(glm::rotate(ToGLM(aRotations[i]), ToGLM(vectors[i])));
+        }
+        return rotatedVectors.back();
+    };
+
+    BENCHMARK("Rotate vector - SIMD")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            rotatedVectors[i] = aRotations[i].RotateVector(vectors[i]);
+        }
+        return rotatedVectors.back();
+    };
+}
+} // namespace aln
@@ -0,0 +1,88 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <common/runtime_id.hpp>
+
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace aln
+{
+struct TestIDTag
+{
+    static RuntimeIDPool& GetIDPool()
+    {
+        static RuntimeIDPool pool;
+        return pool;
+    }
+};
+using TestID = RuntimeID<TestIDTag>;
+
+TEST_CASE("Runtime ID generation", "[runtime_id]")
+{
+    SECTION("Default IDs are invalid")
+    {
+        TestID id;
+        REQUIRE_FALSE(id.IsValid());
+        REQUIRE_FALSE(id.IsAlive());
+    }
+
+    SECTION("Released slots are recycled with a new generation")
+    {
+        auto a = TestID::Generate();
+        REQUIRE(a.IsAlive());
+
+        TestID::Release(a);
+        REQUIRE_FALSE(a.IsAlive());
+
+        auto b = TestID::Generate();
+        REQUIRE(b.IsAlive());
+        REQUIRE(b.GetIndex() == a.GetIndex());
+        REQUIRE(b.GetGeneration() != a.GetGeneration());
+        REQUIRE(a != b);
+
+        TestID::Release(b);
+    }
+}
+
+TEST_CASE("Concurrent runtime ID generation", "[runtime_id]")
+{
+    constexpr uint32_t ThreadCount = 8;
+    constexpr uint32_t IDsPerThread = 10000;
+
+    std::mutex mutex;
+    std::set<uint64_t> liveIDs;
+    bool duplicateFound = false;
+
+    std::vector<std::thread> threads;
+    for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&]()
+            {
+            std::vector<TestID> ids;
+            for (uint32_t i = 0; i < IDsPerThread; ++i)
+            {
+                ids.push_back(TestID::Generate());
+                if (i % 3 == 0)
+                {
+                    TestID::Release(ids.back());
+                    ids.pop_back();
+                }
+            }
+
+            std::lock_guard lock(mutex);
+            for (const auto& id : ids)
+            {
+                duplicateFound |= !liveIDs.insert(id.GetValue()).second;
+            } });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    REQUIRE_FALSE(duplicateFound);
+}
+} // namespace aln
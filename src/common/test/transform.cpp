@@ -1,5 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include "glm_reference.hpp"
+
 #include <common/transform.hpp>
 #include <common/maths/vec3.hpp>
 #include <common/maths/quaternion.hpp>
@@ -8,6 +10,23 @@
 
 namespace aln
 {
+namespace
+{
+// Not a multiple of four, so that the batch kernels run both their four-wide path and the single element remainder
+constexpr uint32_t TransformCount = 259;
+
+// Tolerances for the rounding differences between the kernels and glm. Translations go up to a few tens of units
+constexpr float TranslationTolerance = 1e-4f;
+constexpr float Tolerance = 1e-5f;
+
+bool IsNearEqual(const Transform& a, const Transform& b)
+{
+    return a.GetTranslation().IsNearEqual(b.GetTranslation(), TranslationTolerance) &&
+           a.GetRotation().IsNearEqual(b.GetRotation(), Tolerance) &&
+           a.GetScale().IsNearEqual(b.GetScale(), Tolerance);
+}
+} // namespace
+
 TEST_CASE("Identity Transform", "[transform]")
 {
     SECTION("Identity is correct")
@@ -64,4 +83,179 @@ TEST_CASE("Transform inverse", "[transform]")
     auto t = Transform(Vec3(52.0f, -4.0f, 0.0f), Quaternion(0.5f, 0.8f, 0.1f, 0.3).Normalized(), Vec3(4.0f, 5.0f, -7.0f));
     REQUIRE(t.GetInverse() * t == Transform::Identity);
 }
-} // namespace aln
\ No newline at end of file
+
+// The SIMD kernels are checked against glm. The same cases run with the scalar fallback in the tests_scalar_maths target
+TEST_CASE("Transform kernels match glm", "[transform]")
+{
+    const auto a = GenerateTransforms(TransformCount, 1);
+    const auto b = GenerateTransforms(TransformCount, 2);
+    Vector<Transform> results(TransformCount);
+
+    SECTION("Composition")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            REQUIRE(IsNearEqual(a[i] * b[i], ComposeGLM(a[i], b[i])));
+        }
+
+        Transform::ComposeBatch(a, b, results);
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            REQUIRE(IsNearEqual(results[i], ComposeGLM(a[i], b[i])));
+        }
+    }
+
+    SECTION("Inverse")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            REQUIRE(IsNearEqual(a[i].GetInverse(), InverseGLM(a[i])));
+        }
+    }
+
+    SECTION("Interpolation")
+    {
+        for (const auto factor : {0.0f, 0.3f, 1.0f})
+        {
+            for (auto i = 0; i < TransformCount; ++i)
+            {
+                REQUIRE(IsNearEqual(Transform::Interpolate(a[i], b[i], factor), InterpolateGLM(a[i], b[i], factor)));
+            }
+
+            Transform::InterpolateBatch(a, b, factor, results);
+            for (auto i = 0; i < TransformCount; ++i)
+            {
+                REQUIRE(IsNearEqual(results[i], InterpolateGLM(a[i], b[i], factor)));
+            }
+        }
+    }
+
+    SECTION("To matrix")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            auto matrix = a[i].ToMatrix();
+            const auto expectedMatrix = ToMatrixGLM(a[i]);
+            for (auto column = 0; column < 4; ++column)
+            {
+                for (auto row = 0; row < 4; ++row)
+                {
+                    REQUIRE(Maths::IsNearEqual(matrix[column][row], expectedMatrix[column][row], TranslationTolerance));
+                }
+            }
+        }
+    }
+
+    SECTION("Batches aliasing their inputs")
+    {
+        results = a;
+        Transform::ComposeBatch(results, b, results);
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            REQUIRE(IsNearEqual(results[i], ComposeGLM(a[i], b[i])));
+        }
+
+        results = a;
+        Transform::InterpolateBatch(results, b, 0.3f, results);
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            REQUIRE(IsNearEqual(results[i], InterpolateGLM(a[i], b[i], 0.3f)));
+        }
+    }
+}
+
+TEST_CASE("Quaternion kernels match glm", "[transform]")
+{
+    const auto a = GenerateTransforms(TransformCount, 3);
+    const auto b = GenerateTransforms(TransformCount, 4);
+
+    Vector<Quaternion> aRotations, bRotations;
+    for (auto i = 0; i < TransformCount; ++i)
+    {
+        aRotations.push_back(a[i].GetRotation());
+        bRotations.push_back(b[i].GetRotation());
+    }
+    Vector<Quaternion> results(TransformCount);
+
+    SECTION("Multiplication")
+    {
+        Quaternion::MultiplyBatch(aRotations, bRotations, results);
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            const auto expected = FromGLM(ToGLM(aRotations[i]) * ToGLM(bRotations[i]));
+            REQUIRE((aRotations[i] * bRotations[i]).IsNearEqual(expected, Tolerance));
+            REQUIRE(results[i].IsNearEqual(expected, Tolerance));
+        }
+    }
+
+    SECTION("Slerp")
+    {
+        Quaternion::SlerpBatch(aRotations, bRotations, 0.3f, results);
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            const auto expected = FromGLM(glm::slerp(ToGLM(aRotations[i]), ToGLM(bRotations[i]), 0.3f));
+            REQUIRE(Quaternion::Slerp(aRotations[i], bRotations[i], 0.3f).IsNearEqual(expected, Tolerance));
+            REQUIRE(results[i].IsNearEqual(expected, Tolerance));
+        }
+    }
+
+    SECTION("NLerp")
+    {
+        Quaternion::NLerpBatch(aRotations, bRotations, 0.3f, results);
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            const auto aQuat = ToGLM(aRotations[i]);
+            const auto bQuat = ToGLM(bRotations[i]);
+            const auto bWeight = glm::dot(aQuat, bQuat) < 0.0f ? -0.3f : 0.3f;
+            const auto expected = FromGLM(glm::normalize(aQuat * 0.7f + bQuat * bWeight));
+            REQUIRE(Quaternion::NLerp(aRotations[i], bRotations[i], 0.3f).IsNearEqual(expected, Tolerance));
+            REQUIRE(results[i].IsNearEqual(expected, Tolerance));
+        }
+    }
+
+    SECTION("Normalization")
+    {
+        Vector<Quaternion> scaledRotations;
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            const auto& rotation = aRotations[i];
+            const auto scale = 0.5f + (float) i / TransformCount;
+            scaledRotations.emplace_back(rotation.w * scale, rotation.x * scale, rotation.y * scale, rotation.z * scale);
+        }
+        scaledRotations[1] = Quaternion(0.0f, 0.0f, 0.0f, 0.0f);
+
+        Quaternion::NormalizeBatch(scaledRotations, results);
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            const auto expected = (i == 1) ? Quaternion::Identity : aRotations[i];
+            REQUIRE(scaledRotations[i].Normalized().IsNearEqual(expected, Tolerance));
+            REQUIRE(results[i].IsNearEqual(expected, Tolerance));
+        }
+    }
+
+    SECTION("Vector rotation")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            const auto& vector = b[i].GetTranslation();
+            REQUIRE(aRotations[i].RotateVector(vector).IsNearEqual(FromGLM(glm::rotate(ToGLM(aRotations[i]), ToGLM(vector))), TranslationTolerance));
+        }
+    }
+
+    SECTION("To matrix")
+    {
+        for (auto i = 0; i < TransformCount; ++i)
+        {
+            auto matrix = aRotations[i].ToMatrix();
+            const auto expectedMatrix = glm::toMat4(ToGLM(aRotations[i]));
+            for (auto column = 0; column < 4; ++column)
+            {
+                for (auto row = 0; row < 4; ++row)
+                {
+                    REQUIRE(Maths::IsNearEqual(matrix[column][row], expectedMatrix[column][row], Tolerance));
+                }
+            }
+        }
+    }
+}
+} // namespace aln
@@ -39,7 +39,10 @@ class AnimationLoader : public IAssetLoader
 
         pAnim->m_frameCount = pAnim->m_tracks[0].m_transforms.size();
 
-        archive >> pAnim->m_rootMotionTrack;
+        // Bake root motion so that runtime deltas are a couple of lookups
+        Vector<Transform> rootMotionTransforms;
+        archive >> rootMotionTransforms;
+        pAnim->m_rootMotionTrack.Bake(rootMotionTransforms);
 
         // TMP: Explicitely creates a default sync track
         pAnim->m_syncTrack = SyncTrack::Default;
@@ -14,9 +14,13 @@ class MaterialLoader : public IAssetLoader
     RenderEngine* m_pRenderEngine;
 
   public:
+    /// @param pDevice: Null for headless engines, in which case no material buffer is created
     MaterialLoader(RenderEngine* pDevice)
     {
         m_pRenderEngine = pDevice;
+
+        // Materials are only reached through their meshes' handles
+        SetReloadableWhileReferenced(true);
     }
 
     bool Load(AssetRequestContext& ctx, AssetRecord* pRecord, BinaryMemoryArchive& archive) override
@@ -31,6 +35,12 @@ class MaterialLoader : public IAssetLoader
         archive >> id;
         pMaterial->m_albedoMap = AssetHandle<Texture>(id);
 
+        if (m_pRenderEngine == nullptr)
+        {
+            pRecord->SetAsset(pMaterial);
+            return true;
+        }
+
         // TMP while materials are poopy
         pMaterial->m_buffer.Initialize(m_pRenderEngine, sizeof(MaterialBufferObject), vk::BufferUsageFlagBits::eUniformBuffer, vk::MemoryPropertyFlagBits::eHostCoherent | vk::MemoryPropertyFlagBits::eHostVisible);
         m_pRenderEngine->SetDebugUtilsObjectName(pMaterial->m_buffer.GetVkBuffer(), "Material Buffer Object");
@@ -47,8 +57,11 @@ class MaterialLoader : public IAssetLoader
 
     void Unload(AssetRecord* pRecord)
     {
-        auto pMaterial = pRecord->GetAsset<Material>();
-        pMaterial->m_buffer.Shutdown();
+        if (m_pRenderEngine != nullptr)
+        {
+            auto pMaterial = pRecord->GetAsset<Material>();
+            pMaterial->m_buffer.Shutdown();
+        }
     }
 
     void InstallDependencies(AssetRecord* pAssetRecord, const Vector<IAssetHandle>& dependencies) override
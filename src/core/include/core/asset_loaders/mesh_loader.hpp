@@ -19,9 +19,30 @@ class MeshLoader : public IAssetLoader
 
     static constexpr uint32_t STAGING_BUFFER_SIZE = 64 * 1000 * 1000 * 8;
 
+    /// @brief Read the geometry data common to all mesh types
+    /// @note Expected format: | Bounds | Bytes per index | Indices (bytes) | Vertices (bytes) |
+    static void ReadGeometry(BinaryMemoryArchive& archive, Mesh* pMesh)
+    {
+        uint8_t bytesPerIndex;
+
+        archive >> pMesh->m_bounds;
+        archive >> bytesPerIndex;
+        archive >> pMesh->m_indices;
+        archive >> pMesh->m_vertices;
+
+        assert(bytesPerIndex == sizeof(uint16_t) || bytesPerIndex == sizeof(uint32_t));
+        pMesh->m_indexType = (bytesPerIndex == sizeof(uint16_t)) ? vk::IndexType::eUint16 : vk::IndexType::eUint32;
+        pMesh->m_indexCount = pMesh->m_indices.size() / bytesPerIndex;
+    }
+
   public:
+    /// @param pDevice: Null for headless engines. Meshes then only hold their CPU data
     MeshLoader(RenderEngine* pDevice) : m_pRenderEngine(pDevice)
     {
+        SetCPUResidency(m_pRenderEngine != nullptr ? CPUResidency::ReleaseAfterUpload : CPUResidency::Keep);
+
+        // Components reach meshes through their handles, and the graphics system is notified when one is reloaded
+        SetReloadableWhileReferenced(true);
     }
 
     ~MeshLoader()
@@ -42,8 +63,7 @@ class MeshLoader : public IAssetLoader
         {
             SkeletalMesh* pSkeletalMesh = aln::New<SkeletalMesh>();
 
-            archive >> pSkeletalMesh->m_indices;
-            archive >> pSkeletalMesh->m_vertices;
+            ReadGeometry(archive, pSkeletalMesh);
             archive >> pSkeletalMesh->m_boneNames;
             archive >> pSkeletalMesh->m_parentBoneIndices;
             archive >> pSkeletalMesh->m_inverseBindPose;
@@ -64,20 +84,25 @@ class MeshLoader : public IAssetLoader
 
             StaticMesh* pStaticMesh = aln::New<StaticMesh>();
 
-            archive >> pStaticMesh->m_indices;
-            archive >> pStaticMesh->m_vertices;
+            ReadGeometry(archive, pStaticMesh);
 
             pMesh = pStaticMesh;
         }
 
         assert(!pMesh->m_indices.empty() && !pMesh->m_vertices.empty());
 
+        if (m_pRenderEngine == nullptr)
+        {
+            pRecord->SetAsset(pMesh);
+            return true;
+        }
+
         /// @todo GPU buffers could be all be kept in the renderer itself (in one large buffer that we index into)
         // Create and fill the vulkan buffers to back the mesh.
         pMesh->m_vertexBuffer.Initialize(m_pRenderEngine, pMesh->m_vertices.size(), vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eVertexBuffer, vk::MemoryPropertyFlagBits::eDeviceLocal);
         ctx.UploadBufferThroughStaging(pMesh->m_vertices, pMesh->m_vertexBuffer);
-        
-        pMesh->m_indexBuffer.Initialize(m_pRenderEngine, pMesh->m_indices.size() * sizeof(uint32_t), vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eIndexBuffer, vk::MemoryPropertyFlagBits::eDeviceLocal);
+
+        pMesh->m_indexBuffer.Initialize(m_pRenderEngine, pMesh->m_indices.size(), vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eIndexBuffer, vk::MemoryPropertyFlagBits::eDeviceLocal);
         ctx.UploadBufferThroughStaging(pMesh->m_indices, pMesh->m_indexBuffer);
 
         pRecord->SetAsset(pMesh);
@@ -85,13 +110,25 @@ class MeshLoader : public IAssetLoader
         return true;
     }
 
+    void ReleaseCPUData(AssetRecord* pRecord) override
+    {
+        auto pMesh = pRecord->GetAsset<Mesh>();
+        pMesh->m_indices.clear();
+        pMesh->m_indices.shrink_to_fit();
+        pMesh->m_vertices.clear();
+        pMesh->m_vertices.shrink_to_fit();
+    }
+
     void Unload(AssetRecord* pRecord) override
     {
         auto pMesh = pRecord->GetAsset<Mesh>();
         pMesh->m_indices.clear();
         pMesh->m_vertices.clear();
-        pMesh->m_indexBuffer.Shutdown();
-        pMesh->m_vertexBuffer.Shutdown();
+        if (m_pRenderEngine != nullptr)
+        {
+            pMesh->m_indexBuffer.Shutdown();
+            pMesh->m_vertexBuffer.Shutdown();
+        }
 
         if (pRecord->GetAssetTypeID() == SkeletalMesh::GetStaticAssetTypeID())
         {
@@ -111,6 +148,11 @@ class MeshLoader : public IAssetLoader
         const auto pMaterialRecord = GetDependencyRecord(dependencies, 0);
         UpdateDependencyRecord(pMesh->m_pMaterial, pMaterialRecord);
 
+        if (m_pRenderEngine == nullptr)
+        {
+            return;
+        }
+
         pMesh->m_descriptorSet = m_pRenderEngine->AllocateDescriptorSet<Mesh>();
         auto textureDescriptor = pMesh->m_pMaterial->GetAlbedoMap()->GetDescriptor();
         auto materialDescriptor = pMesh->GetMaterial()->GetBuffer().GetDescriptor();
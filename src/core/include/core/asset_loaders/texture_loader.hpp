@@ -3,6 +3,7 @@
 #include <assets/asset.hpp>
 #include <assets/loader.hpp>
 #include <assets/request_context.hpp>
+#include <common/texture_format.hpp>
 #include <graphics/resources/buffer.hpp>
 #include <graphics/resources/image.hpp>
 
@@ -16,12 +17,35 @@ class TextureLoader : public IAssetLoader
   private:
     RenderEngine* m_pRenderEngine;
 
+    static vk::Format GetVkFormat(TextureFormat format, bool isSRGB)
+    {
+        switch (format)
+        {
+        case TextureFormat::RGBA8:
+            return isSRGB ? vk::Format::eR8G8B8A8Srgb : vk::Format::eR8G8B8A8Unorm;
+        case TextureFormat::BC1:
+            return isSRGB ? vk::Format::eBc1RgbaSrgbBlock : vk::Format::eBc1RgbaUnormBlock;
+        case TextureFormat::BC3:
+            return isSRGB ? vk::Format::eBc3SrgbBlock : vk::Format::eBc3UnormBlock;
+        case TextureFormat::BC5:
+            return vk::Format::eBc5UnormBlock;
+        case TextureFormat::BC7:
+            return isSRGB ? vk::Format::eBc7SrgbBlock : vk::Format::eBc7UnormBlock;
+        }
+        assert(false);
+        return vk::Format::eUndefined;
+    }
+
   public:
+    /// @param pRenderEngine: Null for headless engines. Textures then only hold their CPU data
     TextureLoader(RenderEngine* pRenderEngine)
     {
         m_pRenderEngine = pRenderEngine;
-    }
+        SetCPUResidency(m_pRenderEngine != nullptr ? CPUResidency::ReleaseAfterUpload : CPUResidency::Keep);
 
+        // Textures are only reached through handles. The mesh descriptor sets referencing them are rebuilt when dependents are reinstalled
+        SetReloadableWhileReferenced(true);
+    }
 
     bool Load(AssetRequestContext& ctx, AssetRecord* pRecord, BinaryMemoryArchive& archive) override
     {
@@ -32,25 +56,55 @@ class TextureLoader : public IAssetLoader
 
         // TODO: Read directly from disk to gpu buffer
         // TODO: Also handle 2D/3D Textures here
-        // TODO: Replace with uint32_t
-        int width, height;
-        Vector<std::byte> data;
+        // Expected format: | Format | sRGB | Width | Height | Mip count | Mips data, from the largest to the smallest |
+        TextureFormat format;
+        bool isSRGB;
+        uint32_t storedMipLevels;
+
+        archive >> format;
+        archive >> isSRGB;
+        archive >> pTexture->m_width;
+        archive >> pTexture->m_height;
+        archive >> storedMipLevels;
+        archive >> pTexture->m_data;
+
+        const auto width = pTexture->m_width;
+        const auto height = pTexture->m_height;
+
+        // Compute the offset of each stored mip level in the data blob
+        Vector<vk::DeviceSize> mipOffsets;
+        mipOffsets.reserve(storedMipLevels);
+        vk::DeviceSize mipOffset = 0;
+        for (uint32_t mipLevel = 0; mipLevel < storedMipLevels; ++mipLevel)
+        {
+            mipOffsets.push_back(mipOffset);
+            mipOffset += GetMipByteSize(format, GetMipDimension(width, mipLevel), GetMipDimension(height, mipLevel));
+        }
+        assert(mipOffset == pTexture->m_data.size());
 
-        archive >> width;
-        archive >> height;
-        archive >> data;
+        if (m_pRenderEngine == nullptr)
+        {
+            pRecord->SetAsset(pTexture);
+            return true;
+        }
 
-        auto pGraphicsQueueSubmission = ctx.GetGraphicsQueueSubmission();
-        auto pTransferQueueSubmission = ctx.GetTransferQueueSubmission();
+        // Uncompressed textures converted without mips get them generated on the GPU. Compressed formats can't be blitted
+        const bool generateMips = storedMipLevels == 1 && !IsBlockCompressed(format);
+        const auto mipLevels = generateMips ? GetMipChainLength(width, height) : storedMipLevels;
+
+        vk::ImageUsageFlags usage = vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eSampled;
+        if (generateMips)
+        {
+            usage |= vk::ImageUsageFlagBits::eTransferSrc;
+        }
 
-        auto mipLevels = static_cast<uint32_t>(Maths::Floor(Maths::Log2(Maths::Max((float) width, (float) height)))) + 1;
         pTexture->m_image.Initialize(m_pRenderEngine,
             width, height,
             mipLevels,
             vk::SampleCountFlagBits::e1,
-            vk::Format::eR8G8B8A8Srgb,
+            GetVkFormat(format, isSRGB),
             vk::ImageTiling::eOptimal,
-            vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eSampled | vk::ImageUsageFlagBits::eTransferSrc,
+            usage,
             1,
             {},
             vk::ImageLayout::eUndefined,
@@ -58,6 +112,8 @@ class TextureLoader : public IAssetLoader
 
         pTexture->m_image.Allocate(vk::MemoryPropertyFlagBits::eDeviceLocal);
 
+        auto pTransferQueueSubmission = ctx.GetTransferQueueSubmission();
+
         // Transition layout to transferDstOptimal
         /*vk::HostImageLayoutTransitionInfoEXT transitionInfo = {
             .image = pTexture->m_image.GetVkImage(),
@@ -67,15 +123,16 @@ class TextureLoader : public IAssetLoader
 
         m_pRenderEngine->GetVkDevice().transitionImageLayoutEXT(transitionInfo);*/
         pTexture->m_image.TransitionLayout((vk::CommandBuffer) *pTransferQueueSubmission->GetCommandBuffer(), vk::ImageLayout::eTransferDstOptimal);
-        
-        // Upload to GPU
-        auto [pUploadFinishedSemaphore, uploadFinishedSemaphoreValue]  = ctx.UploadImageThroughStaging(data, pTexture->m_image);
+
+        // Upload all the stored mip levels to the GPU in a single copy
+        auto [pUploadFinishedSemaphore, uploadFinishedSemaphoreValue] = ctx.UploadImageThroughStaging(pTexture->m_data, pTexture->m_image, mipOffsets);
 
         // Optionnaly generate mipmaps
-        if (mipLevels > 1)
+        if (generateMips && mipLevels > 1)
         {
             // Blit commands can only be executed on graphics queues
             // Wait for the upload to be complete before starting
+            auto pGraphicsQueueSubmission = ctx.GetGraphicsQueueSubmission();
             pGraphicsQueueSubmission->WaitSemaphore(pUploadFinishedSemaphore, uploadFinishedSemaphoreValue);
             pTexture->m_image.GenerateMipMaps((vk::CommandBuffer) *pGraphicsQueueSubmission->GetCommandBuffer(), mipLevels);
         }
@@ -94,10 +151,21 @@ class TextureLoader : public IAssetLoader
         return true;
     }
 
+    void ReleaseCPUData(AssetRecord* pRecord) override
+    {
+        auto pTexture = pRecord->GetAsset<Texture>();
+        pTexture->m_data.clear();
+        pTexture->m_data.shrink_to_fit();
+    }
+
     void Unload(AssetRecord* pRecord) override
     {
         auto pTexture = pRecord->GetAsset<Texture>();
-        pTexture->m_image.Shutdown();
+        pTexture->m_data.clear();
+        if (m_pRenderEngine != nullptr)
+        {
+            pTexture->m_image.Shutdown();
+        }
     }
 };
 
@@ -40,7 +40,7 @@ class AnimationGraphComponent : public IComponent
 
   public:
     inline const Pose* GetPose() { return m_pPose; }
-    inline const Transform& GetRootMotionDelta() { return m_rootMotionDelta; }
+    inline const Transform& GetRootMotionDelta() const { return m_rootMotionDelta; }
 
     // --------- Control Parameters
 
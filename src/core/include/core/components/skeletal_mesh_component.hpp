@@ -28,6 +28,10 @@ class SkeletalMeshComponent : public MeshComponent
     Vector<Transform> m_boneTransforms;
     Vector<Matrix4x4> m_skinningTransforms;
 
+    // Bone transforms of the previous simulation tick, to interpolate rendering between ticks
+    Vector<Transform> m_previousBoneTransforms;
+    uint64_t m_previousPoseTick = InvalidSimulationTick;
+
     // Bone mapping between animation and render skeletons
     Vector<BoneIndex> m_animToRenderBonesMap;
 
@@ -46,6 +50,17 @@ class SkeletalMeshComponent : public MeshComponent
     {
         assert(pPose != nullptr);
 
+        const auto simulationTick = GetSimulationTick();
+        if (!IsSimulating())
+        {
+            m_previousPoseTick = InvalidSimulationTick;
+        }
+        else if (m_previousPoseTick != simulationTick)
+        {
+            m_previousBoneTransforms = m_boneTransforms;
+            m_previousPoseTick = simulationTick;
+        }
+
         // Map from animation to render bones
         auto animBoneCount = pPose->GetBonesCount();
         for (BoneIndex animBoneIdx = 0; animBoneIdx < animBoneCount; ++animBoneIdx)
@@ -60,16 +75,21 @@ class SkeletalMeshComponent : public MeshComponent
     void ResetPose()
     {
         m_boneTransforms = m_pMesh->GetBindPose();
+        m_previousPoseTick = InvalidSimulationTick;
     }
 
     /// @brief Number of render bones
     size_t GetBonesCount() const { return m_boneTransforms.size(); }
 
+    bool IsDebugSkeletonDrawingEnabled() const { return m_drawDebugSkeleton; }
+
   private:
-    /// @brief Compute the skinning matrices of the rendering skeleton from the current associated transforms
+    /// @brief Compute the skinning matrices of the rendering skeleton from the current associated transforms,
+    /// interpolated with the previous tick's pose if it changed during the last simulation tick
     void UpdateSkinningTransforms();
 
-    void Initialize() override
+    /// @brief Build the bone mapping and reset the pose from the current mesh and skeleton, i.e. when the mesh was reloaded
+    void InitializeBones()
     {
         assert(m_pMesh.IsLoaded() && m_pSkeleton.IsLoaded());
         assert(m_pMesh->m_bindPose.size() > 0);
@@ -92,9 +112,16 @@ class SkeletalMeshComponent : public MeshComponent
         pose.CalculateGlobalTransforms();
         SetPose(&pose);*/
 
+        m_previousBoneTransforms.clear();
+        m_previousPoseTick = InvalidSimulationTick;
+
         m_skinningTransforms.resize(m_pMesh->m_bindPose.size());
         UpdateSkinningTransforms();
+    }
 
+    void Initialize() override
+    {
+        InitializeBones();
         MeshComponent::Initialize();
     }
 
@@ -103,6 +130,8 @@ class SkeletalMeshComponent : public MeshComponent
         m_animToRenderBonesMap.clear();
         m_skinningTransforms.clear();
         m_boneTransforms.clear();
+        m_previousBoneTransforms.clear();
+        m_previousPoseTick = InvalidSimulationTick;
         MeshComponent::Shutdown();
     }
 
@@ -2,67 +2,49 @@
 
 #include <common/containers/vector.hpp>
 #include <common/maths/matrix4x4.hpp>
+#include <common/profiling.hpp>
+#include <common/vertex.hpp>
 #include <graphics/pipeline.hpp>
+#include <graphics/render_engine.hpp>
 #include <graphics/rendering/renderer.hpp>
 #include <graphics/resources/buffer.hpp>
 
+#include <algorithm>
+
 namespace aln
 {
 
+/// @brief Debug lines drawing resources.
+/// Vertices are written to a persistently mapped ring of per-frame regions, one for each frame in flight,
+/// so that uploading a frame never stalls on the GPU reading the previous ones
 class LinesRenderState
 {
-    friend class GraphicsSystem;
-
     static constexpr uint32_t MaxLinesPerDrawCall = 10000;
+    static constexpr uint32_t MaxLinesPerFrame = 100000;
+
+    static constexpr uint32_t MaxVerticesPerDrawCall = MaxLinesPerDrawCall * 2;
+    static constexpr uint32_t MaxVerticesPerFrame = MaxLinesPerFrame * 2;
+    static constexpr vk::DeviceSize FrameRegionSize = MaxVerticesPerFrame * sizeof(DebugVertex);
 
-    struct UBO
+    struct PushConstant
     {
         Matrix4x4 m_viewProjectionMatrix;
     };
 
   private:
     Pipeline m_pipeline;
-
     GPUBuffer m_vertexBuffer;
-    GPUBuffer m_viewProjectionUBO;
-    vk::DescriptorSet m_descriptorSet;
 
   public:
-    void Initialize(RenderEngine* pRenderEngine, IRenderer* pRenderer)
+    void Initialize(RenderEngine* pRenderEngine, IRenderer* pRenderer, const vk::Extent2D& extent)
     {
-        auto bufferSize = MaxLinesPerDrawCall * sizeof(DebugVertex) * 2;
+        auto bufferSize = FrameRegionSize * RenderEngine::GetFrameQueueSize();
 
-        // Create vertex buffer
+        // Create vertex buffer. Mapped for the whole lifetime of the render state
         m_vertexBuffer.Initialize(pRenderEngine, bufferSize, vk::BufferUsageFlagBits::eVertexBuffer, vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent);
         m_vertexBuffer.Map(0, bufferSize);
         pRenderEngine->SetDebugUtilsObjectName(m_vertexBuffer.GetVkBuffer(), "Debug Drawing Vertex Buffer");
 
-        // Create UBO
-        m_viewProjectionUBO.Initialize(pRenderEngine, sizeof(UBO), vk::BufferUsageFlagBits::eUniformBuffer, vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent);
-        m_viewProjectionUBO.Map();
-        pRenderEngine->SetDebugUtilsObjectName(m_vertexBuffer.GetVkBuffer(), "Debug Drawing UBO");
-
-        // Create descriptor set
-        m_descriptorSet = pRenderEngine->AllocateDescriptorSet<LinesRenderState>();
-        pRenderEngine->SetDebugUtilsObjectName(m_descriptorSet, "Lines Descriptor Set");
-
-        vk::DescriptorBufferInfo viewProjectionUBOInfo = {
-            .buffer = m_viewProjectionUBO.GetVkBuffer(),
-            .offset = 0,
-            .range = vk::WholeSize,
-        };
-
-        vk::WriteDescriptorSet writeDescriptorSet = {
-            .dstSet = m_descriptorSet,
-            .dstBinding = 0,
-            .dstArrayElement = 0,
-            .descriptorCount = 1,
-            .descriptorType = vk::DescriptorType::eUniformBuffer,
-            .pBufferInfo = &viewProjectionUBOInfo,
-        };
-
-        pRenderEngine->GetVkDevice().updateDescriptorSets(1, &writeDescriptorSet, 0, nullptr);
-
         // ---------------
         // Line drawing pipeline (used for debug)
         // ---------------
@@ -70,36 +52,59 @@ class LinesRenderState
         m_pipeline = Pipeline(pRenderEngine);
         m_pipeline.SetVertexType<DebugVertex>();
         m_pipeline.SetRenderPass(pRenderer->GetRenderPass().GetVkRenderPass());
-        //m_pipeline.SetExtent(pRenderer->GetExtent()); TODO
+        m_pipeline.SetExtent(extent);
         m_pipeline.RegisterShader(std::string(DEFAULT_SHADERS_DIR) + "/debug_line.vert", vk::ShaderStageFlagBits::eVertex);
         m_pipeline.RegisterShader(std::string(DEFAULT_SHADERS_DIR) + "/debug_line.frag", vk::ShaderStageFlagBits::eFragment);
-        m_pipeline.RegisterDescriptorLayout(pRenderEngine->GetDescriptorSetLayout<LinesRenderState>());
+        m_pipeline.AddPushConstant(vk::ShaderStageFlagBits::eVertex, 0, sizeof(PushConstant));
         m_pipeline.SetPrimitiveTopology(vk::PrimitiveTopology::eLineList);
         m_pipeline.SetDepthTestWriteEnable(false, true, vk::CompareOp::eAlways);
-        m_pipeline.Create("pipeline_cache_data.bin");
+        m_pipeline.Create("debug_lines_pipeline_cache_data.bin");
 
         pRenderEngine->SetDebugUtilsObjectName(m_pipeline.GetVkPipeline(), "Debug Lines Pipeline");
     }
 
     void Shutdown()
     {
+        m_pipeline.Shutdown();
+
         m_vertexBuffer.Unmap();
         m_vertexBuffer.Shutdown();
-
-        m_viewProjectionUBO.Unmap();
-        m_viewProjectionUBO.Shutdown();
     }
 
-    static Vector<vk::DescriptorSetLayoutBinding> GetDescriptorSetLayoutBindings()
+    /// @brief Upload the frame's lines to its region of the ring and record the draw calls, split to respect the per-draw limit.
+    /// Lines past the per-frame capacity are dropped
+    void Render(vk::CommandBuffer cb, uint32_t frameIdx, const Matrix4x4& viewProjectionMatrix, const Vector<DebugVertex>& vertices)
     {
-        Vector<vk::DescriptorSetLayoutBinding> bindings = {{
-            .binding = 0,
-            .descriptorType = vk::DescriptorType::eUniformBuffer,
-            .descriptorCount = 1,
-            .stageFlags = vk::ShaderStageFlagBits::eVertex,
-        }};
-
-        return bindings;
+        assert(vertices.size() % 2 == 0);
+        assert(frameIdx < RenderEngine::GetFrameQueueSize());
+
+        const uint32_t vertexCount = std::min((uint32_t) vertices.size(), MaxVerticesPerFrame);
+        if (vertexCount < vertices.size())
+        {
+            Profiling::IncrementCounter("DroppedDebugLines", (vertices.size() - vertexCount) / 2);
+        }
+
+        if (vertexCount == 0)
+        {
+            return;
+        }
+
+        const vk::DeviceSize frameRegionOffset = frameIdx * FrameRegionSize;
+        m_vertexBuffer.Copy(vertices.data(), vertexCount * sizeof(DebugVertex), frameRegionOffset);
+
+        PushConstant pushConstant = {
+            .m_viewProjectionMatrix = viewProjectionMatrix,
+        };
+
+        m_pipeline.Bind(cb);
+        cb.pushConstants(m_pipeline.GetLayout(), vk::ShaderStageFlagBits::eVertex, 0, sizeof(PushConstant), &pushConstant);
+        cb.bindVertexBuffers(0, m_vertexBuffer.GetVkBuffer(), frameRegionOffset);
+
+        for (uint32_t firstVertex = 0; firstVertex < vertexCount; firstVertex += MaxVerticesPerDrawCall)
+        {
+            const auto drawVertexCount = std::min(MaxVerticesPerDrawCall, vertexCount - firstVertex);
+            cb.draw(drawVertexCount, 1, firstVertex, 0);
+        }
     }
 };
-} // namespace aln
\ No newline at end of file
+} // namespace aln
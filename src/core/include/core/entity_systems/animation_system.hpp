@@ -22,13 +22,8 @@ class AnimationSystem : public IEntitySystem
     SkeletalMeshComponent* m_pSkeletalMeshComponent = nullptr;
 
   public:
-    AnimationSystem()
-    {
-        m_requiredUpdatePriorities.SetPriorityForStage(UpdateStage::FrameStart, 10);
-    }
+    AnimationSystem();
 
     void Update(const UpdateContext& ctx) override;
-    void RegisterComponent(IComponent* pComponent) override;
-    void UnregisterComponent(IComponent* pComponent) override;
 };
 } // namespace aln
\ No newline at end of file
@@ -17,13 +17,8 @@ class EditorCameraController : IEntitySystem
     ALN_REGISTER_TYPE();
 
   public:
-    EditorCameraController()
-    {
-        m_requiredUpdatePriorities.SetPriorityForStage(UpdateStage::FrameStart, 1);
-    }
+    EditorCameraController();
 
-    void RegisterComponent(IComponent* pComponent) override;
-    void UnregisterComponent(IComponent* pComponent) override;
     void Update(const UpdateContext& context) override;
 
   private:
@@ -27,15 +27,8 @@ class PlayerControllerSystem : public ScriptSystem
     Vec3 m_cameraRelativeForwardDirection2D = Vec3::WorldForward;
 
 public:
-    PlayerControllerSystem()
-    {
-        m_requiredUpdatePriorities.SetPriorityForStage(UpdateStage::PostPhysics, 1);
-    }
+    PlayerControllerSystem();
 
     void Update(const UpdateContext& ctx) override;
-
-    void RegisterComponent(IComponent* pComponent) override;
-
-    void UnregisterComponent(IComponent* pComponent) override;
 };
 } // namespace aln
\ No newline at end of file
@@ -20,16 +20,9 @@ class ScriptSystem : public IEntitySystem
     float m_rotationSpeedZ = 0.0f;
 
   public:
-    ScriptSystem()
-    {
-      m_requiredUpdatePriorities.SetPriorityForStage(UpdateStage::PostPhysics, 10);
-    }
+    ScriptSystem();
 
     // TODO: Hide UpdateContext from users
     void Update(const UpdateContext& ctx) override;
-
-    void RegisterComponent(IComponent* pComponent) override;
-
-    void UnregisterComponent(IComponent* pComponent) override;
 };
 } // namespace aln
\ No newline at end of file
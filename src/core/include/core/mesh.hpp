@@ -30,8 +30,14 @@ class Mesh : public IAsset
     friend class GraphicsSystem;
 
   private:
+    // CPU copies of the geometry. Only resident after upload if the asset requires CPU access
     Vector<std::byte> m_vertices;
-    Vector<uint32_t> m_indices;
+    Vector<std::byte> m_indices;
+    vk::IndexType m_indexType = vk::IndexType::eUint32;
+    uint32_t m_indexCount = 0;
+
+    /// @brief Bounds used to expand the quantized vertex positions
+    MeshBounds m_bounds;
 
     Vector<PrimitiveComponent> m_primitives;
 
@@ -46,9 +52,18 @@ class Mesh : public IAsset
     const AssetHandle<Material>& GetMaterial() const { return m_pMaterial; }
     const GPUBuffer& GetVertexBuffer() const { return m_vertexBuffer; }
     const GPUBuffer& GetIndexBuffer() const { return m_indexBuffer; }
-    uint32_t GetIndicesCount() const { return m_indices.size(); }
+    uint32_t GetIndicesCount() const { return m_indexCount; }
+    vk::IndexType GetIndexType() const { return m_indexType; }
+    const MeshBounds& GetBounds() const { return m_bounds; }
     const vk::DescriptorSet& GetDescriptorSet() const { return m_descriptorSet; }
 
+    bool HasCPUData() const { return !m_vertices.empty(); }
+    const Vector<std::byte>& GetVertexData() const { return m_vertices; }
+    const Vector<std::byte>& GetIndexData() const { return m_indices; }
+
+    size_t GetCPUMemorySize() const override { return m_vertices.capacity() + m_indices.capacity(); }
+    size_t GetGPUMemorySize() const override { return m_vertexBuffer.GetAllocatedSize() + m_indexBuffer.GetAllocatedSize(); }
+
     static Vector<vk::DescriptorSetLayoutBinding> GetDescriptorSetLayoutBindings()
     {
         Vector<vk::DescriptorSetLayoutBinding> bindings = {
@@ -4,6 +4,7 @@
 #include "../components/light.hpp"
 #include "../components/skeletal_mesh_component.hpp"
 #include "../components/static_mesh_component.hpp"
+#include "../debug_render_states.hpp"
 #include "../world_systems/render_system.hpp"
 
 #include <entities/world_entity.hpp>
@@ -32,10 +33,19 @@ class SceneRenderer : public IRenderer
         alignas(16) Vec3 m_cameraPosition;
     };
 
-    struct SkinnedMeshPushConstant
+    /// @brief Per-mesh push constant shared by the static and skeletal meshes pipelines
+    struct MeshPushConstant
     {
-        uint32_t m_bonesCount;
-        uint32_t m_bonesStartIndex;
+        Vec3 m_positionCenter;
+        uint32_t m_bonesCount = 0;
+        Vec3 m_positionHalfExtent;
+        uint32_t m_bonesStartIndex = 0;
+
+        void SetBounds(const MeshBounds& bounds)
+        {
+            m_positionCenter = bounds.m_center;
+            m_positionHalfExtent = bounds.m_halfExtent;
+        }
     };
 
   private:
@@ -43,6 +53,8 @@ class SceneRenderer : public IRenderer
     Pipeline m_skeletalMeshesPipeline;
     Pipeline m_skyboxPipeline;
 
+    LinesRenderState m_debugLinesRenderState;
+
     // Per frame data
     GPUBuffer m_sceneDataBuffer;
     vk::DescriptorSetLayout m_sceneDataDescriptorSetLayout;
@@ -356,7 +368,7 @@ class SceneRenderer : public IRenderer
         m_staticMeshesPipeline.SetExtent({windowSize.width, windowSize.height});
         m_staticMeshesPipeline.RegisterShader(std::string(DEFAULT_SHADERS_DIR) + "/shader.vert", vk::ShaderStageFlagBits::eVertex);
         m_staticMeshesPipeline.RegisterShader(std::string(DEFAULT_SHADERS_DIR) + "/shader.frag", vk::ShaderStageFlagBits::eFragment);
-        m_staticMeshesPipeline.AddPushConstant(vk::ShaderStageFlagBits::eVertex, 0, sizeof(SkinnedMeshPushConstant)); // Note: This is necessary for now so that static/skinned meshes pipelines are compatible and we can bind descriptor sets once for both
+        m_staticMeshesPipeline.AddPushConstant(vk::ShaderStageFlagBits::eVertex, 0, sizeof(MeshPushConstant)); // Note: This is necessary for now so that static/skinned meshes pipelines are compatible and we can bind descriptor sets once for both
         m_staticMeshesPipeline.RegisterDescriptorLayout(m_sceneDataDescriptorSetLayout);
         m_staticMeshesPipeline.RegisterDescriptorLayout(m_pRenderEngine->GetDescriptorSetLayout<aln::Light>());
         m_staticMeshesPipeline.RegisterDescriptorLayout(m_pRenderEngine->GetDescriptorSetLayout<aln::Mesh>());
@@ -375,7 +387,7 @@ class SceneRenderer : public IRenderer
         m_skeletalMeshesPipeline.SetExtent({windowSize.width, windowSize.height});
         m_skeletalMeshesPipeline.RegisterShader(std::string(DEFAULT_SHADERS_DIR) + "/skeletal_mesh.vert", vk::ShaderStageFlagBits::eVertex);
         m_skeletalMeshesPipeline.RegisterShader(std::string(DEFAULT_SHADERS_DIR) + "/shader.frag", vk::ShaderStageFlagBits::eFragment);
-        m_skeletalMeshesPipeline.AddPushConstant(vk::ShaderStageFlagBits::eVertex, 0, sizeof(SkinnedMeshPushConstant));
+        m_skeletalMeshesPipeline.AddPushConstant(vk::ShaderStageFlagBits::eVertex, 0, sizeof(MeshPushConstant));
         m_skeletalMeshesPipeline.RegisterDescriptorLayout(m_sceneDataDescriptorSetLayout);
         m_skeletalMeshesPipeline.RegisterDescriptorLayout(m_pRenderEngine->GetDescriptorSetLayout<aln::Light>());
         m_skeletalMeshesPipeline.RegisterDescriptorLayout(m_pRenderEngine->GetDescriptorSetLayout<aln::Mesh>());
@@ -407,6 +419,9 @@ class SceneRenderer : public IRenderer
     {
         CreateInternal(pRenderEngine);
         CreatePipelines();
+
+        auto windowSize = m_pRenderEngine->GetWindow()->GetFramebufferSize();
+        m_debugLinesRenderState.Initialize(m_pRenderEngine, this, {windowSize.width, windowSize.height});
     }
 
     void Shutdown() override
@@ -414,6 +429,7 @@ class SceneRenderer : public IRenderer
         m_staticMeshesPipeline.Shutdown();
         m_skeletalMeshesPipeline.Shutdown();
         //m_skyboxPipeline.Shutdown();
+        m_debugLinesRenderState.Shutdown();
 
         for (auto& renderTarget : m_renderTargets)
         {
@@ -442,10 +458,14 @@ class SceneRenderer : public IRenderer
 
         const Mesh* pCurrentMesh = staticMeshComponents[0]->GetMesh();
         cb.bindVertexBuffers(0, pCurrentMesh->GetVertexBuffer().GetVkBuffer(), vk::DeviceSize(0));
-        cb.bindIndexBuffer(pCurrentMesh->GetIndexBuffer().GetVkBuffer(), 0, vk::IndexType::eUint32);
+        cb.bindIndexBuffer(pCurrentMesh->GetIndexBuffer().GetVkBuffer(), 0, pCurrentMesh->GetIndexType());
 
         m_staticMeshesPipeline.BindDescriptorSet(cb, pCurrentMesh->GetDescriptorSet(), 2);
 
+        MeshPushConstant pushConstant;
+        pushConstant.SetBounds(pCurrentMesh->GetBounds());
+        cb.pushConstants(m_staticMeshesPipeline.GetLayout(), vk::ShaderStageFlagBits::eVertex, 0, sizeof(MeshPushConstant), &pushConstant);
+
         uint32_t firstInstance = currentMeshIndex;
 
         // This list has already gone through culling and is ordered by instance
@@ -465,9 +485,12 @@ class SceneRenderer : public IRenderer
 
                 m_staticMeshesPipeline.BindDescriptorSet(cb, pCurrentMesh->GetDescriptorSet(), 2);
 
+                pushConstant.SetBounds(pCurrentMesh->GetBounds());
+                cb.pushConstants(m_staticMeshesPipeline.GetLayout(), vk::ShaderStageFlagBits::eVertex, 0, sizeof(MeshPushConstant), &pushConstant);
+
                 firstInstance = currentMeshIndex;
                 cb.bindVertexBuffers(0, pCurrentMesh->GetVertexBuffer().GetVkBuffer(), vk::DeviceSize(0));
-                cb.bindIndexBuffer(pCurrentMesh->GetIndexBuffer().GetVkBuffer(), 0, vk::IndexType::eUint32);
+                cb.bindIndexBuffer(pCurrentMesh->GetIndexBuffer().GetVkBuffer(), 0, pCurrentMesh->GetIndexType());
             }
 
             currentMeshIndex++;
@@ -481,20 +504,21 @@ class SceneRenderer : public IRenderer
     {
         m_skeletalMeshesPipeline.Bind(cb);
 
-        SkinnedMeshPushConstant pushConstant;
+        MeshPushConstant pushConstant;
         uint32_t totalBonesCount = 0;
 
         const SkeletalMeshComponent* pMeshComponent = skeletalMeshComponents[0];
         const Mesh* pCurrentMesh = pMeshComponent->GetMesh();
 
         cb.bindVertexBuffers(0, pCurrentMesh->GetVertexBuffer().GetVkBuffer(), vk::DeviceSize(0));
-        cb.bindIndexBuffer(pCurrentMesh->GetIndexBuffer().GetVkBuffer(), 0, vk::IndexType::eUint32);
+        cb.bindIndexBuffer(pCurrentMesh->GetIndexBuffer().GetVkBuffer(), 0, pCurrentMesh->GetIndexType());
 
         m_skeletalMeshesPipeline.BindDescriptorSet(cb, pCurrentMesh->GetDescriptorSet(), 2);
 
+        pushConstant.SetBounds(pCurrentMesh->GetBounds());
         pushConstant.m_bonesCount = pMeshComponent->GetBonesCount();
         pushConstant.m_bonesStartIndex = totalBonesCount;
-        cb.pushConstants(m_skeletalMeshesPipeline.GetLayout(), vk::ShaderStageFlagBits::eVertex, 0, sizeof(SkinnedMeshPushConstant), &pushConstant);
+        cb.pushConstants(m_skeletalMeshesPipeline.GetLayout(), vk::ShaderStageFlagBits::eVertex, 0, sizeof(MeshPushConstant), &pushConstant);
 
         totalBonesCount += pushConstant.m_bonesCount;
 
@@ -517,17 +541,18 @@ class SceneRenderer : public IRenderer
 
                 m_skeletalMeshesPipeline.BindDescriptorSet(cb, pCurrentMesh->GetDescriptorSet(), 2);
 
+                pushConstant.SetBounds(pCurrentMesh->GetBounds());
                 pushConstant.m_bonesCount = pMeshComponent->GetBonesCount();
                 pushConstant.m_bonesStartIndex = totalBonesCount;
 
-                cb.pushConstants(m_skeletalMeshesPipeline.GetLayout(), vk::ShaderStageFlagBits::eVertex, 0, sizeof(SkinnedMeshPushConstant), &pushConstant);
+                cb.pushConstants(m_skeletalMeshesPipeline.GetLayout(), vk::ShaderStageFlagBits::eVertex, 0, sizeof(MeshPushConstant), &pushConstant);
                 // assert(constant.m_bonesCount < 255);
 
                 totalBonesCount += pushConstant.m_bonesCount;
 
                 firstInstance = currentMeshIndex;
                 cb.bindVertexBuffers(0, pCurrentMesh->GetVertexBuffer().GetVkBuffer(), vk::DeviceSize(0));
-                cb.bindIndexBuffer(pCurrentMesh->GetIndexBuffer().GetVkBuffer(), 0, vk::IndexType::eUint32);
+                cb.bindIndexBuffer(pCurrentMesh->GetIndexBuffer().GetVkBuffer(), 0, pCurrentMesh->GetIndexType());
             }
 
             currentMeshIndex++;
@@ -563,7 +588,7 @@ class SceneRenderer : public IRenderer
         SceneGPUData sceneData = {
             .m_view = data.m_pCameraComponent->GetViewMatrix(),
             .m_projection = data.m_pCameraComponent->GetProjectionMatrix(pWorld->GetViewport()->GetAspectRatio()),
-            .m_cameraPosition = data.m_pCameraComponent->GetLocalTransform().GetTranslation(),
+            .m_cameraPosition = data.m_pCameraComponent->GetRenderWorldTransform().GetTranslation(),
         };
 
         // ---- Upload frame data
@@ -594,14 +619,14 @@ class SceneRenderer : public IRenderer
         auto pBufferMemory = m_modelTransformsBuffer.Map<Matrix4x4>();
         for (const auto pSkeletalMeshComponent : data.m_visibleSkeletalMeshComponents)
         {
-            modelMatrix = pSkeletalMeshComponent->GetWorldTransform().ToMatrix();
+            modelMatrix = pSkeletalMeshComponent->GetRenderWorldTransform().ToMatrix();
             memcpy(pBufferMemory, &modelMatrix, sizeof(Matrix4x4));
             pBufferMemory++;
         }
 
         for (const auto pStaticMeshComponent : data.m_visibleStaticMeshComponents)
         {
-            modelMatrix = pStaticMeshComponent->GetWorldTransform().ToMatrix();
+            modelMatrix = pStaticMeshComponent->GetRenderWorldTransform().ToMatrix();
             memcpy(pBufferMemory, &modelMatrix, sizeof(Matrix4x4));
             pBufferMemory++;
         }
@@ -640,6 +665,13 @@ class SceneRenderer : public IRenderer
             meshIndex += data.m_visibleSkeletalMeshComponents.size();
         }
 
+        // ---- Render debug lines
+        if (!data.m_debugVertices.empty())
+        {
+            const auto viewProjectionMatrix = sceneData.m_projection * sceneData.m_view;
+            m_debugLinesRenderState.Render((vk::CommandBuffer) cb, currentFrameIdx, viewProjectionMatrix, data.m_debugVertices);
+        }
+
         // ...
 
         cb->endRenderPass();
@@ -3,8 +3,11 @@
 #include "../renderers/scene_renderer.hpp"
 #include "../renderers/ui_renderer.hpp"
 
+#include <common/memory.hpp>
+#include <common/profiling.hpp>
 #include <common/services/service.hpp>
 #include <entities/world_entity.hpp>
+#include <graphics/imgui_service.hpp>
 #include <graphics/render_engine.hpp>
 
 namespace aln
@@ -50,16 +53,24 @@ class RenderingService : public IService
     {
         assert(m_pRenderEngine != nullptr && m_pWorld != nullptr);
 
+        MemoryTagScope memoryTagScope(MemoryTag::Render);
+
         m_pRenderEngine->StartFrame();
         auto cb = m_pRenderEngine->GetGraphicsTransientCommandPool().GetCommandBuffer();
         
         // Scene
-        m_sceneRenderer.Render(m_pWorld, cb);
+        {
+            ALN_PROFILE_SCOPE("Scene", ProfileCategory::RenderPass);
+            m_sceneRenderer.Render(m_pWorld, cb);
+        }
 
         // Editor / UI
-        m_editorRenderer.StartFrame(cb, m_context);
-        m_pImguiService->Render(cb);
-        m_editorRenderer.EndFrame(cb);
+        {
+            ALN_PROFILE_SCOPE("UI", ProfileCategory::RenderPass);
+            m_editorRenderer.StartFrame(cb, m_context);
+            m_pImguiService->Render(cb);
+            m_editorRenderer.EndFrame(cb);
+        }
 
         QueueSubmissionRequest request;
         request.ExecuteCommandBuffer(cb);
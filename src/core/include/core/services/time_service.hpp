@@ -12,6 +12,7 @@ namespace aln
 class TimeService : public IService
 {
     friend class Engine;
+    friend class EngineCore;
 
   private:
     using Clock = std::chrono::steady_clock;
@@ -19,17 +20,21 @@ class TimeService : public IService
     using TimePoint = std::chrono::time_point<Clock, Duration>;
 
     TimePoint m_startTime;
-    TimePoint m_frameTime;
+    TimePoint m_frameTime; // Sum of the frames' deltas, follows the wall clock unless a fixed delta is used
+    TimePoint m_clockTime; // Wall clock time at the last update
     Duration m_deltaTime;
 
     /// Number of frames since the start of the application
     /// @todo This *will* overflow
     uint64_t m_frameCount;
 
+    /// When positive, frames advance by this amount instead of following the wall clock
+    Duration m_fixedDeltaTime = Duration::zero();
+
     /// @brief Notify the time system that we changed frames. Get the current time and update internal fields accordingly.
     void Update();
 
-    TimeService() : m_startTime(std::chrono::time_point_cast<Duration>(Clock::now())), m_frameTime(m_startTime), m_frameCount(0) {}
+    TimeService() : m_startTime(std::chrono::time_point_cast<Duration>(Clock::now())), m_frameTime(m_startTime), m_clockTime(m_startTime), m_frameCount(0) {}
 
   public:
     /// @brief Interval since last frame (in seconds).
@@ -43,5 +48,11 @@ class TimeService : public IService
 
     /// @brief Real time since the start of the application (in seconds).
     float GetTimeSinceAppStart() const;
+
+    /// @brief Advance every frame by a fixed delta instead of the measured one, so that runs are reproducible regardless of the
+    /// machine's speed (i.e. replays, benchmarks). A delta of 0 goes back to wall clock time.
+    void SetFixedDeltaTime(float deltaTime);
+    float GetFixedDeltaTime() const { return (float) m_fixedDeltaTime.count(); }
+    bool IsUsingFixedDeltaTime() const { return m_fixedDeltaTime > Duration::zero(); }
 };
 } // namespace aln
\ No newline at end of file
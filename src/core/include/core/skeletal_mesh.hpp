@@ -44,8 +44,9 @@ class SkeletalMesh : public Mesh
         return InvalidIndex;
     }
 
-
-
-
+    size_t GetCPUMemorySize() const override
+    {
+        return Mesh::GetCPUMemorySize() + (m_bindPose.capacity() + m_inverseBindPose.capacity()) * sizeof(Transform) + m_parentBoneIndices.capacity() * sizeof(uint32_t);
+    }
 };
 } // namespace aln
\ No newline at end of file
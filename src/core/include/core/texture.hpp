@@ -1,6 +1,7 @@
 #pragma once
 
 #include <assets/asset.hpp>
+#include <common/containers/vector.hpp>
 #include <graphics/resources/image.hpp>
 
 namespace aln
@@ -17,7 +18,18 @@ class Texture : public IAsset
   private:
     GPUImage m_image;
 
+    // CPU copy of the pixels. Only resident after upload if the asset requires CPU access
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+    Vector<std::byte> m_data;
+
   public:
     inline const vk::DescriptorImageInfo GetDescriptor() const { return m_image.GetDescriptor(); }
+
+    bool HasCPUData() const { return !m_data.empty(); }
+    const Vector<std::byte>& GetData() const { return m_data; }
+
+    size_t GetCPUMemorySize() const override { return m_data.capacity(); }
+    size_t GetGPUMemorySize() const override { return m_image.GetAllocatedSize(); }
 };
 } // namespace aln
\ No newline at end of file
@@ -3,16 +3,13 @@
 #include "../components/light.hpp"
 #include "../components/skeletal_mesh_component.hpp"
 #include "../components/static_mesh_component.hpp"
-#include "../debug_render_states.hpp"
 
 #include <common/containers/vector.hpp>
-#include <common/drawing_context.hpp>
+#include <common/vertex.hpp>
 #include <common/hash_vector.hpp>
 #include <entities/update_context.hpp>
 #include <entities/world_system.hpp>
 
-#include <vulkan/vulkan.hpp>
-
 namespace aln
 {
 
@@ -29,6 +26,9 @@ struct RenderData
     Vector<const StaticMeshComponent*> m_visibleStaticMeshComponents;
     IDVector<Light*> m_lightComponents;
     const CameraComponent* m_pCameraComponent;
+
+    // Debug lines drawn by all threads during the last simulation step
+    Vector<DebugVertex> m_debugVertices;
 };
 
 class GraphicsSystem : public IWorldSystem
@@ -41,7 +41,7 @@ class GraphicsSystem : public IWorldSystem
         IDVector<SkeletalMeshComponent*> m_components;
 
         SkeletalMeshRenderInstance(const SkeletalMesh* pMesh) : m_pMesh(pMesh) {}
-        uint32_t GetID() const { return m_pMesh->GetID(); }
+        const AssetID& GetID() const { return m_pMesh->GetID(); }
     };
 
     struct StaticMeshRenderInstance
@@ -50,7 +50,7 @@ class GraphicsSystem : public IWorldSystem
         IDVector<StaticMeshComponent*> m_components;
 
         StaticMeshRenderInstance(const StaticMesh* pMesh) : m_pMesh(pMesh) {}
-        uint32_t GetID() const { return m_pMesh->GetID(); }
+        const AssetID& GetID() const { return m_pMesh->GetID(); }
     };
 
   private:
@@ -60,13 +60,18 @@ class GraphicsSystem : public IWorldSystem
     /// @todo: Move to a specific Viewport class that get passed around
     float m_aspectRatio = 1.0f;
 
-    // Debuging render state(s)
-    LinesRenderState m_linesRenderState;
-
     // Registered components
     IDVector<SkeletalMeshRenderInstance> m_skeletalMeshRenderInstances;
     IDVector<StaticMeshRenderInstance> m_staticMeshRenderInstances;
 
+  private:
+    void RegisterCamera(CameraComponent* pCamera);
+    void UnregisterCamera(CameraComponent* pCamera);
+    void RegisterStaticMesh(StaticMeshComponent* pStaticMeshComponent);
+    void UnregisterStaticMesh(StaticMeshComponent* pStaticMeshComponent);
+    void RegisterSkeletalMesh(SkeletalMeshComponent* pSkeletalMeshComponent);
+    void UnregisterSkeletalMesh(SkeletalMeshComponent* pSkeletalMeshComponent);
+
   private:
     // -------------------------------------------------
     // System Methods
@@ -74,14 +79,15 @@ class GraphicsSystem : public IWorldSystem
     void Shutdown() override;
     void Initialize() override;
     void Update(const UpdateContext& context) override;
-    void RegisterComponent(const Entity* pEntity, IComponent* pComponent) override;
-    void UnregisterComponent(const Entity* pEntity, IComponent* pComponent) override;
     const UpdatePriorities& GetUpdatePriorities() override;
 
-    // Rendering calls
-    void RenderDebugLines(vk::CommandBuffer& cb, DrawingContext& drawingContext);
-
   public:
+    /// @brief Update the render data that is interpolated between simulation ticks. Called once per rendered frame, after the simulation
+    void PrepareRender();
+
+    /// @brief Update the render instances and components of a mesh whose new version replaced the previous one
+    void HandleAssetReloaded(const AssetID& assetID);
+
     void SetRenderCamera(const CameraComponent* pCameraComponent)
     {
         assert(pCameraComponent != nullptr);
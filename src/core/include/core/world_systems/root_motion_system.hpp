@@ -0,0 +1,53 @@
+#pragma once
+
+#include <common/containers/hash_map.hpp>
+#include <common/containers/vector.hpp>
+#include <entities/update_context.hpp>
+#include <entities/world_system.hpp>
+#include <entities/world_update.hpp>
+
+namespace aln
+{
+
+class Entity;
+class IComponent;
+class AnimationGraphComponent;
+class SkeletalMeshComponent;
+
+/// @brief Applies the root motion extracted by the animation graphs to their characters.
+/// All characters are processed in a single pass over a contiguous array, after animation has been evaluated and before physics
+class RootMotionSystem : public IWorldSystem
+{
+    struct CharacterRecord
+    {
+        const Entity* m_pEntity = nullptr;
+        const AnimationGraphComponent* m_pGraphComponent = nullptr;
+        SkeletalMeshComponent* m_pRootComponent = nullptr; // Root spatial component of the entity, when it is a skeletal mesh
+
+        bool IsEmpty() const { return m_pGraphComponent == nullptr && m_pRootComponent == nullptr; }
+    };
+
+  private:
+    Vector<CharacterRecord> m_characterRecords;
+    HashMap<const Entity*, uint32_t> m_recordIndices; // Index of each entity's record, kept up to date when records are swapped
+    UpdatePriorities m_updatePriorities;
+
+    CharacterRecord* FindRecord(const Entity* pEntity);
+    CharacterRecord& FindOrAddRecord(const Entity* pEntity);
+    void RemoveRecordIfEmpty(CharacterRecord* pRecord);
+
+    void RegisterGraphComponent(const Entity* pEntity, AnimationGraphComponent* pGraphComponent);
+    void UnregisterGraphComponent(const Entity* pEntity, AnimationGraphComponent* pGraphComponent);
+    void RegisterRootComponent(const Entity* pEntity, SkeletalMeshComponent* pSkeletalMeshComponent);
+    void UnregisterRootComponent(const Entity* pEntity, SkeletalMeshComponent* pSkeletalMeshComponent);
+
+  private:
+    // -------------------------------------------------
+    // System Methods
+    // -------------------------------------------------
+    void Shutdown() override;
+    void Initialize() override;
+    void Update(const UpdateContext& context) override;
+    const UpdatePriorities& GetUpdatePriorities() override { return m_updatePriorities; }
+};
+} // namespace aln
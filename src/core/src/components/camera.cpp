@@ -15,8 +15,9 @@ ALN_REGISTER_IMPL_END()
 
 Matrix4x4 CameraComponent::GetViewMatrix() const
 {
-    Transform t = GetWorldTransform();
-    return Matrix4x4::LookAt(t.GetTranslation(), t.GetTranslation() + GetCameraForwardVector(), GetCameraUpVector());
+    // Rendering between simulation ticks
+    Transform t = GetRenderWorldTransform();
+    return Matrix4x4::LookAt(t.GetTranslation(), t.GetTranslation() + t.GetForwardVector(), t.GetUpVector());
 }
 
 Matrix4x4 CameraComponent::GetProjectionMatrix(float aspectRatio) const
@@ -6,6 +6,7 @@ namespace aln
 {
 
 ALN_REGISTER_IMPL_BEGIN(COMPONENTS, Light)
+ALN_REFLECT_BASE(SpatialComponent)
 ALN_REFLECT_MEMBER(m_color)
 ALN_REFLECT_MEMBER(m_intensity)
 ALN_REGISTER_IMPL_END()
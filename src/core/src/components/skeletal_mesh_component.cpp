@@ -13,9 +13,30 @@ namespace aln
 void SkeletalMeshComponent::UpdateSkinningTransforms()
 {
     const auto boneCount = m_boneTransforms.size();
+    const auto& inverseBindPose = m_pMesh->GetInverseBindPose();
+
+    const auto interpolationFactor = GetRenderInterpolationFactor();
+    if (m_previousPoseTick != GetSimulationTick() || interpolationFactor >= 1.0f)
+    {
+        for (auto i = 0; i < boneCount; ++i)
+        {
+            const Transform transform = m_boneTransforms[i] * inverseBindPose[i];
+            m_skinningTransforms[i] = transform.ToMatrix();
+        }
+        return;
+    }
+
+    // Consecutive ticks are close enough for a normalized lerp
     for (auto i = 0; i < boneCount; ++i)
     {
-        const Transform transform = m_boneTransforms[i] * m_pMesh->GetInverseBindPose()[i];
+        const auto& previousTransform = m_previousBoneTransforms[i];
+        const auto& currentTransform = m_boneTransforms[i];
+        const Transform boneTransform(
+            Vec3::Lerp(previousTransform.GetTranslation(), currentTransform.GetTranslation(), interpolationFactor),
+            Quaternion::NLerp(previousTransform.GetRotation(), currentTransform.GetRotation(), interpolationFactor),
+            Vec3::Lerp(previousTransform.GetScale(), currentTransform.GetScale(), interpolationFactor));
+
+        const Transform transform = boneTransform * inverseBindPose[i];
         m_skinningTransforms[i] = transform.ToMatrix();
     }
 }
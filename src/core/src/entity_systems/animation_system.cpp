@@ -2,6 +2,21 @@
 
 namespace aln
 {
+AnimationSystem::AnimationSystem()
+{
+    m_requiredUpdatePriorities.SetPriorityForStage(UpdateStage::FrameStart, 10);
+
+    m_componentRouter.AddRoute<AnimationPlayerComponent>(
+        [this](AnimationPlayerComponent* pComponent) { m_pAnimationPlayerComponent = pComponent; },
+        [this](AnimationPlayerComponent* pComponent) { if (m_pAnimationPlayerComponent == pComponent) { m_pAnimationPlayerComponent = nullptr; } });
+    m_componentRouter.AddRoute<AnimationGraphComponent>(
+        [this](AnimationGraphComponent* pComponent) { m_pAnimationGraphComponent = pComponent; },
+        [this](AnimationGraphComponent* pComponent) { if (m_pAnimationGraphComponent == pComponent) { m_pAnimationGraphComponent = nullptr; } });
+    m_componentRouter.AddRoute<SkeletalMeshComponent>(
+        [this](SkeletalMeshComponent* pComponent) { m_pSkeletalMeshComponent = pComponent; },
+        [this](SkeletalMeshComponent* pComponent) { if (m_pSkeletalMeshComponent == pComponent) { m_pSkeletalMeshComponent = nullptr; } });
+}
+
 void AnimationSystem::Update(const UpdateContext& ctx)
 {
     if (m_pSkeletalMeshComponent == nullptr)
@@ -33,52 +48,17 @@ void AnimationSystem::Update(const UpdateContext& ctx)
         m_pSkeletalMeshComponent->SetPose(m_pAnimationPlayerComponent->GetPose());
     }
 
+    if (m_pSkeletalMeshComponent->IsDebugSkeletonDrawingEnabled())
+    {
+        m_pSkeletalMeshComponent->DrawPose(ctx.GetDrawingContext());
+    }
+
     // m_pSkeletalMeshComponent->ResetPoseSkeleton();
     // m_pSkeletalMeshComponent->ResetPose();
     // TODO:
     // - Update all remaining bones (procedural etc)
 }
 
-void AnimationSystem::RegisterComponent(IComponent* pComponent)
-{
-    auto pAnimationPlayerComponent = dynamic_cast<AnimationPlayerComponent*>(pComponent);
-    if (pAnimationPlayerComponent != nullptr)
-    {
-        m_pAnimationPlayerComponent = pAnimationPlayerComponent;
-        return;
-    }
-
-    auto pAnimationGraphComponent = dynamic_cast<AnimationGraphComponent*>(pComponent);
-    if (pAnimationGraphComponent != nullptr)
-    {
-        m_pAnimationGraphComponent = pAnimationGraphComponent;
-        return;
-    }
-
-    auto pSkeletalMesh = dynamic_cast<SkeletalMeshComponent*>(pComponent);
-    if (pSkeletalMesh != nullptr)
-    {
-        m_pSkeletalMeshComponent = pSkeletalMesh;
-        return;
-    }
-}
-
-void AnimationSystem::UnregisterComponent(IComponent* pComponent)
-{
-    if (pComponent == m_pSkeletalMeshComponent)
-    {
-        m_pSkeletalMeshComponent = nullptr;
-    }
-    else if (pComponent == m_pAnimationGraphComponent)
-    {
-        m_pAnimationGraphComponent = nullptr;
-    }
-    else if (pComponent == m_pAnimationPlayerComponent)
-    {
-        m_pAnimationPlayerComponent = nullptr;
-    }
-}
-
 ALN_REGISTER_IMPL_BEGIN(SYSTEMS, aln::AnimationSystem)
 ALN_REGISTER_IMPL_END()
 } // namespace aln
\ No newline at end of file
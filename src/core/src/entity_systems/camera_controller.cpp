@@ -17,6 +17,16 @@ ALN_REFLECT_MEMBER(m_rotationSensitivity)
 ALN_REFLECT_MEMBER(m_translationSensitivity)
 ALN_REGISTER_IMPL_END()
 
+EditorCameraController::EditorCameraController()
+{
+    m_requiredUpdatePriorities.SetPriorityForStage(UpdateStage::FrameStart, 1);
+
+    // Associate the controlled camera
+    m_componentRouter.AddRoute<CameraComponent>(
+        [this](CameraComponent* pComponent) { m_pCameraInstance = pComponent; },
+        [this](CameraComponent* pComponent) { if (m_pCameraInstance == pComponent) { m_pCameraInstance = nullptr; } });
+}
+
 void EditorCameraController::Update(const UpdateContext& context)
 {
     auto pInputService = context.GetService<InputService>();
@@ -52,25 +62,4 @@ void EditorCameraController::Update(const UpdateContext& context)
     }
 }
 
-void EditorCameraController::RegisterComponent(IComponent* pComponent)
-{
-    // Associate the controlled camera
-    auto pCameraComponent = dynamic_cast<CameraComponent*>(pComponent);
-
-    if (pCameraComponent == nullptr)
-    {
-        return;
-    }
-
-    m_pCameraInstance = pCameraComponent;
-}
-
-void EditorCameraController::UnregisterComponent(IComponent* pComponent)
-{
-    if (pComponent == m_pCameraInstance)
-    {
-        m_pCameraInstance = nullptr;
-    }
-}
-
 } // namespace aln
\ No newline at end of file
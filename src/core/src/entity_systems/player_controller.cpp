@@ -8,11 +8,38 @@
 
 namespace aln
 {
+namespace
+{
+constexpr StringID SpeedParameterID = StringID("Speed");
+}
 
 ALN_REGISTER_IMPL_BEGIN(SYSTEMS, PlayerControllerSystem)
 ALN_REFLECT_MEMBER(m_blendWeight)
 ALN_REGISTER_IMPL_END()
 
+PlayerControllerSystem::PlayerControllerSystem()
+{
+    m_requiredUpdatePriorities.SetPriorityForStage(UpdateStage::PostPhysics, 1);
+
+    m_componentRouter.AddRoute<AnimationGraphComponent>(
+        [this](AnimationGraphComponent* pComponent)
+        {
+            m_pGraphComponent = pComponent;
+            m_blendWeightParameterIndex = pComponent->GetControlParameterIndex(SpeedParameterID);
+        },
+        [this](AnimationGraphComponent* pComponent) { if (m_pGraphComponent == pComponent) { m_pGraphComponent = nullptr; } });
+    m_componentRouter.AddRoute<SkeletalMeshComponent>(
+        [this](SkeletalMeshComponent* pComponent) { m_pCharacterMeshComponent = pComponent; },
+        [this](SkeletalMeshComponent* pComponent) { if (m_pCharacterMeshComponent == pComponent) { m_pCharacterMeshComponent = nullptr; } });
+    m_componentRouter.AddRoute<OrbitCameraComponent>(
+        [this](OrbitCameraComponent* pComponent)
+        {
+            m_pCameraComponent = pComponent;
+            m_pCameraComponent->SetFocusOffset(Vec3::WorldUp);
+        },
+        [this](OrbitCameraComponent* pComponent) { if (m_pCameraComponent == pComponent) { m_pCameraComponent = nullptr; } });
+}
+
 void PlayerControllerSystem::Update(const UpdateContext& ctx)
 {
     // TODO: Provide easier access to services in user-facing base script class
@@ -23,24 +50,7 @@ void PlayerControllerSystem::Update(const UpdateContext& ctx)
 
     m_pGraphComponent->SetControlParameterValue(m_blendWeightParameterIndex, m_blendWeight);
 
-    // TODO: This should be the responsibility of the animation system. Use that when system update priorities are functionnal !
-
-    // TODO: Ensure we move the root spatial component
-    auto pRootSpatialComponent = m_pCharacterMeshComponent;
-
-    const auto& characterWorldTransform = pRootSpatialComponent->GetWorldTransform();
-    auto characterLocalTransform = m_pCharacterMeshComponent->GetLocalTransform();
-
-    // Apply root motion
-    const auto& rootMotionDelta = m_pGraphComponent->GetRootMotionDelta();
-    const auto deltaRotation = rootMotionDelta.GetRotation();
-    auto deltaTranslation = rootMotionDelta.GetTranslation();
-
-    deltaTranslation = characterWorldTransform.ScaleVector(deltaTranslation);
-    deltaTranslation = characterWorldTransform.RotateVector(deltaTranslation);
-
-    characterLocalTransform.AddTranslation(deltaTranslation);
-    characterLocalTransform.AddRotation(deltaRotation);
+    // Root motion has already been applied by the root motion system at this point
 
     // Rotate the character to head where the stick is pointing to, relative to the camera
     if (!leftStickState.IsNearZero())
@@ -50,11 +60,11 @@ void PlayerControllerSystem::Update(const UpdateContext& ctx)
         auto cameraRotation = Quaternion::LookAt(m_cameraRelativeForwardDirection2D);
         auto rotation = cameraRotation * inputRotation;
 
+        auto characterLocalTransform = m_pCharacterMeshComponent->GetLocalTransform();
         characterLocalTransform.SetRotation(rotation);
+        m_pCharacterMeshComponent->SetLocalTransform(characterLocalTransform);
     }
 
-    pRootSpatialComponent->SetLocalTransform(characterLocalTransform);
-
     // -- Camera
     if (m_pCameraComponent != nullptr)
     {
@@ -90,47 +100,4 @@ void PlayerControllerSystem::Update(const UpdateContext& ctx)
         m_cameraRelativeForwardDirection2D = cameraDirection2D.Normalized();
     }
 }
-
-void PlayerControllerSystem::RegisterComponent(IComponent* pComponent)
-{
-    auto pGraphComponent = dynamic_cast<AnimationGraphComponent*>(pComponent);
-    if (pGraphComponent != nullptr)
-    {
-        m_pGraphComponent = pGraphComponent;
-        m_blendWeightParameterIndex = pGraphComponent->GetControlParameterIndex("Speed");
-        return;
-    }
-
-    auto pSkeletalMeshComponent = dynamic_cast<SkeletalMeshComponent*>(pComponent);
-    if (pSkeletalMeshComponent != nullptr)
-    {
-        m_pCharacterMeshComponent = pSkeletalMeshComponent;
-        return;
-    }
-
-    auto pCameraComponent = dynamic_cast<OrbitCameraComponent*>(pComponent);
-    if (pCameraComponent != nullptr)
-    {
-        m_pCameraComponent = pCameraComponent;
-        m_pCameraComponent->SetFocusOffset(Vec3::WorldUp);
-    }
-}
-
-void PlayerControllerSystem::UnregisterComponent(IComponent* pComponent)
-{
-    if (pComponent == m_pGraphComponent)
-    {
-        m_pGraphComponent = nullptr;
-    }
-
-    if (pComponent == m_pCharacterMeshComponent)
-    {
-        m_pCharacterMeshComponent = nullptr;
-    }
-
-    if (pComponent == m_pCameraComponent)
-    {
-        m_pCameraComponent = nullptr;
-    }
-}
 } // namespace aln
\ No newline at end of file
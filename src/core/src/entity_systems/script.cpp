@@ -8,6 +8,15 @@ ALN_REFLECT_MEMBER(m_rotationSpeedY)
 ALN_REFLECT_MEMBER(m_rotationSpeedZ)
 ALN_REGISTER_IMPL_END()
 
+ScriptSystem::ScriptSystem()
+{
+    m_requiredUpdatePriorities.SetPriorityForStage(UpdateStage::PostPhysics, 10);
+
+    m_componentRouter.AddRoute<SpatialComponent>(
+        [this](SpatialComponent* pComponent) { m_pRootComponent = pComponent; },
+        [this](SpatialComponent* pComponent) { if (m_pRootComponent == pComponent) { m_pRootComponent = nullptr; } });
+}
+
 void ScriptSystem::Update(const UpdateContext& ctx)
 {
     auto rot = m_pRootComponent->GetLocalTransform().GetRotationEuler();
@@ -16,21 +25,4 @@ void ScriptSystem::Update(const UpdateContext& ctx)
     rot.roll += m_rotationSpeedZ * ctx.GetDeltaTime();
     m_pRootComponent->SetLocalTransformRotationEuler(rot);
 }
-
-void ScriptSystem::RegisterComponent(IComponent* pComponent)
-{
-    auto pSpatialComponent = dynamic_cast<SpatialComponent*>(pComponent);
-    if (pSpatialComponent != nullptr)
-    {
-        m_pRootComponent = pSpatialComponent;
-    }
-}
-
-void ScriptSystem::UnregisterComponent(IComponent* pComponent)
-{
-    if (pComponent == m_pRootComponent)
-    {
-        m_pRootComponent = nullptr;
-    }
-}
 } // namespace aln
\ No newline at end of file
@@ -1,17 +1,34 @@
 #include "services/time_service.hpp"
 
+#include <assert.h>
+
 namespace aln
 {
 
 void TimeService::Update()
 {
-    auto frameTime = std::chrono::time_point_cast<Duration>(Clock::now());
-    m_deltaTime = frameTime - m_frameTime;
-    m_frameTime = frameTime;
+    // The wall clock is sampled in both modes, so that going back from a fixed delta does not count the time spent in it as a single frame
+    const auto clockTime = std::chrono::time_point_cast<Duration>(Clock::now());
+    if (IsUsingFixedDeltaTime())
+    {
+        m_deltaTime = m_fixedDeltaTime;
+    }
+    else
+    {
+        m_deltaTime = clockTime - m_clockTime;
+    }
+    m_clockTime = clockTime;
+    m_frameTime += m_deltaTime;
 
     m_frameCount++;
 }
 
+void TimeService::SetFixedDeltaTime(float deltaTime)
+{
+    assert(deltaTime >= 0.0f);
+    m_fixedDeltaTime = Duration(deltaTime);
+}
+
 float TimeService::GetDeltaTime() const { return m_deltaTime.count(); }
 
 float TimeService::GetTime() const { return m_frameTime.time_since_epoch().count(); }
@@ -3,12 +3,12 @@
 #include "components/camera.hpp"
 #include "components/light.hpp"
 #include "renderers/scene_renderer.hpp"
-#include "services/rendering_service.hpp"
 
 #include <graphics/rendering/renderer.hpp>
 #include <entities/entity.hpp>
 #include <entities/update_context.hpp>
 #include <entities/world_system.hpp>
+#include <common/drawing_context.hpp>
 #include <common/maths/matrix4x4.hpp>
 
 #include <tracy/Tracy.hpp>
@@ -16,53 +16,25 @@
 namespace aln
 {
 
-void GraphicsSystem::RenderDebugLines(vk::CommandBuffer& cb, DrawingContext& drawingContext)
-{
-    const auto& vertexBuffer = drawingContext.m_vertices;
-    auto vertexCount = vertexBuffer.size();
-
-    // todo: Aggregate line data coming from multiple threads
-
-    // TODO: Profile with a staging buffer
-    // but vk buffer copy is not allowed inside a render pass
-    // GPUBuffer stagingBuffer(m_pRenderer->GetDevice(), vk::BufferUsageFlagBits::eTransferSrc, vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent, vertexBuffer);
-    // m_linesRenderState.m_stagingBuffer.Map();
-    // m_linesRenderState.m_stagingBuffer.Copy(vertexBuffer);
-    // m_linesRenderState.m_stagingBuffer.Unmap();
-
-    // m_linesRenderState.m_stagingBuffer.CopyTo(cb, m_linesRenderState.m_vertexBuffer);
-
-    // Update UBO
-    LinesRenderState::UBO ubo;
-    ubo.m_viewProjectionMatrix = m_renderData.m_pCameraComponent->GetViewProjectionMatrix(m_aspectRatio);
-
-    m_linesRenderState.m_viewProjectionUBO.Copy(ubo);
-
-    // Update vertex buffer
-    m_linesRenderState.m_vertexBuffer.Copy(vertexBuffer);
-
-    // TODO: Handle a max number of lines per draw call
-    // Split the buffer accordingly and draw each part sequentially
-
-    auto& pipeline = m_linesRenderState.m_pipeline;
-    pipeline.Bind(cb);
-
-    pipeline.BindDescriptorSet(cb, m_linesRenderState.m_descriptorSet, 0);
-    cb.bindVertexBuffers(0, m_linesRenderState.m_vertexBuffer.GetVkBuffer(), (vk::DeviceSize) 0);
-    cb.draw(vertexBuffer.size(), 1, 0, 0);
-}
-
 void GraphicsSystem::Shutdown()
 {
-    // TODO
-    //m_linesRenderState.Shutdown();
+    m_renderData.m_debugVertices.clear();
 }
 
 void GraphicsSystem::Initialize()
 {
-    // Debug resources
-    // TODO: Rework line debugging
-    //m_linesRenderState.Initialize(m_pRenderer->GetDevice(), m_pRenderer);
+    m_componentRouter.AddRoute<CameraComponent>(
+        [this](const Entity*, CameraComponent* pCamera) { RegisterCamera(pCamera); },
+        [this](const Entity*, CameraComponent* pCamera) { UnregisterCamera(pCamera); });
+    m_componentRouter.AddRoute<StaticMeshComponent>(
+        [this](const Entity*, StaticMeshComponent* pComponent) { RegisterStaticMesh(pComponent); },
+        [this](const Entity*, StaticMeshComponent* pComponent) { UnregisterStaticMesh(pComponent); });
+    m_componentRouter.AddRoute<SkeletalMeshComponent>(
+        [this](const Entity*, SkeletalMeshComponent* pComponent) { RegisterSkeletalMesh(pComponent); },
+        [this](const Entity*, SkeletalMeshComponent* pComponent) { UnregisterSkeletalMesh(pComponent); });
+    m_componentRouter.AddRoute<Light>(
+        [this](const Entity*, Light* pLight) { m_renderData.m_lightComponents.PushBack(pLight); },
+        [this](const Entity*, Light* pLight) { m_renderData.m_lightComponents.Erase(pLight); });
 }
 
 void GraphicsSystem::Update(const UpdateContext& context)
@@ -74,8 +46,7 @@ void GraphicsSystem::Update(const UpdateContext& context)
 
     ZoneScoped;
 
-    assert(m_renderData.m_pCameraComponent != nullptr);
-    if (!m_renderData.m_pCameraComponent->IsInitialized())
+    if (m_renderData.m_pCameraComponent == nullptr || !m_renderData.m_pCameraComponent->IsInitialized())
     {
         return; // Camera is the only necessary component, return if it's not loaded yet
     }
@@ -88,7 +59,7 @@ void GraphicsSystem::Update(const UpdateContext& context)
     // Problem is we might have multiple worlds that should be rendered by different renderers
     // (i.e. editor preview windows)
     // Previews can have their own world, but the service should be shared
-    auto pRenderingService = context.GetService<RenderingService>();
+    // Culling does not depend on the rendering service, so that it also runs on headless engines
 
     // Update viewport info
     m_aspectRatio = context.GetDisplayWidth() / context.GetDisplayHeight();
@@ -112,108 +83,101 @@ void GraphicsSystem::Update(const UpdateContext& context)
         for (auto pSkeletalMeshComponent : meshInstance.m_components)
         {
             // TODO: Cull
-            pSkeletalMeshComponent->UpdateSkinningTransforms();
             m_renderData.m_visibleSkeletalMeshComponents.push_back(pSkeletalMeshComponent);
         }
     }
+}
+
+void GraphicsSystem::PrepareRender()
+{
+    ZoneScoped;
+
+    // Skinning depends on the render interpolation factor, so it runs every rendered frame even if the simulation did not tick
+    for (auto& meshInstance : m_skeletalMeshRenderInstances)
+    {
+        for (auto pSkeletalMeshComponent : meshInstance.m_components)
+        {
+            pSkeletalMeshComponent->UpdateSkinningTransforms();
+        }
+    }
 
-    /// @todo Keep cb inside the renderer once we've moved debug rendering
-    //auto& cb = m_pRenderer->GetActiveRenderTarget().commandBuffer.get();
-    //m_pRenderer->Render(data, cb);
-
-    // Debug drawing
-    /// @todo: Move to a dedicated renderer
-    //DrawingContext drawingContext;
-    //for (auto& meshInstance : m_skeletalMeshRenderInstances)
-    //{
-    //    for (const auto& pSkeletalMeshComponent : meshInstance.m_components)
-    //    {
-    //        if (pSkeletalMeshComponent->m_drawDebugSkeleton)
-    //        {
-    //            pSkeletalMeshComponent->DrawPose(drawingContext);
-    //        }
-    //        // pSkeletalMeshComponent->DrawBindPose(drawingContext);
-    //    }
-    //}
-
-    //RenderDebugLines(cb, drawingContext);
-
-    //m_pRenderer->EndFrame();
+    // Gather the debug geometry every thread drew during the simulation
+    DebugDrawing::CollectVertices(m_renderData.m_debugVertices);
 }
 
-void GraphicsSystem::RegisterComponent(const Entity* pEntity, IComponent* pComponent)
+void GraphicsSystem::RegisterCamera(CameraComponent* pCamera)
 {
     // Set the first registered camera as the active one
-    auto pCamera = dynamic_cast<CameraComponent*>(pComponent);
-    if (m_renderData.m_pCameraComponent == nullptr && pCamera != nullptr)
+    if (m_renderData.m_pCameraComponent == nullptr)
     {
         m_renderData.m_pCameraComponent = pCamera;
-        return;
     }
+}
 
-    auto pStaticMeshComponent = dynamic_cast<StaticMeshComponent*>(pComponent);
-    if (pStaticMeshComponent != nullptr)
+void GraphicsSystem::UnregisterCamera(CameraComponent* pCamera)
+{
+    if (m_renderData.m_pCameraComponent == pCamera)
     {
-        auto& meshInstance = m_staticMeshRenderInstances.TryEmplace(pStaticMeshComponent->GetMesh()->GetID(), pStaticMeshComponent->GetMesh());
-        meshInstance.m_components.PushBack(pStaticMeshComponent);
-        return;
+        m_renderData.m_pCameraComponent = nullptr;
     }
+}
 
-    auto pSkeletalMeshComponent = dynamic_cast<SkeletalMeshComponent*>(pComponent);
-    if (pSkeletalMeshComponent != nullptr)
-    {
-        auto& meshInstance = m_skeletalMeshRenderInstances.TryEmplace(pSkeletalMeshComponent->GetMesh()->GetID(), pSkeletalMeshComponent->GetMesh());
-        meshInstance.m_components.PushBack(pSkeletalMeshComponent);
-        return;
-    }
+void GraphicsSystem::RegisterStaticMesh(StaticMeshComponent* pStaticMeshComponent)
+{
+    auto& meshInstance = m_staticMeshRenderInstances.TryEmplace(pStaticMeshComponent->GetMesh()->GetID(), pStaticMeshComponent->GetMesh());
+    meshInstance.m_components.PushBack(pStaticMeshComponent);
+}
 
-    auto pLight = dynamic_cast<Light*>(pComponent);
-    if (pLight != nullptr)
+void GraphicsSystem::UnregisterStaticMesh(StaticMeshComponent* pStaticMeshComponent)
+{
+    auto& meshInstance = m_staticMeshRenderInstances.Get(pStaticMeshComponent->GetMesh()->GetID());
+    meshInstance.m_components.Erase(pStaticMeshComponent);
+    if (meshInstance.m_components.Empty())
     {
-        m_renderData.m_lightComponents.PushBack(pLight);
-        return;
+        m_staticMeshRenderInstances.Erase(meshInstance);
     }
 }
 
-void GraphicsSystem::UnregisterComponent(const Entity* pEntity, IComponent* pComponent)
+void GraphicsSystem::RegisterSkeletalMesh(SkeletalMeshComponent* pSkeletalMeshComponent)
+{
+    auto& meshInstance = m_skeletalMeshRenderInstances.TryEmplace(pSkeletalMeshComponent->GetMesh()->GetID(), pSkeletalMeshComponent->GetMesh());
+    meshInstance.m_components.PushBack(pSkeletalMeshComponent);
+}
+
+void GraphicsSystem::UnregisterSkeletalMesh(SkeletalMeshComponent* pSkeletalMeshComponent)
 {
-    auto pCamera = dynamic_cast<CameraComponent*>(pComponent);
-    if (pCamera != nullptr)
+    auto& meshInstance = m_skeletalMeshRenderInstances.Get(pSkeletalMeshComponent->GetMesh()->GetID());
+    meshInstance.m_components.Erase(pSkeletalMeshComponent);
+    if (meshInstance.m_components.Empty())
     {
-        assert(m_renderData.m_pCameraComponent != nullptr);
-        m_renderData.m_pCameraComponent = nullptr;
-        return;
+        m_skeletalMeshRenderInstances.Erase(meshInstance);
     }
+}
 
-    auto pStaticMeshComponent = dynamic_cast<StaticMeshComponent*>(pComponent);
-    if (pStaticMeshComponent != nullptr)
+void GraphicsSystem::HandleAssetReloaded(const AssetID& assetID)
+{
+    // Components reach the new mesh through their handles, render instances keep the previous one until they are refreshed.
+    // The previous mesh is still alive at this point, so that instances can be matched by its ID
+    for (auto& meshInstance : m_staticMeshRenderInstances)
     {
-        auto& meshInstance = m_staticMeshRenderInstances.Get(pStaticMeshComponent->GetMesh()->GetID());
-        meshInstance.m_components.Erase(pStaticMeshComponent);
-        if (meshInstance.m_components.Empty())
+        if (meshInstance.GetID() == assetID)
         {
-            m_staticMeshRenderInstances.Erase(meshInstance);
+            meshInstance.m_pMesh = (*meshInstance.m_components.begin())->GetMesh();
         }
-        return;
     }
 
-    auto pSkeletalMeshComponent = dynamic_cast<SkeletalMeshComponent*>(pComponent);
-    if (pSkeletalMeshComponent != nullptr)
+    for (auto& meshInstance : m_skeletalMeshRenderInstances)
     {
-        auto& meshInstance = m_skeletalMeshRenderInstances.Get(pSkeletalMeshComponent->GetMesh()->GetID());
-        meshInstance.m_components.Erase(pSkeletalMeshComponent);
-        if (meshInstance.m_components.Empty())
+        if (meshInstance.GetID() == assetID)
         {
-            m_skeletalMeshRenderInstances.Erase(meshInstance);
-        }
-        return;
-    }
+            meshInstance.m_pMesh = (*meshInstance.m_components.begin())->GetMesh();
 
-    auto pLight = dynamic_cast<Light*>(pComponent);
-    if (pLight != nullptr)
-    {
-        m_renderData.m_lightComponents.Erase(pLight);
-        return;
+            // The bone layout might have changed
+            for (auto pSkeletalMeshComponent : meshInstance.m_components)
+            {
+                pSkeletalMeshComponent->InitializeBones();
+            }
+        }
     }
 }
 
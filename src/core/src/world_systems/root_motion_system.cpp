@@ -0,0 +1,144 @@
+#include "world_systems/root_motion_system.hpp"
+
+#include "components/animation_graph.hpp"
+#include "components/skeletal_mesh_component.hpp"
+
+#include <entities/entity.hpp>
+
+#include <tracy/Tracy.hpp>
+
+namespace aln
+{
+
+RootMotionSystem::CharacterRecord* RootMotionSystem::FindRecord(const Entity* pEntity)
+{
+    auto it = m_recordIndices.find(pEntity);
+    if (it == m_recordIndices.end())
+    {
+        return nullptr;
+    }
+    return &m_characterRecords[it->second];
+}
+
+void RootMotionSystem::Initialize()
+{
+    m_updatePriorities.SetPriorityForStage(UpdateStage::PrePhysics, 0);
+
+    m_componentRouter.AddRoute<AnimationGraphComponent>(
+        [this](const Entity* pEntity, AnimationGraphComponent* pComponent) { RegisterGraphComponent(pEntity, pComponent); },
+        [this](const Entity* pEntity, AnimationGraphComponent* pComponent) { UnregisterGraphComponent(pEntity, pComponent); });
+    m_componentRouter.AddRoute<SkeletalMeshComponent>(
+        [this](const Entity* pEntity, SkeletalMeshComponent* pComponent) { RegisterRootComponent(pEntity, pComponent); },
+        [this](const Entity* pEntity, SkeletalMeshComponent* pComponent) { UnregisterRootComponent(pEntity, pComponent); });
+}
+
+void RootMotionSystem::Shutdown()
+{
+    m_characterRecords.clear();
+    m_recordIndices.clear();
+}
+
+void RootMotionSystem::Update(const UpdateContext& context)
+{
+    if (context.GetUpdateStage() != UpdateStage::PrePhysics)
+    {
+        return;
+    }
+
+    ZoneScoped;
+
+    for (auto& record : m_characterRecords)
+    {
+        if (record.m_pGraphComponent == nullptr || record.m_pRootComponent == nullptr)
+        {
+            continue;
+        }
+
+        const auto& rootMotionDelta = record.m_pGraphComponent->GetRootMotionDelta();
+        if (rootMotionDelta == Transform::Identity)
+        {
+            continue;
+        }
+
+        const auto& characterWorldTransform = record.m_pRootComponent->GetWorldTransform();
+        auto characterLocalTransform = record.m_pRootComponent->GetLocalTransform();
+
+        // Root motion is extracted in character space, bring the translation to world space
+        auto deltaTranslation = characterWorldTransform.ScaleVector(rootMotionDelta.GetTranslation());
+        deltaTranslation = characterWorldTransform.RotateVector(deltaTranslation);
+
+        characterLocalTransform.AddTranslation(deltaTranslation);
+        characterLocalTransform.AddRotation(rootMotionDelta.GetRotation());
+
+        record.m_pRootComponent->SetLocalTransform(characterLocalTransform);
+    }
+}
+
+RootMotionSystem::CharacterRecord& RootMotionSystem::FindOrAddRecord(const Entity* pEntity)
+{
+    auto [it, inserted] = m_recordIndices.try_emplace(pEntity, (uint32_t) m_characterRecords.size());
+    if (inserted)
+    {
+        m_characterRecords.emplace_back().m_pEntity = pEntity;
+    }
+    return m_characterRecords[it->second];
+}
+
+void RootMotionSystem::RemoveRecordIfEmpty(CharacterRecord* pRecord)
+{
+    // Swap and pop to keep the records contiguous
+    if (pRecord->IsEmpty())
+    {
+        const auto recordIdx = (uint32_t) (pRecord - m_characterRecords.data());
+        m_recordIndices.erase(pRecord->m_pEntity);
+
+        *pRecord = m_characterRecords.back();
+        m_characterRecords.pop_back();
+        if (recordIdx < m_characterRecords.size())
+        {
+            m_recordIndices[pRecord->m_pEntity] = recordIdx;
+        }
+    }
+}
+
+void RootMotionSystem::RegisterGraphComponent(const Entity* pEntity, AnimationGraphComponent* pGraphComponent)
+{
+    auto& record = FindOrAddRecord(pEntity);
+    assert(record.m_pGraphComponent == nullptr);
+    record.m_pGraphComponent = pGraphComponent;
+}
+
+void RootMotionSystem::UnregisterGraphComponent(const Entity* pEntity, AnimationGraphComponent* pGraphComponent)
+{
+    auto pRecord = FindRecord(pEntity);
+    if (pRecord != nullptr && pRecord->m_pGraphComponent == pGraphComponent)
+    {
+        pRecord->m_pGraphComponent = nullptr;
+        RemoveRecordIfEmpty(pRecord);
+    }
+}
+
+void RootMotionSystem::RegisterRootComponent(const Entity* pEntity, SkeletalMeshComponent* pSkeletalMeshComponent)
+{
+    // Root motion moves the whole character, so only the mesh at the root of the entity is driven.
+    // Other skeletal meshes (i.e. attachments) follow it through the spatial hierarchy
+    if (pEntity->GetRootSpatialComponent() != pSkeletalMeshComponent)
+    {
+        return;
+    }
+
+    auto& record = FindOrAddRecord(pEntity);
+    record.m_pRootComponent = pSkeletalMeshComponent;
+}
+
+void RootMotionSystem::UnregisterRootComponent(const Entity* pEntity, SkeletalMeshComponent* pSkeletalMeshComponent)
+{
+    auto pRecord = FindRecord(pEntity);
+    if (pRecord != nullptr && pRecord->m_pRootComponent == pSkeletalMeshComponent)
+    {
+        pRecord->m_pRootComponent = nullptr;
+        RemoveRecordIfEmpty(pRecord);
+    }
+}
+
+} // namespace aln
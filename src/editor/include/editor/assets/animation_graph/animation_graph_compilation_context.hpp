@@ -21,6 +21,12 @@ class AnimationGraphCompilationContext
         std::string m_message = "";
     };
 
+    struct NodeMemoryInfo
+    {
+        size_t m_size = 0;
+        size_t m_alignment = 0;
+    };
+
   private:
     const EditorAnimationGraph* const m_pRootGraph = nullptr;
     const EditorAnimationGraph* m_pCurrentAnimationGraph = nullptr; // The (potentially child-) graph currently compiling
@@ -28,8 +34,7 @@ class AnimationGraphCompilationContext
     Vector<const EditorAnimationGraphNode*> m_compiledNodes;
     Vector<UUID> m_registeredDataSlots;
 
-    size_t m_currentNodeMemoryOffset = 0;
-    size_t m_maxNodeMemoryAlignement = 0;
+    Vector<NodeMemoryInfo> m_nodeMemoryInfos; // Size and alignment of the runtime node types, by node index
 
     Vector<CompilationLogEntry> m_errorLog;
 
@@ -72,11 +77,10 @@ class AnimationGraphCompilationContext
         graphDefinition.m_nodeSettings.push_back(pOutSettings);
         graphDefinition.m_nodeIndices.push_back(pOutSettings->m_nodeIndex);
 
-        // Update instance required memory info
-        graphDefinition.m_nodeOffsets.push_back(m_currentNodeMemoryOffset);
-        m_maxNodeMemoryAlignement = Maths::Max(m_maxNodeMemoryAlignement, alignof(T));
-        const auto requiredPadding = (alignof(T) - (m_currentNodeMemoryOffset % m_maxNodeMemoryAlignement)) % m_maxNodeMemoryAlignement;
-        m_currentNodeMemoryOffset += (sizeof(T) + requiredPadding);
+        // Instance memory layout is computed once all settings are populated
+        auto& memoryInfo = m_nodeMemoryInfos.emplace_back();
+        memoryInfo.m_size = sizeof(T);
+        memoryInfo.m_alignment = alignof(T);
 
         m_compiledNodes.push_back(pNode);
 
@@ -92,8 +96,43 @@ class AnimationGraphCompilationContext
 
     const Vector<UUID>& GetRegisteredDataSlots() const { return m_registeredDataSlots; }
 
-    size_t GetNodeMemoryOffset() const { return m_currentNodeMemoryOffset; }
-    size_t GetNodeMemoryAlignement() const { return m_maxNodeMemoryAlignement; }
+    /// @brief Lay out the memory block of the graph's runtime instances once all nodes are compiled: the node pointers table first,
+    /// then each node followed by its variable-size data, so that instanciating a graph requires a single allocation
+    void ComputeInstanceMemoryLayout(AnimationGraphDefinition& graphDefinition) const
+    {
+        const auto nodeCount = graphDefinition.m_nodeSettings.size();
+        assert(nodeCount == m_nodeMemoryInfos.size());
+
+        auto alignOffset = [](size_t offset, size_t alignment)
+        { return (offset + alignment - 1) & ~(alignment - 1); };
+
+        size_t offset = nodeCount * sizeof(RuntimeGraphNode*);
+        size_t maxAlignment = alignof(RuntimeGraphNode*);
+
+        graphDefinition.m_nodeOffsets.clear();
+        graphDefinition.m_nodeOffsets.reserve(nodeCount);
+        for (auto nodeIdx = 0; nodeIdx < nodeCount; ++nodeIdx)
+        {
+            const auto& memoryInfo = m_nodeMemoryInfos[nodeIdx];
+            const auto instanceDataSize = graphDefinition.m_nodeSettings[nodeIdx]->GetInstanceDataSize();
+
+            auto alignment = memoryInfo.m_alignment;
+            auto size = memoryInfo.m_size;
+            if (instanceDataSize > 0)
+            {
+                alignment = Maths::Max(alignment, NodeInstanceDataBuffer::Alignment);
+                size = NodeInstanceDataBuffer::GetDataOffset(size) + instanceDataSize;
+            }
+
+            offset = alignOffset(offset, alignment);
+            graphDefinition.m_nodeOffsets.push_back(offset);
+            offset += size;
+            maxAlignment = Maths::Max(maxAlignment, alignment);
+        }
+
+        graphDefinition.m_requiredMemorySize = offset;
+        graphDefinition.m_requiredMemoryAlignement = maxAlignment;
+    }
 
     void LogError(const std::string& message, const EditorGraphNode* pSourceNode = nullptr)
     {
@@ -17,9 +17,9 @@ class AnimationGraphWorkspace : public IAssetWorkspace
 {
     struct GraphViewEventIDs
     {
-        UUID m_nodeDoubleClickedEventID = UUID::InvalidID;
-        UUID m_conduitDoubleClickedEventID = UUID::InvalidID;
-        UUID m_canvasDoubleClickedEventID = UUID::InvalidID;
+        EventListenerID m_nodeDoubleClickedEventID;
+        EventListenerID m_conduitDoubleClickedEventID;
+        EventListenerID m_canvasDoubleClickedEventID;
     };
 
   private:
@@ -49,7 +49,7 @@ class ParameterReferenceEditorNode : public EditorAnimationGraphNode
 
     void LoadState(const JSON& json, const TypeRegistryService* pTypeRegistryService) override
     {
-        uint32_t parameterIDHash = json["referenced_parameter"];
+        StringID::HashType parameterIDHash = json["referenced_parameter"];
         m_parameterID = StringID(parameterIDHash);
     }
 };
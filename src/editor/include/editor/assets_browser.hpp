@@ -11,19 +11,31 @@
 namespace aln
 {
 /// @brief Folder browser for assets
-/// @note This is pretty basic for now but it does the job.
+/// @note This is pretty basic for now but it does the job. The tree is built from the asset database and only rebuilt when it changes
 class AssetsBrowser : public IEditorWindow
 {
   private:
-    static const Vector<std::string> AssetExtensionsFilter;
+    struct DirectoryNode
+    {
+        std::filesystem::path m_path;
+        Vector<DirectoryNode> m_children;
+        Vector<AssetID> m_assets;
+    };
 
     std::filesystem::path m_currentFilePath;
     AssetID m_draggedAssetID;
 
+    DirectoryNode m_rootNode;
+    uint32_t m_databaseRevision = 0;
+    bool m_isTreeValid = false;
+
     std::filesystem::path m_selectedAsset = "";
     bool m_renaming = false;
 
-    void RecursiveDrawDirectory(const std::filesystem::directory_entry& directoryEntry);
+    void RebuildTree();
+    DirectoryNode& GetOrCreateNode(const std::filesystem::path& directory);
+    void DrawDirectory(const DirectoryNode& node);
+    void DrawAsset(const AssetID& assetID);
 
   public:
     AssetsBrowser(std::string folderPath) : m_currentFilePath(folderPath)
@@ -13,6 +13,7 @@ class TypeRegistryService;
 class IAssetHandle;
 class UpdateContext;
 class AssetService;
+class AssetDatabase;
 
 class EditorWindowContext
 {
@@ -31,6 +32,7 @@ class EditorWindowContext
     const TypeRegistryService* m_pTypeRegistryService = nullptr;
     // TODO: should be const
     AssetService* m_pAssetService = nullptr;
+    const AssetDatabase* m_pAssetDatabase = nullptr;
 
     Vector<AssetID> m_requestedAssetWindowsCreations;
     Vector<AssetID> m_requestedAssetWindowsDeletions;
@@ -58,6 +60,8 @@ class IEditorWindow
     Entity* GetSelectedEntity() const { return m_pEditorWindowContext->m_pSelectedEntity; }
     WorldEntity* GetWorldEntity() const { return m_pEditorWindowContext->m_pWorldEntity; }
 
+    const AssetDatabase* GetAssetDatabase() const { return m_pEditorWindowContext->m_pAssetDatabase; }
+
     // Reflected type properties
     void SetInspectedObject(reflect::IReflected* pObjectToInspect) { m_pEditorWindowContext->m_pInspectedObject = pObjectToInspect; }
     reflect::IReflected* GetInspectedObject() { return m_pEditorWindowContext->m_pInspectedObject; }
@@ -14,8 +14,8 @@ class PropertiesWindow : public IEditorWindow
 {
     reflect::IReflected* m_pInspectedObject = nullptr;
 
-    UUID m_propertyEditingStartedEventID;
-    UUID m_propertyEditingCompletedEventID;
+    EventListenerID m_propertyEditingStartedEventID;
+    EventListenerID m_propertyEditingCompletedEventID;
 
     // TODO: Move to the quaternion widget directly
     EulerAnglesDegrees m_currentEulerRotation; // Inspector's rotation is stored separately to avoid going back and forth between quat and euler
@@ -43,8 +43,7 @@ void AnimationGraphWorkspace::Compile()
     {
         // Finalize the definition
         m_graphDefinition.m_rootNodeIndex = rootNodeIndex;
-        m_graphDefinition.m_requiredMemoryAlignement = context.GetNodeMemoryAlignement();
-        m_graphDefinition.m_requiredMemorySize = context.GetNodeMemoryOffset();
+        context.ComputeInstanceMemoryLayout(m_graphDefinition);
 
         // TODO: Where does runtime asset serialization+saving occur ?
         // Serialize graph definition
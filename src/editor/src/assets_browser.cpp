@@ -1,133 +1,200 @@
 #include "assets_browser.hpp"
 
+#include <assets/asset_database.hpp>
+
 #include "imgui.h"
 #include "misc/cpp/imgui_stdlib.h"
 
+#include <algorithm>
+
 namespace aln
 {
 
-// TODO: This should be infered automatically from registered asset types
-const Vector<std::string> AssetsBrowser::AssetExtensionsFilter = {".anim", ".skel", ".mesh", ".smsh", ".text", ".agdf", ".agds"};
+AssetsBrowser::DirectoryNode& AssetsBrowser::GetOrCreateNode(const std::filesystem::path& directory)
+{
+    auto pNode = &m_rootNode;
+    auto nodePath = m_rootNode.m_path;
+    for (const auto& component : directory.lexically_relative(m_rootNode.m_path))
+    {
+        if (component == ".")
+        {
+            continue;
+        }
+
+        nodePath /= component;
+        auto it = std::find_if(pNode->m_children.begin(), pNode->m_children.end(), [&](const DirectoryNode& child)
+            { return child.m_path == nodePath; });
+        if (it == pNode->m_children.end())
+        {
+            auto& child = pNode->m_children.emplace_back();
+            child.m_path = nodePath;
+            pNode = &child;
+        }
+        else
+        {
+            pNode = &*it;
+        }
+    }
+    return *pNode;
+}
 
-void AssetsBrowser::RecursiveDrawDirectory(const std::filesystem::directory_entry& directoryEntry)
+void AssetsBrowser::RebuildTree()
 {
-    if (directoryEntry.is_directory())
+    const auto pAssetDatabase = GetAssetDatabase();
+
+    m_rootNode = DirectoryNode();
+    m_rootNode.m_path = pAssetDatabase->GetRootDirectory();
+
+    // Directories are sorted, so parents are created before their children and siblings stay in order
+    for (const auto& directory : pAssetDatabase->GetDirectories())
+    {
+        GetOrCreateNode(directory);
+    }
+
+    for (const auto& [assetID, entry] : pAssetDatabase->GetEntries())
+    {
+        GetOrCreateNode(std::filesystem::path(assetID.GetAssetPath()).parent_path()).m_assets.push_back(assetID);
+    }
+
+    // Sort the assets by path, recursively
+    Vector<DirectoryNode*> nodesToSort = {&m_rootNode};
+    while (!nodesToSort.empty())
     {
-        auto nodeID = directoryEntry.path().filename().string() + "##" + directoryEntry.path().stem().string();
-        bool nodeOpen = ImGui::TreeNodeEx(nodeID.c_str(), ImGuiTreeNodeFlags_SpanFullWidth);
+        auto pNode = nodesToSort.back();
+        nodesToSort.pop_back();
+
+        std::sort(pNode->m_assets.begin(), pNode->m_assets.end(), [](const AssetID& a, const AssetID& b)
+            { return a.GetAssetPath() < b.GetAssetPath(); });
 
-        if (ImGui::BeginDragDropTarget())
+        for (auto& child : pNode->m_children)
         {
-            if (const ImGuiPayload* pPayload = ImGui::AcceptDragDropPayload("AssetID", ImGuiDragDropFlags_AcceptNoDrawDefaultRect))
-            {
-                assert(pPayload->DataSize == sizeof(AssetID));
-                AssetID assetID = *((AssetID*) pPayload->Data);
-                std::filesystem::path originalAssetPath = std::filesystem::path(assetID.GetAssetPath());
-                std::filesystem::path newAssetPath = directoryEntry.path() / originalAssetPath.filename();
+            nodesToSort.push_back(&child);
+        }
+    }
 
-                // TODO: Better error handling
-                assert(!std::filesystem::exists(newAssetPath));
+    m_databaseRevision = pAssetDatabase->GetRevision();
+    m_isTreeValid = true;
+}
 
-                std::filesystem::rename(originalAssetPath, newAssetPath);
-                // TODO: Update asset dependencies
-            }
+void AssetsBrowser::DrawDirectory(const DirectoryNode& node)
+{
+    auto nodeID = node.m_path.filename().string() + "##" + node.m_path.stem().string();
+    bool nodeOpen = ImGui::TreeNodeEx(nodeID.c_str(), ImGuiTreeNodeFlags_SpanFullWidth);
+
+    if (ImGui::BeginDragDropTarget())
+    {
+        if (const ImGuiPayload* pPayload = ImGui::AcceptDragDropPayload("AssetID", ImGuiDragDropFlags_AcceptNoDrawDefaultRect))
+        {
+            assert(pPayload->DataSize == sizeof(AssetID));
+            AssetID assetID = *((AssetID*) pPayload->Data);
+            std::filesystem::path originalAssetPath = std::filesystem::path(assetID.GetAssetPath());
+            std::filesystem::path newAssetPath = node.m_path / originalAssetPath.filename();
+
+            // TODO: Better error handling
+            assert(!std::filesystem::exists(newAssetPath));
+
+            std::filesystem::rename(originalAssetPath, newAssetPath);
+            // TODO: Update asset dependencies
+        }
+
+        // TODO: Also handle moving folder hierarchies
 
-            // TODO: Also handle moving folder hierarchies
+        ImGui::EndDragDropTarget();
+    }
 
-            ImGui::EndDragDropTarget();
+    if (nodeOpen)
+    {
+        for (const auto& child : node.m_children)
+        {
+            DrawDirectory(child);
         }
 
-        if (nodeOpen)
+        for (const auto& assetID : node.m_assets)
         {
-            for (auto& childEntry : std::filesystem::directory_iterator(directoryEntry))
+            DrawAsset(assetID);
+        }
+
+        ImGui::TreePop();
+    }
+}
+
+void AssetsBrowser::DrawAsset(const AssetID& assetID)
+{
+    const std::filesystem::path assetPath = assetID.GetAssetPath();
+
+    ImGuiTreeNodeFlags nodeFlags = ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen | ImGuiTreeNodeFlags_SpanFullWidth;
+    if (assetPath == m_selectedAsset)
+    {
+        nodeFlags = nodeFlags |= ImGuiTreeNodeFlags_Selected;
+    }
+
+    // Renaming widget
+    if (assetPath == m_selectedAsset && m_renaming)
+    {
+        auto& style = ImGui::GetStyle();
+        ImGui::PushStyleVar(ImGuiStyleVar_IndentSpacing, style.IndentSpacing - style.FramePadding.x);
+        ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, {style.FramePadding.x, 0});
+        ImGui::Indent();
+
+        auto inputName = m_selectedAsset.stem().string();
+        if (ImGui::InputText("##rename", &inputName, ImGuiInputTextFlags_EnterReturnsTrue))
+        {
+            // TODO: Validate user input
+            auto newAbsolutePath = m_selectedAsset;
+            newAbsolutePath.replace_filename(inputName);
+            newAbsolutePath.replace_extension(m_selectedAsset.extension());
+
+            if (std::filesystem::exists(newAbsolutePath))
             {
-                RecursiveDrawDirectory(childEntry);
+                assert(false); // TODO
             }
-            ImGui::TreePop();
+
+            std::filesystem::rename(m_selectedAsset, newAbsolutePath);
+
+            // TODO: Propagate change to all dependant assets
+
+            m_selectedAsset = newAbsolutePath;
         }
+
+        ImGui::Unindent();
+        ImGui::PopStyleVar();
+        ImGui::PopStyleVar();
     }
     else
     {
-        auto ext = directoryEntry.path().extension().string();
-        auto it = std::find(AssetExtensionsFilter.begin(), AssetExtensionsFilter.end(), ext);
-        if (it != AssetExtensionsFilter.end())
+        ImGui::TreeNodeEx(assetPath.filename().string().c_str(), nodeFlags);
+
+        if (ImGui::IsItemClicked())
         {
-            ImGuiTreeNodeFlags nodeFlags = ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen | ImGuiTreeNodeFlags_SpanFullWidth;
-            if (directoryEntry.path() == m_selectedAsset)
-            {
-                nodeFlags = nodeFlags |= ImGuiTreeNodeFlags_Selected;
-            }
+            m_selectedAsset = assetPath;
+            m_renaming = false;
+        }
 
-            // Renaming widget
-            if (directoryEntry.path() == m_selectedAsset && m_renaming)
-            {
-                auto& style = ImGui::GetStyle();
-                ImGui::PushStyleVar(ImGuiStyleVar_IndentSpacing, style.IndentSpacing - style.FramePadding.x);
-                ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, {style.FramePadding.x, 0});
-                ImGui::Indent();
-
-                auto inputName = m_selectedAsset.stem().string();
-                if (ImGui::InputText("##rename", &inputName, ImGuiInputTextFlags_EnterReturnsTrue))
-                {
-                    // TODO: Validate user input
-                    auto newAbsolutePath = m_selectedAsset;
-                    newAbsolutePath.replace_filename(inputName);
-                    newAbsolutePath.replace_extension(m_selectedAsset.extension());
-
-                    if (std::filesystem::exists(newAbsolutePath))
-                    {
-                        assert(false); // TODO
-                    }
-
-                    std::filesystem::rename(m_selectedAsset, newAbsolutePath);
-
-                    // TODO: Propagate change to all dependant assets
-
-                    m_selectedAsset = newAbsolutePath;
-                }
-
-                ImGui::Unindent();
-                ImGui::PopStyleVar();
-                ImGui::PopStyleVar();
-            }
-            else
+        if (ImGui::IsItemClicked() && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
+        {
+            RequestAssetWindowCreation(assetID);
+        }
+
+        if (ImGui::BeginPopupContextItem(nullptr, ImGuiPopupFlags_MouseButtonRight))
+        {
+            m_renaming = false;
+            if (ImGui::MenuItem("Rename..."))
             {
-                ImGui::TreeNodeEx(directoryEntry.path().filename().string().c_str(), nodeFlags);
-
-                if (ImGui::IsItemClicked())
-                {
-                    m_selectedAsset = directoryEntry.path();
-                    m_renaming = false;
-                }
-
-                if (ImGui::IsItemClicked() && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
-                {
-                    AssetID id = AssetID(directoryEntry.path().string());
-                    RequestAssetWindowCreation(id);
-                }
-
-                if (ImGui::BeginPopupContextItem(nullptr, ImGuiPopupFlags_MouseButtonRight))
-                {
-                    m_renaming = false;
-                    if (ImGui::MenuItem("Rename..."))
-                    {
-                        m_selectedAsset = directoryEntry.path();
-                        m_renaming = true;
-                    }
-                    ImGui::EndPopup();
-                }
-
-                if (ImGui::BeginDragDropSource())
-                {
-                    // Dragged tooltip
-                    ImGui::Text(directoryEntry.path().string().c_str());
-
-                    m_draggedAssetID = AssetID(directoryEntry.path().string());
-                    ImGui::SetDragDropPayload("AssetID", &m_draggedAssetID, sizeof(AssetID));
-
-                    ImGui::EndDragDropSource();
-                }
+                m_selectedAsset = assetPath;
+                m_renaming = true;
             }
+            ImGui::EndPopup();
+        }
+
+        if (ImGui::BeginDragDropSource())
+        {
+            // Dragged tooltip
+            ImGui::Text(assetPath.string().c_str());
+
+            m_draggedAssetID = assetID;
+            ImGui::SetDragDropPayload("AssetID", &m_draggedAssetID, sizeof(AssetID));
+
+            ImGui::EndDragDropSource();
         }
     }
 }
@@ -138,9 +205,23 @@ void AssetsBrowser::Update(const UpdateContext& context)
     ImGui::Text(m_currentFilePath.string().c_str());
     ImGui::Separator();
 
-    for (auto& directoryEntry : std::filesystem::directory_iterator(m_currentFilePath))
+    const auto pAssetDatabase = GetAssetDatabase();
+    if (pAssetDatabase != nullptr)
     {
-        RecursiveDrawDirectory(directoryEntry);
+        if (!m_isTreeValid || m_databaseRevision != pAssetDatabase->GetRevision())
+        {
+            RebuildTree();
+        }
+
+        for (const auto& child : m_rootNode.m_children)
+        {
+            DrawDirectory(child);
+        }
+
+        for (const auto& assetID : m_rootNode.m_assets)
+        {
+            DrawAsset(assetID);
+        }
     }
 
     ImGui::End();
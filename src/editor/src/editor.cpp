@@ -3,8 +3,10 @@
 #include "assets/animation_clip_workspace.hpp"
 #include "assets/animation_graph/animation_graph_workspace.hpp"
 
+#include <assets/asset_database.hpp>
 #include <assets/asset_service.hpp>
 #include <common/memory.hpp>
+#include <common/memory/frame_arena.hpp>
 #include <config/path.h>
 #include <core/components/camera.hpp>
 #include <core/entity_systems/camera_controller.hpp>
@@ -20,6 +22,8 @@
 #include <imgui_internal.h>
 #include <imnodes.h>
 
+#include <iostream>
+
 namespace aln
 {
 namespace editor
@@ -163,6 +167,69 @@ void Editor::Update(const UpdateContext& context)
                 ImGui::Text("Sample Logs");
                 ImGui::EndTabItem();
             }
+
+            if (ImGui::BeginTabItem("Asset Memory"))
+            {
+                if (ImGui::BeginTable("AssetMemoryTable", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders))
+                {
+                    ImGui::TableSetupColumn("Type");
+                    ImGui::TableSetupColumn("Count");
+                    ImGui::TableSetupColumn("CPU (KiB)");
+                    ImGui::TableSetupColumn("GPU (KiB)");
+                    ImGui::TableHeadersRow();
+
+                    for (const auto& [typeID, usage] : m_editorWindowContext.m_pAssetService->GetMemoryReport())
+                    {
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(typeID.ToString().c_str());
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%u", usage.m_assetCount);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%.1f", usage.m_cpuBytes / 1024.0f);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%.1f", usage.m_gpuBytes / 1024.0f);
+                    }
+                    ImGui::EndTable();
+                }
+                ImGui::EndTabItem();
+            }
+
+            if (ImGui::BeginTabItem("Memory"))
+            {
+                if (ImGui::BeginTable("MemoryTagsTable", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders))
+                {
+                    ImGui::TableSetupColumn("Tag");
+                    ImGui::TableSetupColumn("Live (KiB)");
+                    ImGui::TableSetupColumn("Peak (KiB)");
+                    ImGui::TableSetupColumn("Allocations");
+                    ImGui::TableSetupColumn("Allocations (Frame)");
+                    ImGui::TableHeadersRow();
+
+                    for (uint8_t tag = 0; tag < (uint8_t) MemoryTag::Count; ++tag)
+                    {
+                        const auto stats = Memory::GetTagStats((MemoryTag) tag);
+
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(Memory::GetTagName((MemoryTag) tag));
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%.1f", stats.m_liveBytes / 1024.0f);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%.1f", stats.m_highWaterMark / 1024.0f);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%lld", stats.m_liveAllocationCount);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%lld", stats.m_frameAllocationCount);
+                    }
+                    ImGui::EndTable();
+                }
+
+                const auto& frameArena = Memory::GetFrameArena();
+                ImGui::Text("Frame arena: %.1f / %.1f KiB (peak %.1f KiB)", frameArena.GetUsedBytes() / 1024.0f, frameArena.GetCapacity() / 1024.0f, frameArena.GetHighWaterMark() / 1024.0f);
+                ImGui::Text("Thread caches reserved: %.1f KiB", Memory::GetCachedHeapReservedBytes() / 1024.0f);
+                ImGui::EndTabItem();
+            }
             ImGui::EndTabBar();
         }
     }
@@ -407,6 +474,7 @@ void Editor::Initialize(ServiceProvider& serviceProvider, const std::filesystem:
 
     // TODO: we could register type editor service to the provider here but for it shouldnt be required elsewhere
     m_editorWindowContext.m_pAssetService = serviceProvider.GetService<AssetService>();
+    m_editorWindowContext.m_pAssetDatabase = serviceProvider.GetService<AssetDatabase>();
     m_editorWindowContext.m_pTypeRegistryService = serviceProvider.GetService<TypeRegistryService>();
     m_editorWindowContext.m_pWorldEntity = &m_worldEntity;
 
@@ -465,6 +533,18 @@ void Editor::LoadScene()
     BinaryFileArchive archive(m_scenePath, IBinaryArchive::IOMode::Read);
     archive >> mapDescriptor;
 
+    if (!archive.IsValid())
+    {
+        std::cout << "Failed to read scene archive: " << m_scenePath << std::endl;
+        return;
+    }
+
+    if (!mapDescriptor.IsValid())
+    {
+        std::cout << "Scene archive uses an outdated format and must be saved again: " << m_scenePath << std::endl;
+        return;
+    }
+
     mapDescriptor.InstanciateEntityMap(m_worldEntity.m_entityMap, m_worldEntity.m_loadingContext, *m_pTypeRegistryService);
 }
 
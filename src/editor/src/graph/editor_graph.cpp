@@ -102,7 +102,7 @@ void EditorGraph::LoadState(const JSON& json, const TypeRegistryService* pTypeRe
 
     for (const auto& nodeJson : json["nodes"])
     {
-        uint32_t typeID = nodeJson["type"];
+        StringID::HashType typeID = nodeJson["type"];
         auto pTypeInfo = pTypeRegistryService->GetTypeInfo(typeID);
 
         auto pNode = pTypeInfo->CreateTypeInstance<EditorGraphNode>();
@@ -112,7 +112,7 @@ void EditorGraph::LoadState(const JSON& json, const TypeRegistryService* pTypeRe
         if (nodeJson.contains("child_graph"))
         {
             const auto& childGraphJson = nodeJson["child_graph"];
-            uint32_t typeID = childGraphJson["type"];
+            StringID::HashType typeID = childGraphJson["type"];
             const auto pTypeInfo = pTypeRegistryService->GetTypeInfo(typeID);
 
             pNode->m_pChildGraph = pTypeInfo->CreateTypeInstance<EditorGraph>();
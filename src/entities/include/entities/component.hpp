@@ -1,9 +1,12 @@
 #pragma once
 
-#include <common/uuid.hpp>
 #include <future>
 #include <reflection/reflected_type.hpp>
+#include <reflection/type_info.hpp>
 
+#include <type_traits>
+
+#include "entity_id.hpp"
 #include "loading_context.hpp"
 
 namespace aln
@@ -17,8 +20,8 @@ class IComponent : public reflect::IReflected
     friend class WorldEntity;
 
   private:
-    const UUID m_ID = UUID::Generate();
-    UUID m_entityID = UUID::InvalidID; // Entity this component is attached to.
+    const ComponentID m_ID = ComponentID::Generate();
+    EntityID m_entityID; // Entity this component is attached to.
     bool m_isSingleton = false;          // Whether you can have multiple components of this type per entity
 
     bool m_registeredWithEntitySystems = false;
@@ -71,7 +74,12 @@ class IComponent : public reflect::IReflected
     Status m_status = Status::Unloaded;
 
   public:
-    virtual ~IComponent() {}
+    IComponent() = default;
+    virtual ~IComponent() { ComponentID::Release(m_ID); }
+
+    // The runtime ID is released on destruction, copies would release it twice
+    IComponent(const IComponent&) = delete;
+    IComponent& operator=(const IComponent&) = delete;
 
     inline bool IsInitialized() const { return m_status == Status::Initialized; }
     inline bool IsUnloaded() const { return m_status == Status::Unloaded; }
@@ -82,10 +90,23 @@ class IComponent : public reflect::IReflected
     inline bool IsRegisteredWithEntitySystems() const { return m_registeredWithEntitySystems; }
     inline bool IsRegisteredWithWorldSystems() const { return m_registeredWithWorldSystems; }
 
-    const UUID& GetID() const { return m_ID; }
-    const UUID& GetEntityID() const { return m_entityID; }
+    const ComponentID& GetID() const { return m_ID; }
+    const EntityID& GetEntityID() const { return m_entityID; }
 
     bool operator==(const IComponent& other) const { return m_ID == other.GetID(); }
     bool operator!=(const IComponent& other) const { return !operator==(other); }
 };
+
+/// @brief Cast a component to one of its reflected types, using its type info rather than RTTI
+/// @return nullptr if the component is not of type T or derived from it
+template <typename T>
+T* ComponentCast(IComponent* pComponent)
+{
+    static_assert(std::is_base_of_v<IComponent, T>, "Invalid component type");
+    if (pComponent == nullptr || !pComponent->GetTypeInfo()->IsDerivedFrom(T::GetStaticTypeInfo()->GetTypeID()))
+    {
+        return nullptr;
+    }
+    return static_cast<T*>(pComponent);
+}
 } // namespace aln
\ No newline at end of file
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "component.hpp"
+
+#include <common/containers/hash_map.hpp>
+#include <common/containers/vector.hpp>
+#include <common/string_id.hpp>
+#include <reflection/type_info.hpp>
+
+#include <assert.h>
+#include <functional>
+#include <stdint.h>
+#include <type_traits>
+
+namespace aln
+{
+
+/// @brief Dispatches component registrations to the handlers a system declared for the component types it consumes.
+/// Components are matched by reflected type ID, a handler declared for a base type also receives components of derived types.
+/// The handlers matching a concrete component type are resolved the first time this type is routed, later registrations are a single lookup
+/// @tparam Args: Arguments passed to the handlers before the component
+template <typename... Args>
+class ComponentRouter
+{
+    using Handler = std::function<void(Args..., IComponent*)>;
+
+    struct Route
+    {
+        StringID m_componentTypeID;
+        Handler m_onRegister;
+        Handler m_onUnregister;
+    };
+
+  private:
+    Vector<Route> m_routes;
+    HashMap<StringID, Vector<uint32_t>> m_resolvedRoutes; // Concrete component type ID -> Indices of the matching routes, in declaration order
+
+    const Vector<uint32_t>& Resolve(const reflect::TypeInfo* pComponentTypeInfo)
+    {
+        assert(pComponentTypeInfo != nullptr && pComponentTypeInfo->IsValid());
+
+        auto it = m_resolvedRoutes.find(pComponentTypeInfo->GetTypeID());
+        if (it != m_resolvedRoutes.end())
+        {
+            return it->second;
+        }
+
+        auto& routeIndices = m_resolvedRoutes[pComponentTypeInfo->GetTypeID()];
+        for (uint32_t routeIdx = 0; routeIdx < m_routes.size(); ++routeIdx)
+        {
+            if (pComponentTypeInfo->IsDerivedFrom(m_routes[routeIdx].m_componentTypeID))
+            {
+                routeIndices.push_back(routeIdx);
+            }
+        }
+        return routeIndices;
+    }
+
+  public:
+    /// @brief Declare a consumed component type
+    /// @tparam TComponent: Reflected component type. Handlers are also called for the types derived from it
+    template <typename TComponent>
+    void AddRoute(std::function<void(Args..., TComponent*)>&& onRegister, std::function<void(Args..., TComponent*)>&& onUnregister)
+    {
+        static_assert(std::is_base_of_v<IComponent, TComponent>, "Invalid component type");
+        assert(onRegister && onUnregister);
+
+        auto& route = m_routes.emplace_back();
+        route.m_componentTypeID = TComponent::GetStaticTypeInfo()->GetTypeID();
+        route.m_onRegister = [onRegister = std::move(onRegister)](Args... args, IComponent* pComponent)
+        { onRegister(args..., static_cast<TComponent*>(pComponent)); };
+        route.m_onUnregister = [onUnregister = std::move(onUnregister)](Args... args, IComponent* pComponent)
+        { onUnregister(args..., static_cast<TComponent*>(pComponent)); };
+
+        // Already resolved types might match the new route
+        m_resolvedRoutes.clear();
+    }
+
+    /// @brief Whether at least one handler consumes components of a type
+    bool Consumes(const reflect::TypeInfo* pComponentTypeInfo) { return !Resolve(pComponentTypeInfo).empty(); }
+
+    void Register(Args... args, IComponent* pComponent)
+    {
+        assert(pComponent != nullptr);
+        for (auto routeIdx : Resolve(pComponent->GetTypeInfo()))
+        {
+            m_routes[routeIdx].m_onRegister(args..., pComponent);
+        }
+    }
+
+    void Unregister(Args... args, IComponent* pComponent)
+    {
+        assert(pComponent != nullptr);
+        for (auto routeIdx : Resolve(pComponent->GetTypeInfo()))
+        {
+            m_routes[routeIdx].m_onUnregister(args..., pComponent);
+        }
+    }
+};
+} // namespace aln
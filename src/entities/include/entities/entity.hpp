@@ -1,5 +1,6 @@
 #pragma once
 
+#include "entity_id.hpp"
 #include "entity_system.hpp"
 #include "loading_context.hpp"
 #include "update_context.hpp"
@@ -38,7 +39,7 @@ class EntityInternalStateAction
 
     Type m_type;       // Type of action
     const void* m_ptr; // Pointer to the designed IComponent or system TypeInfo
-    UUID m_ID;         // Optional: ID of the spatial parent component
+    ComponentID m_ID;  // Optional: ID of the spatial parent component
 };
 
 /// @brief An Entity represents a single element in a scene/world. They're actual objects,
@@ -58,7 +59,7 @@ class Entity
     };
 
   private:
-    const UUID m_ID = UUID::Generate();
+    const EntityID m_ID = EntityID::Generate();
     std::string m_name;
     Status m_status = Status::Unloaded;
 
@@ -75,10 +76,11 @@ class Entity
     UUID m_parentAttachmentSocketID;     // TODO: ?
     bool m_isAttachedToParent = false;
 
-    static Event<Entity*> EntityStateUpdatedEvent;
+    // Fired when deferred actions are queued on an entity. Batched, the entity maps dispatch it once per loading step
+    static DeferredEvent<Entity*> EntityStateUpdatedEvent;
     Vector<EntityInternalStateAction> m_deferredActions;
 
-    SpatialComponent* GetSpatialComponent(const UUID& spatialComponentID);
+    SpatialComponent* GetSpatialComponent(const ComponentID& spatialComponentID);
 
     /// @brief Create a new system and add it to this Entity.
     /// An Entity can only have one system of a given type (subtypes included).
@@ -112,7 +114,11 @@ class Entity
     Entity(){};
     ~Entity();
 
-    const UUID& GetID() const { return m_ID; };
+    // The runtime ID is released on destruction, copies would release it twice
+    Entity(const Entity&) = delete;
+    Entity& operator=(const Entity&) = delete;
+
+    const EntityID& GetID() const { return m_ID; };
     std::string& GetName() { return m_name; }
 
     /// @brief Whether this entity is loaded (some components might still be loading in case of dynamic add)
@@ -127,6 +133,7 @@ class Entity
 
     /// @todo Consider implications of this being public ?
     SpatialComponent* GetRootSpatialComponent() { return m_pRootSpatialComponent; }
+    const SpatialComponent* GetRootSpatialComponent() const { return m_pRootSpatialComponent; }
 
     void LoadComponents(const LoadingContext& loadingContext);
     void UnloadComponents(const LoadingContext& loadingContext);
@@ -186,13 +193,13 @@ class Entity
     // -------------------------------------------------
 
     /// @brief Destroy a component from this entity
-    /// @param componentID: UUID of the component to destroy.
-    void DestroyComponent(const UUID& componentID);
+    /// @param componentID: ID of the component to destroy.
+    void DestroyComponent(const ComponentID& componentID);
 
     /// @brief Add a component to this entity, taking ownership of it
     /// @param pComponent: Component to add.
-    /// @param parentSpatialComponentID: Only when adding a spatial component. UUID of the spatial component to attach to.
-    void AddComponent(IComponent* pComponent, const UUID& parentSpatialComponentID = UUID::InvalidID);
+    /// @param parentSpatialComponentID: Only when adding a spatial component. ID of the spatial component to attach to.
+    void AddComponent(IComponent* pComponent, const ComponentID& parentSpatialComponentID = ComponentID());
 
     const Vector<IComponent*>& GetComponents() { return m_components; }
 
@@ -3,6 +3,7 @@
 #include <common/containers/vector.hpp>
 #include <common/string_id.hpp>
 #include <common/types.hpp>
+#include <common/uuid.hpp>
 #include <reflection/type_descriptor.hpp>
 
 #include <string>
@@ -56,6 +57,7 @@ class SystemDescriptor
 class EntityDescriptor
 {
     friend class Entity;
+    friend class EntityMapDescriptor;
 
   private:
     struct SpatialComponentsRelationship
@@ -67,8 +69,8 @@ class EntityDescriptor
     static uint32_t GetComponentIndex(const Entity* pEntity, const IComponent* pComponent);
 
   private:
-    // TODO: Unique identifier, but UUID is not garanteed to stay the same between executions.
-    // Use name ? As a StringID maybe ?
+    // Persistent identifier. Runtime entity IDs are not stable between executions and are mapped to it on instanciation
+    UUID m_persistentID;
     std::string m_name;
     Vector<ComponentDescriptor> m_componentDescriptors;
     Vector<SystemDescriptor> m_systemDescriptors;
@@ -86,6 +88,7 @@ class EntityDescriptor
     template <class Archive>
     void Serialize(Archive& archive) const
     {
+        archive << m_persistentID;
         archive << m_name;
         archive << m_componentDescriptors;
         archive << m_systemDescriptors;
@@ -95,6 +98,7 @@ class EntityDescriptor
     template <class Archive>
     void Deserialize(Archive& archive)
     {
+        archive >> m_persistentID;
         archive >> m_name;
         archive >> m_componentDescriptors;
         archive >> m_systemDescriptors;
@@ -114,7 +118,15 @@ class EntityMapDescriptor
 
     static uint32_t GetEntityIndex(const EntityMap& entityMap, const Entity* pEntity);
 
+    /// @brief Written at the start of scene archives, to tell them apart from older ones which started directly with the entities
+    static constexpr uint32_t SceneArchiveMagic = 0x534E4C41; // "ALNS"
+    /// @brief Bump whenever the serialized layout of the descriptors changes
+    /// 2: Entity descriptors start with a persistent ID
+    static constexpr uint32_t SceneArchiveVersion = 2;
+
   private:
+    uint32_t m_magic = SceneArchiveMagic;
+    uint32_t m_version = SceneArchiveVersion;
     Vector<EntityDescriptor> m_entityDescriptors;
     Vector<SpatialEntitiesRelationship> m_spatialEntitiesRelationships;
 
@@ -124,10 +136,15 @@ class EntityMapDescriptor
 
     void InstanciateEntityMap(EntityMap& entityMap, const LoadingContext& loadingContext, const TypeRegistryService& typeRegistryService);
 
+    /// @brief Whether the descriptor was read from a scene archive in the current format
+    bool IsValid() const { return m_magic == SceneArchiveMagic && m_version == SceneArchiveVersion; }
+
   public:
     template <class Archive>
     void Serialize(Archive& archive) const
     {
+        archive << m_magic;
+        archive << m_version;
         archive << m_entityDescriptors;
         archive << m_spatialEntitiesRelationships;
     }
@@ -135,6 +152,13 @@ class EntityMapDescriptor
     template <class Archive>
     void Deserialize(Archive& archive)
     {
+        archive >> m_magic;
+        archive >> m_version;
+        if (!IsValid())
+        {
+            // Older or foreign archive, the rest can't be interpreted
+            return;
+        }
         archive >> m_entityDescriptors;
         archive >> m_spatialEntitiesRelationships;
     }
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <common/runtime_id.hpp>
+
+namespace aln
+{
+struct EntityIDTag
+{
+    static RuntimeIDPool& GetIDPool();
+};
+
+struct ComponentIDTag
+{
+    static RuntimeIDPool& GetIDPool();
+};
+
+/// @brief Runtime identifiers of entities and components. They are not persistent:
+/// entity descriptors store UUIDs, mapped to the runtime IDs when the entities are instanciated
+using EntityID = RuntimeID<EntityIDTag>;
+using ComponentID = RuntimeID<ComponentIDTag>;
+} // namespace aln
@@ -7,6 +7,8 @@
 
 #include <common/containers/vector.hpp>
 #include <common/containers/hash_map.hpp>
+#include <common/memory/pool_allocator.hpp>
+#include <common/uuid.hpp>
 
 #include <mutex>
 
@@ -25,9 +27,14 @@ class EntityMap
         Activated // All entities activated. Some might still be loading in case of dynamic adds
     };
 
-    /// @todo: Entities live on the heap. Profile !
+    // Entities are allocated from a pool owned by the map, and referenced everywhere else
+    PoolAllocator<Entity> m_entityPool = PoolAllocator<Entity>(MemoryTag::Entities);
     Vector<Entity*> m_entities;
-    HashMap<UUID, Entity*> m_entityLookupMap;
+    HashMap<EntityID, Entity*> m_entityLookupMap;
+
+    // Persistent IDs of the entities instanciated from descriptors, mapped to their runtime IDs
+    HashMap<UUID, EntityID> m_persistentIDLookupMap;
+    HashMap<EntityID, UUID> m_persistentIDs;
 
     Vector<Entity*> m_entitiesToAdd;
     Vector<Entity*> m_entitiesToRemove;
@@ -36,7 +43,7 @@ class EntityMap
     Vector<Entity*> m_entitiesToActivate;
     Vector<Entity*> m_entitiesToDeactivate;
 
-    UUID m_entityUpdateEventListenerID;
+    EventListenerID m_entityUpdateEventListenerID;
 
     // Mutex guarding the main entity collection
     std::recursive_mutex m_mutex;
@@ -44,8 +51,8 @@ class EntityMap
     Status m_status = Status::Unloaded;
     bool m_isTransientMap = false;
 
-    /// @brief Clear this map. If it is the main one, deactivate and unload
-    /// all entities in the underlying collection.
+    /// @brief Clear this map and release its entities. If it is the main one, deactivate and unload
+    /// them first.
     void Clear(const LoadingContext& loadingContext);
 
     inline bool IsActivated() const { return m_status == Status::Activated; }
@@ -73,9 +80,9 @@ class EntityMap
 
     // --------- Event Handling
 
+    /// @brief Called when the entities' state change events are dispatched, at the start of the loading step
     void OnEntityStateChanged(Entity* pEntity)
     {
-        // TODO: Mutex guard ?
         m_loadingEntities.push_back(pEntity);
     }
 
@@ -94,13 +101,32 @@ class EntityMap
     void RemoveEntity(Entity* pEntity);
 
     /// @brief Find an entity by ID.
-    Entity* FindEntity(const UUID& entityID) const
+    Entity* FindEntity(const EntityID& entityID) const
     {
         auto it = m_entityLookupMap.find(entityID);
         assert(it != m_entityLookupMap.end());
         return it->second;
     }
 
+    /// @brief Find an entity instanciated from a descriptor by its persistent ID.
+    /// @return nullptr if no entity with this persistent ID exists in this map
+    Entity* FindEntity(const UUID& persistentID) const
+    {
+        auto it = m_persistentIDLookupMap.find(persistentID);
+        if (it == m_persistentIDLookupMap.end())
+        {
+            return nullptr;
+        }
+        return FindEntity(it->second);
+    }
+
+    /// @brief Get the persistent ID of an entity, or an invalid one if it was not instanciated from a descriptor.
+    UUID GetPersistentID(const Entity* pEntity) const
+    {
+        auto it = m_persistentIDs.find(pEntity->GetID());
+        return it != m_persistentIDs.end() ? it->second : UUID::InvalidID;
+    }
+
     // -------- Editing
     // TODO: Disable in prod
 
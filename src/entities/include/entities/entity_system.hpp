@@ -2,6 +2,7 @@
 
 #include <assert.h>
 
+#include "component_router.hpp"
 #include "update_context.hpp"
 #include "world_update.hpp"
 
@@ -27,13 +28,11 @@ class IEntitySystem : public reflect::IReflected
     UpdatePriorities m_requiredUpdatePriorities;
     std::string m_name;
 
-    virtual void Update(const UpdateContext& context) = 0;
-
-    /// @brief Register a component with this system.
-    virtual void RegisterComponent(IComponent* pComponent) = 0;
+    /// @brief Handlers of the component types this system consumes, called when the entity's components are registered with it.
+    /// Declared by the derived systems on construction
+    ComponentRouter<> m_componentRouter;
 
-    /// @brief Unregister a component.
-    virtual void UnregisterComponent(IComponent* pComponent) = 0;
+    virtual void Update(const UpdateContext& context) = 0;
 
     /// @brief Returns the update priorities for this system.
     /// @todo https://www.youtube.com/watch?v=jjEsB611kxs 1:47:34 . KRG has a static IEntitySystem::PriorityList attribute
@@ -35,16 +35,42 @@ class SpatialComponent : public IComponent
     Transform m_localTransform;
     Transform m_worldTransform;
 
+    // World transform at the end of the previous simulation tick, used to interpolate rendering between ticks.
+    // Captured lazily on the first modification of each tick so that static components cost nothing
+    Transform m_previousWorldTransform;
+    uint64_t m_previousWorldTransformTick = InvalidSimulationTick;
+    bool m_hasWorldTransform = false;
+
     // TODO: Local/world bounds (oriented bounding boxes)
 
     /// @brief Calculate the world transform according to the parent's component world transform and our own local one.
     /// @param callback: whether to trigger the callback to calculate the component's children's world transform.
     void CalculateWorldTransform(bool callback = true);
 
+    /// @brief Save the world transform before it is first modified during a simulation tick.
+    /// Modifications made outside of the simulation (i.e. by the editor) are not interpolated
+    void SnapshotWorldTransform()
+    {
+        if (!IsSimulating())
+        {
+            m_previousWorldTransformTick = InvalidSimulationTick;
+            return;
+        }
+
+        const auto simulationTick = GetSimulationTick();
+        if (m_hasWorldTransform && m_previousWorldTransformTick != simulationTick)
+        {
+            m_previousWorldTransform = m_worldTransform;
+            m_previousWorldTransformTick = simulationTick;
+        }
+    }
+
   protected:
     void SetWorldTransform(const Transform& transform)
     {
+        SnapshotWorldTransform();
         m_worldTransform = transform;
+        m_hasWorldTransform = true;
 
         // Update local transform unless we are the root
         if (HasParent())
@@ -65,8 +91,34 @@ class SpatialComponent : public IComponent
     }
 
   public:
+    static constexpr uint64_t InvalidSimulationTick = UINT64_MAX;
+
     virtual ~SpatialComponent() {}
 
+    // ---- Simulation ticks and render interpolation
+    /// @brief Mark the beginning of a new simulation tick. Transforms modified during the tick will interpolate from their current value
+    static void BeginSimulationTick();
+    static void EndSimulationTick();
+    static bool IsSimulating();
+    static uint64_t GetSimulationTick();
+
+    /// @brief Set how far rendering is between the previous and the latest simulation tick, in [0, 1]
+    static void SetRenderInterpolationFactor(float factor);
+    static float GetRenderInterpolationFactor();
+
+    /// @brief World transform to render with, interpolated between the last two simulation ticks
+    Transform GetRenderWorldTransform() const
+    {
+        if (m_previousWorldTransformTick != GetSimulationTick())
+        {
+            return m_worldTransform; // Did not move during the last tick
+        }
+        return Transform::Interpolate(m_previousWorldTransform, m_worldTransform, GetRenderInterpolationFactor());
+    }
+
+    /// @brief Render the current transform until the next modification, i.e. after a teleport
+    void ResetRenderInterpolation() { m_previousWorldTransformTick = InvalidSimulationTick; }
+
     bool HasSocket(const UUID& socketID);
 
     inline bool HasChildren() const { return m_spatialChildren.empty(); }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <common/drawing_context.hpp>
 #include <common/services/service_provider.hpp>
 #include <common/types.hpp>
 #include <common/update_stages.hpp>
@@ -19,9 +20,11 @@ class EntityMap;
 class UpdateContext
 {
     friend class Engine;
+    friend class EngineCore;
+    friend class WorldEntity;
 
   private:
-    ServiceProvider* m_pServiceProvider = nullptr;
+    const ServiceProvider* m_pServiceProvider = nullptr;
 
     UpdateStage m_updateStage = UpdateStage::FrameStart;
 
@@ -50,6 +53,9 @@ class UpdateContext
     inline float GetDisplayHeight() const { return m_displayHeight; }
     inline float GetDisplayWidth() const { return m_displayWidth; }
 
+    /// @brief Debug drawing context of the calling thread, safe to use from systems updated in parallel
+    inline DrawingContext& GetDrawingContext() const { return DebugDrawing::GetThreadContext(); }
+
     template <typename T>
     T* GetService() const
     {
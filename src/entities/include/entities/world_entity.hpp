@@ -19,22 +19,28 @@ class IComponent;
 class WorldEntity
 {
     friend class Engine;
+    friend class EngineCore;
     friend class Editor;
     friend class EntityInspector;
 
   private:
     EntityMap m_entityMap;
     HashMap<std::type_index, IWorldSystem*, std::hash<std::type_index>> m_systems;
+    HashMap<StringID, Vector<IWorldSystem*>> m_componentConsumers; // Component type ID -> World systems consuming it. Resolved on first use, reset when the systems change
 
+    ServiceProvider m_serviceProvider; // Overrides of the application's services, visible to this world only
     TaskService* m_pTaskService = nullptr;
     Viewport m_viewport;
 
     LoadingContext m_loadingContext;
 
-    /// @brief Register a component with all the world systems. Called when an entity is activated.
+    /// @brief World systems that consume components of a type
+    const Vector<IWorldSystem*>& GetComponentConsumers(const reflect::TypeInfo* pComponentTypeInfo);
+
+    /// @brief Register a component with the world systems consuming it. Called when an entity is activated.
     void RegisterComponent(Entity* pEntity, IComponent* pComponent);
 
-    /// @brief Unregister a component from all the world systems. Called when an entity is deactivated.
+    /// @brief Unregister a component from the world systems consuming it. Called when an entity is deactivated.
     void UnregisterComponent(Entity* pEntity, IComponent* pComponent);
 
     /// @brief Register an entity's update priorities list to the world. Called when an entity is activated or modified.
@@ -47,6 +53,16 @@ class WorldEntity
     void Initialize(ServiceProvider& serviceProvider);
     void Shutdown();
 
+    /// @brief Replace a service for this world only, e.g. in preview worlds. Systems updating in this world get the override instead of the application's service
+    template <typename T>
+    void RegisterServiceOverride(T* pService) { m_serviceProvider.RegisterService(pService); }
+
+    template <typename T>
+    void UnregisterServiceOverride() { m_serviceProvider.UnregisterService<T>(); }
+
+    /// @brief Services as seen from this world: its overrides, then the application's services
+    const ServiceProvider& GetServiceProvider() const { return m_serviceProvider; }
+
     /// @brief Update all entities' systems, then all world systems
     void Update(const UpdateContext& context);
 
@@ -67,6 +83,7 @@ class WorldEntity
         auto pSystem = aln::New<T>(args...);
         pSystem->InitializeSystem();
         m_systems.emplace(std::type_index(typeid(T)), pSystem);
+        m_componentConsumers.clear();
     }
 
     template <typename T>
@@ -81,6 +98,7 @@ class WorldEntity
             pSystem->ShutdownSystem();
             aln::Delete(pSystem);
             m_systems.erase(iter->first);
+            m_componentConsumers.clear();
         }
     }
 
@@ -2,6 +2,8 @@
 
 // https://www.youtube.com/watch?v=jjEsB611kxs @1:49:00
 
+#include "component_router.hpp"
+
 namespace aln
 {
 
@@ -33,6 +35,10 @@ class IWorldSystem
     void ShutdownSystem();
 
   protected:
+    /// @brief Handlers of the component types this system consumes, called whenever a component is activated (added to the world)
+    /// and immediately before it is deactivated. Declared by the derived systems when they are initialized
+    ComponentRouter<const Entity*> m_componentRouter;
+
     virtual const UpdatePriorities& GetUpdatePriorities() = 0;
 
     // TODO: Called when the system is registered with the world
@@ -45,12 +51,6 @@ class IWorldSystem
     /// @brief System update
     virtual void Update(const UpdateContext& context) = 0;
 
-    /// @brief Called whenever a new component is activated (added to the world).
-    virtual void RegisterComponent(const Entity* pEntity, IComponent* pComponent) = 0;
-
-    /// @brief Called immediately before a component is deactivated.
-    virtual void UnregisterComponent(const Entity* pEntity, IComponent* pComponent) = 0;
-
     void Enable();
 
     void Disable();
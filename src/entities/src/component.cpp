@@ -5,6 +5,12 @@
 
 namespace aln
 {
+RuntimeIDPool& ComponentIDTag::GetIDPool()
+{
+    static RuntimeIDPool pool;
+    return pool;
+}
+
 void IComponent::LoadComponent(const LoadingContext& loadingContext)
 {
     assert(m_status == Status::Unloaded);
@@ -4,6 +4,7 @@
 #include "component.hpp"
 #include "spatial_component.hpp"
 
+#include <common/profiling.hpp>
 #include <reflection/services/type_registry_service.hpp>
 
 #include <EASTL/sort.h>
@@ -13,12 +14,20 @@
 namespace aln
 {
 
-Event<Entity*> Entity::EntityStateUpdatedEvent;
+RuntimeIDPool& EntityIDTag::GetIDPool()
+{
+    static RuntimeIDPool pool;
+    return pool;
+}
+
+DeferredEvent<Entity*> Entity::EntityStateUpdatedEvent;
 
 Entity::~Entity()
 {
     assert(IsUnloaded());
 
+    EntityID::Release(m_ID);
+
     m_deferredActions.clear();
 
     for (auto& pSystem : m_systems)
@@ -296,7 +305,7 @@ void Entity::CreateSystemImmediate(const aln::reflect::TypeInfo* pSystemTypeInfo
     {
         for (auto pComponent : m_components)
         {
-            pSystem->RegisterComponent(pComponent);
+            pSystem->m_componentRouter.Register(pComponent);
         }
     }
 
@@ -367,6 +376,7 @@ void Entity::UpdateSystems(UpdateContext const& context) const
     {
         // TODO: assert system has this stage enabled
         assert(pSystem->GetRequiredUpdatePriorities().IsUpdateStageEnabled(updateStage));
+        ALN_PROFILE_SCOPE(pSystem->GetTypeInfo()->GetName().c_str(), ProfileCategory::EntitySystem);
         pSystem->Update(context);
     }
 }
@@ -374,7 +384,7 @@ void Entity::UpdateSystems(UpdateContext const& context) const
 // -------------------------------------------------
 // Components
 // -------------------------------------------------
-void Entity::DestroyComponent(const UUID& componentID)
+void Entity::DestroyComponent(const ComponentID& componentID)
 {
     assert(componentID.IsValid());
     auto componentIt = std::find_if(m_components.begin(), m_components.end(), [componentID](IComponent* comp)
@@ -414,7 +424,7 @@ void Entity::DestroyComponentImmediate(IComponent* pComponent)
 
     m_components.erase(componentIt);
 
-    SpatialComponent* pSpatialComponent = dynamic_cast<SpatialComponent*>(pComponent);
+    SpatialComponent* pSpatialComponent = ComponentCast<SpatialComponent>(pComponent);
     if (pSpatialComponent != nullptr)
     {
         if (m_pRootSpatialComponent == pSpatialComponent)
@@ -457,13 +467,13 @@ void Entity::DestroyComponentDeferred(const LoadingContext& loadingContext, ICom
     DestroyComponentImmediate(pComponent);
 }
 
-void Entity::AddComponent(IComponent* pComponent, const UUID& parentSpatialComponentID)
+void Entity::AddComponent(IComponent* pComponent, const ComponentID& parentSpatialComponentID)
 {
     assert(pComponent != nullptr && pComponent->GetID().IsValid());
     assert(!pComponent->m_entityID.IsValid() && pComponent->IsUnloaded());
     // TODO: Assert that m_components does NOT contain a component of this type
 
-    SpatialComponent* pSpatialComponent = dynamic_cast<SpatialComponent*>(pComponent);
+    SpatialComponent* pSpatialComponent = ComponentCast<SpatialComponent>(pComponent);
 
     // Parent ID can only be set when adding a spatial component
     if (pSpatialComponent == nullptr)
@@ -490,7 +500,7 @@ void Entity::AddComponent(IComponent* pComponent, const UUID& parentSpatialCompo
 
 void Entity::AddComponentImmediate(IComponent* pComponent, SpatialComponent* pParentComponent)
 {
-    SpatialComponent* pSpatialComponent = dynamic_cast<SpatialComponent*>(pComponent);
+    SpatialComponent* pSpatialComponent = ComponentCast<SpatialComponent>(pComponent);
     if (pSpatialComponent != nullptr)
     {
         if (pParentComponent == nullptr)
@@ -538,7 +548,7 @@ void Entity::RegisterComponentWithEntitySystems(IComponent* pComponent)
     assert(!pComponent->m_registeredWithEntitySystems);
     for (auto pSystem : m_systems)
     {
-        pSystem->RegisterComponent(pComponent);
+        pSystem->m_componentRouter.Register(pComponent);
     }
     pComponent->m_registeredWithEntitySystems = true;
 }
@@ -548,7 +558,7 @@ void Entity::UnregisterComponentWithEntitySystems(IComponent* pComponent)
     assert(pComponent->m_registeredWithEntitySystems);
     for (auto pSystem : m_systems)
     {
-        pSystem->UnregisterComponent(pComponent);
+        pSystem->m_componentRouter.Unregister(pComponent);
     }
     pComponent->m_registeredWithEntitySystems = false;
 }
@@ -576,7 +586,7 @@ SpatialComponent* Entity::FindSocketAttachmentComponent(SpatialComponent* pCompo
     return nullptr;
 }
 
-SpatialComponent* Entity::GetSpatialComponent(const UUID& spatialComponentID)
+SpatialComponent* Entity::GetSpatialComponent(const ComponentID& spatialComponentID)
 {
     if (!spatialComponentID.IsValid())
     {
@@ -587,7 +597,7 @@ SpatialComponent* Entity::GetSpatialComponent(const UUID& spatialComponentID)
         { return comp->GetID() == spatialComponentID; });
     assert(componentIt != m_components.end());
 
-    auto pSpatialComponent = dynamic_cast<SpatialComponent*>(m_components[componentIt - m_components.begin()]);
+    auto pSpatialComponent = ComponentCast<SpatialComponent>(m_components[componentIt - m_components.begin()]);
     assert(pSpatialComponent != nullptr);
     return pSpatialComponent;
 }
@@ -35,7 +35,7 @@ EntityDescriptor::EntityDescriptor(const Entity* pEntity, const TypeRegistryServ
         auto& componentDesc = m_componentDescriptors.emplace_back();
         componentDesc.DescribeTypeInstance(pComponent, pTypeRegistryService, pComponent->GetTypeInfo());
 
-        auto pSpatialComponent = dynamic_cast<SpatialComponent*>(pComponent);
+        auto pSpatialComponent = ComponentCast<SpatialComponent>(pComponent);
         if (pSpatialComponent != nullptr)
         {
             componentDesc.m_isSpatialComponent = true;
@@ -74,8 +74,8 @@ void EntityDescriptor::InstanciateEntity(Entity* pEntity, const TypeRegistryServ
     {
         if (relationship.m_parentComponentIndex != InvalidIndex)
         {
-            auto pSpatialComponent = dynamic_cast<SpatialComponent*>(pEntity->m_components[relationship.m_componentIndex]);
-            auto pParentSpatialComponent = dynamic_cast<SpatialComponent*>(pEntity->m_components[relationship.m_parentComponentIndex]);
+            auto pSpatialComponent = ComponentCast<SpatialComponent>(pEntity->m_components[relationship.m_componentIndex]);
+            auto pParentSpatialComponent = ComponentCast<SpatialComponent>(pEntity->m_components[relationship.m_parentComponentIndex]);
 
             assert(pSpatialComponent != nullptr && pParentSpatialComponent != nullptr);
 
@@ -111,7 +111,15 @@ EntityMapDescriptor::EntityMapDescriptor(const EntityMap& entityMap, const TypeR
     uint32_t entityIndex = 0;
     for (auto pEntity : entityMap.m_entities)
     {
-        m_entityDescriptors.emplace_back(pEntity, &typeRegistryService);
+        auto& entityDesc = m_entityDescriptors.emplace_back(pEntity, &typeRegistryService);
+
+        // Keep the persistent IDs of entities that were loaded from a descriptor
+        entityDesc.m_persistentID = entityMap.GetPersistentID(pEntity);
+        if (!entityDesc.m_persistentID.IsValid())
+        {
+            entityDesc.m_persistentID = UUID::Generate();
+        }
+
         if (pEntity->IsSpatialEntity())
         {
             auto& relationship = m_spatialEntitiesRelationships.emplace_back();
@@ -128,20 +136,32 @@ EntityMapDescriptor::EntityMapDescriptor(const EntityMap& entityMap, const TypeR
 
 void EntityMapDescriptor::InstanciateEntityMap(EntityMap& entityMap, const LoadingContext& loadingContext, const TypeRegistryService& typeRegistryService)
 {
+    assert(IsValid());
+
+    MemoryTagScope memoryTagScope(MemoryTag::Entities);
+
     auto entityCount = m_entityDescriptors.size();
     entityMap.m_entities.reserve(entityCount);
     entityMap.m_loadingEntities.reserve(entityCount);
     entityMap.m_entityLookupMap.reserve(entityCount);
+    entityMap.m_persistentIDLookupMap.reserve(entityCount);
+    entityMap.m_persistentIDs.reserve(entityCount);
 
     // TODO: Parallelize ?
     for (auto& desc : m_entityDescriptors)
     {
-        auto pEntity = aln::New<Entity>();
+        auto pEntity = entityMap.m_entityPool.New();
         desc.InstanciateEntity(pEntity, &typeRegistryService);
 
         entityMap.m_entities.push_back(pEntity);
         entityMap.m_entityLookupMap[pEntity->GetID()] = pEntity;
 
+        if (desc.m_persistentID.IsValid())
+        {
+            entityMap.m_persistentIDLookupMap[desc.m_persistentID] = pEntity->GetID();
+            entityMap.m_persistentIDs[pEntity->GetID()] = desc.m_persistentID;
+        }
+
         // TODO: what if the map is not loaded yet ?
         pEntity->LoadComponents(loadingContext);
         entityMap.m_loadingEntities.push_back(pEntity);
@@ -33,23 +33,35 @@ void EntityMap::Clear(const LoadingContext& loadingContext)
     m_entitiesToRemove.clear();
     m_loadingEntities.clear();
     m_entityLookupMap.clear();
+    m_persistentIDLookupMap.clear();
+    m_persistentIDs.clear();
 
-    // If this is the main map, deactivate and unload all entities,
-    // then clear the collection.
-    if (!m_isTransientMap)
+    m_entitiesToActivate.clear();
+    m_entitiesToDeactivate.clear();
+
+    // The map owns its entities' memory: release all of them so the pool is empty when the map is destroyed.
+    // Entities of a transient map are never loaded, only the main map needs to deactivate and unload them first
+    for (auto& pEntity : m_entities)
     {
-        for (auto& pEntity : m_entities)
+        if (!m_isTransientMap)
         {
             if (pEntity->IsActivated())
             {
                 pEntity->Deactivate(loadingContext);
             }
             pEntity->UnloadComponents(loadingContext);
-
-            aln::Delete(pEntity);
         }
-        m_entities.clear();
+
+        m_entityPool.Delete(pEntity);
+    }
+    m_entities.clear();
+
+    // Entities created since the last update are not in the main collection yet
+    for (auto& pEntity : m_entitiesToAdd)
+    {
+        m_entityPool.Delete(pEntity);
     }
+    m_entitiesToAdd.clear();
 }
 
 void EntityMap::RemoveEntity(Entity* pEntity)
@@ -108,6 +120,11 @@ void EntityMap::Activate(const LoadingContext& loadingContext)
 
 void EntityMap::UpdateEntitiesState(const LoadingContext& loadingContext)
 {
+    MemoryTagScope memoryTagScope(MemoryTag::Entities);
+
+    // Collect the entities whose state changed since the last update. Shared by all maps, the first one to update dispatches for all
+    Entity::EntityStateUpdatedEvent.Dispatch();
+
     // --------- Edited entities
     // TODO: Disable in prod
     for (auto pEntity : m_editedEntities)
@@ -152,12 +169,19 @@ void EntityMap::UpdateEntitiesState(const LoadingContext& loadingContext)
         // Remove from collection
         m_entityLookupMap.erase(pEntityToRemove->GetID());
 
+        auto persistentIDIt = m_persistentIDs.find(pEntityToRemove->GetID());
+        if (persistentIDIt != m_persistentIDs.end())
+        {
+            m_persistentIDLookupMap.erase(persistentIDIt->second);
+            m_persistentIDs.erase(persistentIDIt);
+        }
+
         auto itEntity = std::find(m_entities.begin(), m_entities.end(), pEntityToRemove);
         assert(itEntity != m_entities.end());
         m_entities.erase(itEntity);
 
         // Release memory
-        aln::Delete(pEntityToRemove);
+        m_entityPool.Delete(pEntityToRemove);
     }
     m_entitiesToRemove.clear();
 
@@ -201,8 +225,9 @@ void EntityMap::UpdateEntitiesState(const LoadingContext& loadingContext)
 Entity* EntityMap::CreateEntity(std::string name)
 {
     std::lock_guard lock(m_mutex);
+    MemoryTagScope memoryTagScope(MemoryTag::Entities);
 
-    auto pEntity = aln::New<Entity>();
+    auto pEntity = m_entityPool.New();
     pEntity->m_name = name;
 
     m_entitiesToAdd.push_back(pEntity);
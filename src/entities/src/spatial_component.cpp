@@ -3,6 +3,7 @@
 #include <common/maths/angles.hpp>
 
 #include <algorithm>
+#include <assert.h>
 #include <stdexcept>
 
 namespace aln
@@ -12,8 +13,40 @@ ALN_REGISTER_ABSTRACT_IMPL_BEGIN(SpatialComponent)
 ALN_REFLECT_MEMBER(m_localTransform)
 ALN_REGISTER_IMPL_END()
 
+namespace
+{
+uint64_t g_simulationTick = 0;
+bool g_isSimulating = false;
+float g_renderInterpolationFactor = 1.0f;
+} // namespace
+
+void SpatialComponent::BeginSimulationTick()
+{
+    assert(!g_isSimulating);
+    g_simulationTick++;
+    g_isSimulating = true;
+}
+
+void SpatialComponent::EndSimulationTick()
+{
+    assert(g_isSimulating);
+    g_isSimulating = false;
+}
+
+bool SpatialComponent::IsSimulating() { return g_isSimulating; }
+uint64_t SpatialComponent::GetSimulationTick() { return g_simulationTick; }
+
+void SpatialComponent::SetRenderInterpolationFactor(float factor)
+{
+    assert(factor >= 0.0f && factor <= 1.0f);
+    g_renderInterpolationFactor = factor;
+}
+float SpatialComponent::GetRenderInterpolationFactor() { return g_renderInterpolationFactor; }
+
 void SpatialComponent::CalculateWorldTransform(bool callback)
 {
+    SnapshotWorldTransform();
+
     if (m_pSpatialParent == nullptr)
     {
         // This is the root
@@ -27,6 +60,8 @@ void SpatialComponent::CalculateWorldTransform(bool callback)
         m_worldTransform.SetRotation(parent.GetRotation() * m_localTransform.GetRotation());
         m_worldTransform.SetScale(m_localTransform.GetScale().Scale(parent.GetScale()));
     }
+    m_hasWorldTransform = true;
+
     if (callback)
     {
         // Update the world transform of all children recursively
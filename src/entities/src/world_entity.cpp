@@ -3,6 +3,7 @@
 #include "entity.hpp"
 
 #include <assets/asset_service.hpp>
+#include <common/profiling.hpp>
 #include <common/threading/task_service.hpp>
 
 #include <tracy/Tracy.hpp>
@@ -16,10 +17,12 @@ namespace aln
 
 void WorldEntity::Initialize(ServiceProvider& serviceProvider)
 {
-    m_pTaskService = serviceProvider.GetService<TaskService>();
+    m_serviceProvider.SetParent(&serviceProvider);
+
+    m_pTaskService = m_serviceProvider.GetService<TaskService>();
     assert(m_pTaskService != nullptr);
 
-    auto pAssetService = serviceProvider.GetService<AssetService>();
+    auto pAssetService = m_serviceProvider.GetService<AssetService>();
     assert(pAssetService != nullptr);
 
     m_loadingContext = LoadingContext(m_pTaskService, pAssetService);
@@ -44,7 +47,9 @@ void WorldEntity::Shutdown()
         aln::Delete(pSystem);
     }
     m_systems.clear();
+    m_componentConsumers.clear();
     m_entityMap.Clear(m_loadingContext);
+    m_serviceProvider.UnregisterAllServices();
 }
 
 void WorldEntity::Update(const UpdateContext& context)
@@ -80,14 +85,19 @@ void WorldEntity::Update(const UpdateContext& context)
     // Updating phase
     // --------------
 
+    // Systems updating in this world see its service overrides
+    UpdateContext worldContext = context;
+    worldContext.m_pServiceProvider = &m_serviceProvider;
+
     // Update all systems for each entity
-    auto updateTask = UpdateTask(m_entityMap.m_entities, context);
+    auto updateTask = UpdateTask(m_entityMap.m_entities, worldContext);
     m_pTaskService->ExecuteTask(&updateTask);
 
     // TODO: Refine. For now a world update simply means updating all systems
     for (auto& [id, system] : m_systems)
     {
-        system->Update(context);
+        ALN_PROFILE_SCOPE(id.name(), ProfileCategory::WorldSystem);
+        system->Update(worldContext);
     }
 }
 
@@ -98,6 +108,25 @@ void WorldEntity::UpdateLoading()
     m_entityMap.UpdateEntitiesState(m_loadingContext);
 }
 
+const Vector<IWorldSystem*>& WorldEntity::GetComponentConsumers(const reflect::TypeInfo* pComponentTypeInfo)
+{
+    auto it = m_componentConsumers.find(pComponentTypeInfo->GetTypeID());
+    if (it != m_componentConsumers.end())
+    {
+        return it->second;
+    }
+
+    auto& consumers = m_componentConsumers[pComponentTypeInfo->GetTypeID()];
+    for (auto& [id, pSystem] : m_systems)
+    {
+        if (pSystem->m_componentRouter.Consumes(pComponentTypeInfo))
+        {
+            consumers.push_back(pSystem);
+        }
+    }
+    return consumers;
+}
+
 void WorldEntity::RegisterComponent(Entity* pEntity, IComponent* pComponent)
 {
     // TODO: Create a task for each global system and feed them the entity/components pairs
@@ -105,9 +134,9 @@ void WorldEntity::RegisterComponent(Entity* pEntity, IComponent* pComponent)
     // In the rare case multiple systems are interdependant, use the same thread for all of them.
     assert(!pComponent->IsUnloaded());
     assert(!pComponent->m_registeredWithWorldSystems);
-    for (auto& [id, system] : m_systems)
+    for (auto pSystem : GetComponentConsumers(pComponent->GetTypeInfo()))
     {
-        system->RegisterComponent(pEntity, pComponent);
+        pSystem->m_componentRouter.Register(pEntity, pComponent);
     }
     pComponent->m_registeredWithWorldSystems = true;
 }
@@ -115,9 +144,9 @@ void WorldEntity::RegisterComponent(Entity* pEntity, IComponent* pComponent)
 void WorldEntity::UnregisterComponent(Entity* pEntity, IComponent* pComponent)
 {
     assert(pComponent->m_registeredWithWorldSystems);
-    for (auto& [id, system] : m_systems)
+    for (auto pSystem : GetComponentConsumers(pComponent->GetTypeInfo()))
     {
-        system->UnregisterComponent(pEntity, pComponent);
+        pSystem->m_componentRouter.Unregister(pEntity, pComponent);
     }
     pComponent->m_registeredWithWorldSystems = false;
 }
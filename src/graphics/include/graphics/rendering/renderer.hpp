@@ -1,12 +1,12 @@
 #pragma once
 
-#include "../imgui_service.hpp"
 #include "../pipeline.hpp"
 #include "../render_engine.hpp"
 #include "../render_pass.hpp"
 #include "../resources/buffer.hpp"
 #include "../resources/image.hpp"
 #include "../swapchain.hpp"
+#include "../window.hpp"
 #include "render_target.hpp"
 
 #include <common/colors.hpp>
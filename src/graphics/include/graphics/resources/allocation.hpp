@@ -23,6 +23,7 @@ class GPUAllocation
     RenderEngine* m_pRenderEngine;
     vk::DeviceMemory m_memory;
     vk::DeviceSize m_size;
+    vk::DeviceSize m_allocatedSize = 0; // Actual size of the device memory allocation, including alignment requirements
 
     void* m_mapped = nullptr;
 
@@ -44,6 +45,7 @@ class GPUAllocation
     virtual void Shutdown();
 
     inline vk::DeviceSize GetSize() const { return m_size; }
+    inline vk::DeviceSize GetAllocatedSize() const { return m_allocatedSize; }
 
     void Map(size_t offset = 0, vk::DeviceSize = vk::WholeSize);
 
@@ -139,6 +139,8 @@ class GPUImage : public GPUAllocation
     const vk::Sampler& GetVkSampler() const { return m_sampler; }
     uint32_t GetWidth() const { return m_width; }
     uint32_t GetHeight() const { return m_height; }
+    uint32_t GetMipLevels() const { return m_mipLevels; }
+    vk::Format GetFormat() const { return m_format; }
     vk::ImageLayout GetLayout() const { return m_layout; }
 
     inline bool HasView() const { return (bool) m_view; }
@@ -6,6 +6,7 @@
 
 #include <common/containers/list.hpp>
 #include <common/containers/vector.hpp>
+#include <common/maths/maths.hpp>
 #include <common/memory.hpp>
 
 #include <vk_mem_alloc.h>
@@ -41,12 +42,13 @@ class StagingBuffer
     uint64_t m_currentSemaphoreValue = 0;
 
   private:
-    VkDeviceSize Allocate(size_t size)
+    VkDeviceSize Allocate(size_t size, VkDeviceSize alignment = 1)
     {
         VkDeviceSize offset;
         VmaVirtualAllocation alloc;
         VmaVirtualAllocationCreateInfo allocCreateInfo = {
             .size = size,
+            .alignment = alignment,
             .flags = VMA_VIRTUAL_ALLOCATION_CREATE_STRATEGY_MIN_TIME_BIT,
         };
 
@@ -127,38 +129,49 @@ class StagingBuffer
     }
 
     /// @brief Upload image data to a GPU image going through the staging buffer. Returns the semaphore that will be signaled when transfer is complete as well as the value to expect, in case user want to wait for it
+    /// @param mipOffsets: Offset of each mip level in the source data. All levels are uploaded in a single copy command. Defaults to the base level only
     template <typename CommandBufferType, typename DataType>
-    std::pair<const vk::Semaphore*, uint64_t> UploadImageToGPU(const Vector<DataType>& srcData, GPUImage& dstImage, CommandBufferSubmission<CommandBufferType>& cbSubmission)
+    std::pair<const vk::Semaphore*, uint64_t> UploadImageToGPU(const Vector<DataType>& srcData, GPUImage& dstImage, CommandBufferSubmission<CommandBufferType>& cbSubmission, const Vector<vk::DeviceSize>& mipOffsets = {0})
     {
+        assert(!mipOffsets.empty() && mipOffsets.size() <= dstImage.GetMipLevels());
+
+        // Copy offsets must be a multiple of the texel block size (up to 16 bytes for compressed formats)
+        static constexpr VkDeviceSize ImageCopyAlignment = 16;
+
         auto dataSize = srcData.size() * sizeof(DataType);
-        auto offset = Allocate(dataSize);
+        auto offset = Allocate(dataSize, ImageCopyAlignment);
 
         // CPU -> Staging
         memcpy(m_mapping + offset, srcData.data(), dataSize);
 
         // Staging -> GPU
-        vk::BufferImageCopy2 region = {
-            .bufferOffset = offset,
-            .imageSubresource = {
-                .aspectMask = vk::ImageAspectFlagBits::eColor,
-                .mipLevel = 0,
-                .baseArrayLayer = 0,
-                .layerCount = 1,
-            },
-            .imageOffset = {0, 0, 0},
-            .imageExtent = {
-                .width = dstImage.GetWidth(),
-                .height = dstImage.GetHeight(),
-                .depth = 1,
-            },
-        };
+        Vector<vk::BufferImageCopy2> regions;
+        regions.reserve(mipOffsets.size());
+        for (uint32_t mipLevel = 0; mipLevel < mipOffsets.size(); ++mipLevel)
+        {
+            regions.push_back({
+                .bufferOffset = offset + mipOffsets[mipLevel],
+                .imageSubresource = {
+                    .aspectMask = vk::ImageAspectFlagBits::eColor,
+                    .mipLevel = mipLevel,
+                    .baseArrayLayer = 0,
+                    .layerCount = 1,
+                },
+                .imageOffset = {0, 0, 0},
+                .imageExtent = {
+                    .width = Maths::Max(dstImage.GetWidth() >> mipLevel, 1u),
+                    .height = Maths::Max(dstImage.GetHeight() >> mipLevel, 1u),
+                    .depth = 1,
+                },
+            });
+        }
 
         vk::CopyBufferToImageInfo2 copyInfo = {
             .srcBuffer = m_buffer.GetVkBuffer(),
             .dstImage = dstImage.GetVkImage(),
             .dstImageLayout = vk::ImageLayout::eTransferDstOptimal,
-            .regionCount = 1,
-            .pRegions = &region,
+            .regionCount = (uint32_t) regions.size(),
+            .pRegions = regions.data(),
         };
 
         auto cb = (vk::CommandBuffer) *cbSubmission.GetCommandBuffer();
@@ -33,10 +33,10 @@ struct VertexDescriptor<aln::Vertex>
     static Vector<vk::VertexInputAttributeDescription> GetAttributeDescription()
     {
         Vector<vk::VertexInputAttributeDescription> attributeDescription = {
-            {.location = 0, .binding = 0, .format = vk::Format::eR32G32B32Sfloat, .offset = offsetof(Vertex, pos)},
-            {.location = 1, .binding = 0, .format = vk::Format::eR32G32B32Sfloat, .offset = offsetof(Vertex, color)},
-            {.location = 2, .binding = 0, .format = vk::Format::eR32G32Sfloat, .offset = offsetof(Vertex, texCoord)},
-            {.location = 3, .binding = 0, .format = vk::Format::eR32G32B32Sfloat, .offset = offsetof(Vertex, normal)},
+            {.location = 0, .binding = 0, .format = vk::Format::eR16G16B16A16Snorm, .offset = offsetof(Vertex, pos)},
+            {.location = 1, .binding = 0, .format = vk::Format::eR8G8B8A8Unorm, .offset = offsetof(Vertex, color)},
+            {.location = 2, .binding = 0, .format = vk::Format::eR16G16Sfloat, .offset = offsetof(Vertex, texCoord)},
+            {.location = 3, .binding = 0, .format = vk::Format::eR16G16Snorm, .offset = offsetof(Vertex, normal)},
         };
 
         return attributeDescription;
@@ -60,12 +60,12 @@ struct VertexDescriptor<SkinnedVertex>
     static Vector<vk::VertexInputAttributeDescription> GetAttributeDescription()
     {
         Vector<vk::VertexInputAttributeDescription> attributeDescription = {
-            {.location = 0, .binding = 0, .format = vk::Format::eR32G32B32Sfloat, .offset = offsetof(SkinnedVertex, pos)},
-            {.location = 1, .binding = 0, .format = vk::Format::eR32G32B32Sfloat, .offset = offsetof(SkinnedVertex, color)},
-            {.location = 2, .binding = 0, .format = vk::Format::eR32G32Sfloat, .offset = offsetof(SkinnedVertex, texCoord)},
-            {.location = 3, .binding = 0, .format = vk::Format::eR32G32B32Sfloat, .offset = offsetof(SkinnedVertex, normal)},
-            {.location = 4, .binding = 0, .format = vk::Format::eR32G32B32A32Sfloat, .offset = offsetof(SkinnedVertex, weights)},
-            {.location = 5, .binding = 0, .format = vk::Format::eR32G32B32A32Uint, .offset = offsetof(SkinnedVertex, boneIndices)},
+            {.location = 0, .binding = 0, .format = vk::Format::eR16G16B16A16Snorm, .offset = offsetof(SkinnedVertex, pos)},
+            {.location = 1, .binding = 0, .format = vk::Format::eR8G8B8A8Unorm, .offset = offsetof(SkinnedVertex, color)},
+            {.location = 2, .binding = 0, .format = vk::Format::eR16G16Sfloat, .offset = offsetof(SkinnedVertex, texCoord)},
+            {.location = 3, .binding = 0, .format = vk::Format::eR16G16Snorm, .offset = offsetof(SkinnedVertex, normal)},
+            {.location = 4, .binding = 0, .format = vk::Format::eR8G8B8A8Unorm, .offset = offsetof(SkinnedVertex, weights)},
+            {.location = 5, .binding = 0, .format = vk::Format::eR8G8B8A8Uint, .offset = offsetof(SkinnedVertex, boneIndices)},
         };
 
         return attributeDescription;
@@ -90,7 +90,7 @@ struct VertexDescriptor<DebugVertex>
     {
         Vector<vk::VertexInputAttributeDescription> attributeDescription = {
             {.location = 0, .binding = 0, .format = vk::Format::eR32G32B32Sfloat, .offset = offsetof(DebugVertex, pos)},
-            {.location = 1, .binding = 0, .format = vk::Format::eR32G32B32Sfloat, .offset = offsetof(DebugVertex, color)},
+            {.location = 1, .binding = 0, .format = vk::Format::eR8G8B8A8Unorm, .offset = offsetof(DebugVertex, color)},
         };
 
         return attributeDescription;
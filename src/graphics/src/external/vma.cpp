@@ -1,4 +1,7 @@
 #pragma once
 
+// Only VMA's virtual blocks are used. Do not reference Vulkan's exported functions, so that the lib does not import the loader
+#define VMA_STATIC_VULKAN_FUNCTIONS 0
+#define VMA_DYNAMIC_VULKAN_FUNCTIONS 1
 #define VMA_IMPLEMENTATION
 #include <vk_mem_alloc.h>
\ No newline at end of file
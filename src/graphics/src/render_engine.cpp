@@ -223,6 +223,7 @@ void RenderEngine::CreateLogicalDevice()
                 .features = {
                     .sampleRateShading = vk::True,
                     .samplerAnisotropy = vk::True,
+                    .textureCompressionBC = vk::True,
                     .fragmentStoresAndAtomics = vk::True,
                 },
             },
@@ -354,6 +355,6 @@ bool RenderEngine::IsDeviceSuitable(const vk::PhysicalDevice& physicalDevice, co
 
     // TODO : Instead of enforcing features, we can disable their usage if not available
     auto supportedFeatures = physicalDevice.getFeatures();
-    return familyIndices.IsComplete() && extensionsSupported && swapchainAdequate && supportedFeatures.samplerAnisotropy;
+    return familyIndices.IsComplete() && extensionsSupported && swapchainAdequate && supportedFeatures.samplerAnisotropy && supportedFeatures.textureCompressionBC;
 }
 }; // namespace aln
\ No newline at end of file
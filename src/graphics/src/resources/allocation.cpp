@@ -16,6 +16,7 @@ void GPUAllocation::Allocate(const vk::MemoryRequirements& memRequirements, cons
     };
 
     m_memory = m_pRenderEngine->GetVkDevice().allocateMemory(allocInfo, nullptr).value;
+    m_allocatedSize = memRequirements.size;
 }
 
 // Move assignement
@@ -27,6 +28,7 @@ GPUAllocation& GPUAllocation::operator=(GPUAllocation&& other)
         m_memory = std::move(other.m_memory);
 
         m_size = other.m_size;
+        m_allocatedSize = other.m_allocatedSize;
         m_mapped = other.m_mapped;
     }
     return *this;
@@ -39,12 +41,14 @@ GPUAllocation::GPUAllocation(GPUAllocation&& other)
     m_memory = std::move(other.m_memory);
 
     m_size = other.m_size;
+    m_allocatedSize = other.m_allocatedSize;
     m_mapped = other.m_mapped;
 }
 
 void GPUAllocation::Shutdown()
 {
     m_pRenderEngine->GetVkDevice().freeMemory(m_memory);
+    m_allocatedSize = 0;
 }
 
 void GPUAllocation::Map(size_t offset, vk::DeviceSize size)
@@ -10,6 +10,7 @@ namespace aln
 class Gamepad : public IInputDevice
 {
     friend class GLFWApplication;
+    friend class InputService;
 
   public:
     enum class Button : uint8_t
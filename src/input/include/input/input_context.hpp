@@ -4,6 +4,7 @@
 #include "input_action.hpp"
 
 #include <common/containers/hash_map.hpp>
+#include <common/containers/vector.hpp>
 
 namespace aln
 {
@@ -21,9 +22,9 @@ class InputContext
     bool m_enabled = false;
 
   public:
-    /// @brief Map input to the registered actions in this context. Successfully mapped input are consumed and removed from the list.
+    /// @brief Map input to the registered actions in this context. Successfully mapped input are consumed (their control is reset to nullptr).
     /// @todo: Shouldn't be accessible
-    void Map(HashMap<UUID, ControlStateChangedEvent>& inputMap);
+    void Map(Vector<ControlStateChangedEvent>& events);
 
     /// @brief Create a default InputAction with this callback and register it in this context.
     void RegisterCallback(const UUID& controlID, std::function<void(CallbackContext)> callback);
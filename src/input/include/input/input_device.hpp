@@ -2,9 +2,7 @@
 
 #include "control_state_event.hpp"
 
-#include <common/containers/hash_map.hpp>
 #include <common/containers/vector.hpp>
-#include <common/uuid.hpp>
 
 namespace aln
 {
@@ -19,15 +17,10 @@ class IInputDevice
     virtual void ClearFrameState() {}
 
   public:
-    /// @brief Poll the list of state changed events that occured since the last call to this method, and clear the cached ones.
-    /// TODO: Experiment with other data structures
-    virtual void PollControlChangedEvents(HashMap<UUID, ControlStateChangedEvent>& out)
+    /// @brief Append the state changed events that occured since the last call to this method to a buffer, and clear the cached ones.
+    virtual void PollControlChangedEvents(Vector<ControlStateChangedEvent>& out)
     {
-        for (auto& event : m_statesChanged)
-        {
-            out[event.m_pControl->GetID()] = event;
-        }
-
+        out.insert(out.end(), m_statesChanged.begin(), m_statesChanged.end());
         m_statesChanged.clear();
     }
 };
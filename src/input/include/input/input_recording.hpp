@@ -0,0 +1,119 @@
+#pragma once
+
+#include "input_control.hpp"
+
+#include <common/containers/span.hpp>
+#include <common/containers/vector.hpp>
+
+#include <assert.h>
+#include <filesystem>
+#include <stdint.h>
+#include <type_traits>
+
+namespace aln
+{
+
+/// @brief Device-level input as received from the platform layer, before it is applied to the devices.
+/// Fixed-size and trivially copyable so that a session's stream can be written and read in bulk
+struct RawInputEvent
+{
+    enum class Type : uint8_t
+    {
+        KeyboardKey,
+        MouseButton,
+        MouseScroll,
+        MousePosition,
+        GamepadButton,
+        GamepadLeftStick,
+        GamepadRightStick,
+        GamepadLeftTrigger,
+        GamepadRightTrigger,
+    };
+
+    Type m_type;
+    ButtonState m_buttonState = ButtonState::None;
+    uint16_t m_code = 0; // Key or button, depending on the type
+    float m_x = 0.0f;    // Axis values, depending on the type
+    float m_y = 0.0f;
+};
+static_assert(sizeof(RawInputEvent) == 12);
+static_assert(std::is_trivially_copyable_v<RawInputEvent>);
+
+/// @brief A captured input session: every raw input event, grouped by frame, along with each frame's delta time.
+/// Replaying it with the recorded delta times reproduces the session's simulation
+class InputRecording
+{
+  public:
+    struct Frame
+    {
+        float m_deltaTime = 0.0f;
+        uint32_t m_eventCount = 0;
+    };
+
+  private:
+    static constexpr uint32_t FileMagic = 0x494E4C41; // "ALNI"
+    static constexpr uint32_t FileVersion = 1;
+
+    uint64_t m_startFrameCount = 0; // Time service frame count of the first recorded frame
+    Vector<Frame> m_frames;
+    Vector<RawInputEvent> m_events; // Events of all frames, in frame order
+
+  public:
+    void Clear()
+    {
+        m_startFrameCount = 0;
+        m_frames.clear();
+        m_events.clear();
+    }
+
+    void SetStartFrameCount(uint64_t frameCount) { m_startFrameCount = frameCount; }
+    uint64_t GetStartFrameCount() const { return m_startFrameCount; }
+
+    void AddFrame(float deltaTime, const Vector<RawInputEvent>& events)
+    {
+        auto& frame = m_frames.emplace_back();
+        frame.m_deltaTime = deltaTime;
+        frame.m_eventCount = events.size();
+        m_events.insert(m_events.end(), events.begin(), events.end());
+    }
+
+    uint32_t GetFrameCount() const { return m_frames.size(); }
+    const Frame& GetFrame(uint32_t frameIdx) const { return m_frames[frameIdx]; }
+    const Vector<RawInputEvent>& GetEvents() const { return m_events; }
+    bool IsEmpty() const { return m_frames.empty(); }
+
+    bool Save(const std::filesystem::path& path) const;
+    bool Load(const std::filesystem::path& path);
+};
+
+/// @brief Sequential reader over a recording, used by the input service during replay
+class InputReplayCursor
+{
+  private:
+    const InputRecording* m_pRecording = nullptr;
+    uint32_t m_frameIdx = 0;
+    uint32_t m_firstEventIdx = 0;
+
+  public:
+    InputReplayCursor() = default;
+    InputReplayCursor(const InputRecording* pRecording) : m_pRecording(pRecording) { assert(m_pRecording != nullptr); }
+
+    bool IsValid() const { return m_pRecording != nullptr; }
+    bool IsFinished() const { return m_frameIdx >= m_pRecording->GetFrameCount(); }
+
+    float GetDeltaTime() const { return m_pRecording->GetFrame(m_frameIdx).m_deltaTime; }
+
+    Span<const RawInputEvent> GetEvents() const
+    {
+        const auto& frame = m_pRecording->GetFrame(m_frameIdx);
+        return Span<const RawInputEvent>(m_pRecording->GetEvents().data() + m_firstEventIdx, frame.m_eventCount);
+    }
+
+    void Advance()
+    {
+        assert(!IsFinished());
+        m_firstEventIdx += m_pRecording->GetFrame(m_frameIdx).m_eventCount;
+        m_frameIdx++;
+    }
+};
+} // namespace aln
@@ -4,6 +4,7 @@
 #include "devices/keyboard.hpp"
 #include "devices/mouse.hpp"
 #include "devices/gamepad.hpp"
+#include "input_recording.hpp"
 
 #include <common/containers/vector.hpp>
 #include <common/services/service.hpp>
@@ -21,6 +22,15 @@ class InputService : public IService
     friend class GLFWApplication;
     friend class GLFWInputMapper;
     friend class Engine;
+    friend class EngineCore;
+
+  public:
+    enum class Mode : uint8_t
+    {
+        Live,
+        Recording, // Live input is applied and recorded
+        Replaying, // Live input is ignored, input is read from a recording
+    };
 
   private:
     // TODO:
@@ -34,38 +44,94 @@ class InputService : public IService
     Mouse m_mouse;
     Gamepad m_gamepad;
 
+    // Control changes of the frame, reused across frames
+    Vector<ControlStateChangedEvent> m_frameEvents;
+
+    // Record/replay
+    Mode m_mode = Mode::Live;
+    Vector<RawInputEvent> m_pendingRecordedEvents; // Events received since the last frame, in recording mode
+    InputRecording* m_pRecording = nullptr;
+    InputReplayCursor m_replayCursor;
+
+    /// @brief Apply a raw event to the matching device
+    void ApplyEvent(const RawInputEvent& event);
+
+    /// @brief Entry point of all platform input. Ignored while replaying
+    void HandleLiveEvent(const RawInputEvent& event)
+    {
+        if (m_mode == Mode::Replaying)
+        {
+            return;
+        }
+
+        if (m_mode == Mode::Recording)
+        {
+            m_pendingRecordedEvents.push_back(event);
+        }
+
+        ApplyEvent(event);
+    }
+
     // TODO: Merge in a single function and handle device internally
     void UpdateKeyboardControlState(const Keyboard::Key& key, const ButtonState& buttonState)
     {
-        m_keyboard.UpdateControlState(key, buttonState);
+        HandleLiveEvent({.m_type = RawInputEvent::Type::KeyboardKey, .m_buttonState = buttonState, .m_code = (uint16_t) key});
     }
 
     void UpdateMouseControlState(const Mouse::Button& button, const ButtonState& buttonState)
     {
-        m_mouse.UpdateControlState(button, buttonState);
+        HandleLiveEvent({.m_type = RawInputEvent::Type::MouseButton, .m_buttonState = buttonState, .m_code = (uint16_t) button});
     }
 
     void UpdateScrollControlState(float xoffset, float yoffset)
     {
-        m_mouse.UpdateScrollControlState(xoffset, yoffset);
+        HandleLiveEvent({.m_type = RawInputEvent::Type::MouseScroll, .m_x = xoffset, .m_y = yoffset});
     }
 
     /// @todo Should not be updated through the main loop. Pass the glfw window ?
     void UpdateMousePosition(Vec2 position)
     {
-        m_mouse.SetCursorPosition(position);
+        // Polled every frame: skip unchanged positions to keep recordings small
+        if (position != m_mouse.GetPosition())
+        {
+            HandleLiveEvent({.m_type = RawInputEvent::Type::MousePosition, .m_x = position.x, .m_y = position.y});
+        }
+    }
+
+    void UpdateGamepadButtonState(const Gamepad::Button& button, const ButtonState& buttonState)
+    {
+        HandleLiveEvent({.m_type = RawInputEvent::Type::GamepadButton, .m_buttonState = buttonState, .m_code = (uint16_t) button});
     }
 
-    /// @brief Update all input devices
-    void Update()
+    void UpdateGamepadStickState(bool leftStick, const Vec2& value)
     {
-        m_keyboard.Update();
-        m_mouse.Update();
-        m_gamepad.Update();
+        const auto& currentValue = leftStick ? m_gamepad.GetRawLeftStickValue() : m_gamepad.GetRawRightStickValue();
+        if (value != currentValue)
+        {
+            const auto type = leftStick ? RawInputEvent::Type::GamepadLeftStick : RawInputEvent::Type::GamepadRightStick;
+            HandleLiveEvent({.m_type = type, .m_x = value.x, .m_y = value.y});
+        }
+    }
 
-        Dispatch();
+    void UpdateGamepadTriggerState(bool leftTrigger, float value)
+    {
+        const auto currentValue = leftTrigger ? m_gamepad.GetLeftTriggerValue() : m_gamepad.GetRightTriggerValue();
+        if (value != currentValue)
+        {
+            const auto type = leftTrigger ? RawInputEvent::Type::GamepadLeftTrigger : RawInputEvent::Type::GamepadRightTrigger;
+            HandleLiveEvent({.m_type = type, .m_x = value});
+        }
     }
 
+    /// @brief Record the raw input received since the last frame, or feed the devices with the replayed one
+    /// @param frameCount: Time service frame count of the frame being updated
+    /// @param deltaTime: Delta time of the frame being updated, stored in recordings
+    void Update(uint64_t frameCount, float deltaTime);
+
+    /// @brief Update all input devices and dispatch control changes to the contexts.
+    /// Only called on frames that run the simulation, so that presses and releases are not lost on frames it skips
+    void UpdateDevices();
+
     void ClearFrameState()
     {
         m_keyboard.ClearFrameState();
@@ -87,5 +153,24 @@ class InputService : public IService
     inline const Mouse* GetMouse() const { return &m_mouse; }
 
     inline const Gamepad* GetGamepad() const { return &m_gamepad; }
+
+    // ----- Record/replay
+    Mode GetMode() const { return m_mode; }
+
+    /// @brief Start capturing every input event into a recording, starting with the next frame
+    void StartRecording(InputRecording* pRecording);
+    void StopRecording();
+
+    /// @brief Replace live input with the content of a recording, starting with the next frame.
+    /// The recording must outlive the replay. Replay stops automatically after the last recorded frame
+    void StartReplay(const InputRecording* pRecording);
+    void StopReplay();
+
+    /// @brief Delta time recorded for the next replayed frame
+    float GetReplayDeltaTime() const
+    {
+        assert(m_mode == Mode::Replaying);
+        return m_replayCursor.GetDeltaTime();
+    }
 };
 } // namespace aln
\ No newline at end of file
@@ -2,29 +2,30 @@
 
 #include "callback_context.hpp"
 #include "input_action.hpp"
+#include "input_control.hpp"
 #include "interactions.hpp"
 
 namespace aln
 {
 
-void InputContext::Map(HashMap<UUID, ControlStateChangedEvent>& inputMap)
+void InputContext::Map(Vector<ControlStateChangedEvent>& events)
 {
-    for (auto& [controlID, action] : m_actions)
+    for (auto& event : events)
     {
-        // TODO: How do we handle multiple control actuations in the same frame ?
-        // Maybe pack them together and let the action decide for itself ?
-
-        auto it = inputMap.find(controlID);
-        if (it != inputMap.end())
+        if (event.m_pControl == nullptr)
         {
-            auto pControl = it->second.m_pControl;
+            continue; // Already consumed by another context
+        }
 
-            action.Trigger({
-                .pControl = pControl,
+        auto it = m_actions.find(event.m_pControl->GetID());
+        if (it != m_actions.end())
+        {
+            it->second.Trigger({
+                .pControl = event.m_pControl,
                 // TODO: Populate the context with more info.
             });
 
-            inputMap.erase(it);
+            event.m_pControl = nullptr;
         }
     }
 }
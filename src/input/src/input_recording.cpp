@@ -0,0 +1,68 @@
+#include "input_recording.hpp"
+
+#include <common/serialization/binary_archive.hpp>
+
+namespace aln
+{
+
+bool InputRecording::Save(const std::filesystem::path& path) const
+{
+    BinaryFileArchive archive(path, IBinaryArchive::IOMode::Write);
+    if (!archive.IsValid())
+    {
+        return false;
+    }
+
+    archive << FileMagic;
+    archive << FileVersion;
+    archive << m_startFrameCount;
+    archive << m_frames;
+    archive << m_events;
+
+    return true;
+}
+
+bool InputRecording::Load(const std::filesystem::path& path)
+{
+    Clear();
+
+    BinaryFileArchive archive(path, IBinaryArchive::IOMode::Read);
+    if (!archive.IsValid())
+    {
+        return false;
+    }
+
+    uint32_t magic, version;
+    archive >> magic;
+    archive >> version;
+    if (!archive.IsValid() || magic != FileMagic || version != FileVersion)
+    {
+        return false;
+    }
+
+    archive >> m_startFrameCount;
+    archive >> m_frames;
+    archive >> m_events;
+
+    // Truncated file
+    if (!archive.IsValid())
+    {
+        Clear();
+        return false;
+    }
+
+    // The frames' event ranges must cover the events exactly, replays index them without checks
+    uint64_t eventCount = 0;
+    for (const auto& frame : m_frames)
+    {
+        eventCount += frame.m_eventCount;
+    }
+    if (eventCount != m_events.size())
+    {
+        Clear();
+        return false;
+    }
+
+    return true;
+}
+} // namespace aln
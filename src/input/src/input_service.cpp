@@ -1,6 +1,9 @@
 #include "input_service.hpp"
 #include "input_context.hpp"
 
+#include <EASTL/algorithm.h>
+#include <EASTL/sort.h>
+
 #include <GLFW/glfw3.h>
 
 namespace aln
@@ -19,19 +22,158 @@ void InputService::UnregisterContext(InputContext* pContext)
     m_contexts.erase(iter);
 }
 
+void InputService::ApplyEvent(const RawInputEvent& event)
+{
+    switch (event.m_type)
+    {
+    case RawInputEvent::Type::KeyboardKey:
+        m_keyboard.UpdateControlState((Keyboard::Key) event.m_code, event.m_buttonState);
+        break;
+    case RawInputEvent::Type::MouseButton:
+        m_mouse.UpdateControlState((Mouse::Button) event.m_code, event.m_buttonState);
+        break;
+    case RawInputEvent::Type::MouseScroll:
+        m_mouse.UpdateScrollControlState(event.m_x, event.m_y);
+        break;
+    case RawInputEvent::Type::MousePosition:
+        m_mouse.SetCursorPosition({event.m_x, event.m_y});
+        break;
+    case RawInputEvent::Type::GamepadButton:
+        if (event.m_buttonState == ButtonState::Pressed)
+        {
+            m_gamepad.SetButtonPressed((Gamepad::Button) event.m_code);
+        }
+        else
+        {
+            m_gamepad.SetButtonReleased((Gamepad::Button) event.m_code);
+        }
+        break;
+    case RawInputEvent::Type::GamepadLeftStick:
+        m_gamepad.SetLeftStickState({event.m_x, event.m_y});
+        break;
+    case RawInputEvent::Type::GamepadRightStick:
+        m_gamepad.SetRightStickState({event.m_x, event.m_y});
+        break;
+    case RawInputEvent::Type::GamepadLeftTrigger:
+        m_gamepad.SetLeftTriggerState(event.m_x);
+        break;
+    case RawInputEvent::Type::GamepadRightTrigger:
+        m_gamepad.SetRightTriggerState(event.m_x);
+        break;
+    default:
+        assert(false);
+    }
+}
+
+void InputService::Update(uint64_t frameCount, float deltaTime)
+{
+    if (m_mode == Mode::Recording)
+    {
+        // Events received since the last frame are attributed to this one
+        if (m_pRecording->IsEmpty())
+        {
+            m_pRecording->SetStartFrameCount(frameCount);
+        }
+        assert(frameCount == m_pRecording->GetStartFrameCount() + m_pRecording->GetFrameCount());
+
+        m_pRecording->AddFrame(deltaTime, m_pendingRecordedEvents);
+        m_pendingRecordedEvents.clear();
+    }
+    else if (m_mode == Mode::Replaying)
+    {
+        for (const auto& event : m_replayCursor.GetEvents())
+        {
+            ApplyEvent(event);
+        }
+
+        m_replayCursor.Advance();
+        if (m_replayCursor.IsFinished())
+        {
+            StopReplay();
+        }
+    }
+}
+
+void InputService::UpdateDevices()
+{
+    m_keyboard.Update();
+    m_mouse.Update();
+    m_gamepad.Update();
+
+    Dispatch();
+}
+
+void InputService::StartRecording(InputRecording* pRecording)
+{
+    assert(m_mode == Mode::Live);
+    assert(pRecording != nullptr);
+
+    pRecording->Clear();
+    m_pRecording = pRecording;
+    m_pendingRecordedEvents.clear();
+    m_mode = Mode::Recording;
+}
+
+void InputService::StopRecording()
+{
+    assert(m_mode == Mode::Recording);
+
+    m_pRecording = nullptr;
+    m_pendingRecordedEvents.clear();
+    m_mode = Mode::Live;
+}
+
+void InputService::StartReplay(const InputRecording* pRecording)
+{
+    assert(m_mode == Mode::Live);
+    assert(pRecording != nullptr);
+
+    if (pRecording->IsEmpty())
+    {
+        return;
+    }
+
+    m_replayCursor = InputReplayCursor(pRecording);
+    m_mode = Mode::Replaying;
+}
+
+void InputService::StopReplay()
+{
+    assert(m_mode == Mode::Replaying);
+
+    m_replayCursor = InputReplayCursor();
+    m_mode = Mode::Live;
+}
+
 void InputService::Dispatch()
 {
     // 1. Poll triggered controls from the devices
-    HashMap<UUID, ControlStateChangedEvent> events;
-    m_keyboard.PollControlChangedEvents(events);
-    m_mouse.PollControlChangedEvents(events);
-    m_gamepad.PollControlChangedEvents(events);
+    m_frameEvents.clear();
+    m_keyboard.PollControlChangedEvents(m_frameEvents);
+    m_mouse.PollControlChangedEvents(m_frameEvents);
+    m_gamepad.PollControlChangedEvents(m_frameEvents);
 
     // Exit right away if no control change events were raised
-    if (events.empty())
+    if (m_frameEvents.empty())
     {
         return;
     }
+
+    // Keep a single event per control: the latest one, which holds its current state.
+    // The sort is stable so that the events of a control stay in the order they were raised
+    eastl::stable_sort(m_frameEvents.begin(), m_frameEvents.end(), [](const auto& a, const auto& b)
+        { return a.m_pControl < b.m_pControl; });
+    auto writeIt = m_frameEvents.begin();
+    for (auto it = m_frameEvents.begin(); it != m_frameEvents.end(); ++it)
+    {
+        const auto nextIt = it + 1;
+        if (nextIt == m_frameEvents.end() || nextIt->m_pControl != it->m_pControl)
+        {
+            *writeIt++ = *it;
+        }
+    }
+    m_frameEvents.erase(writeIt, m_frameEvents.end());
+
     // 2. TODO: Loop over bindings to find active ones ?
 
     // 3. Pass events to the interested contexts for consumption
@@ -41,7 +183,7 @@ void InputService::Dispatch()
 
         if (pContext->IsEnabled())
         {
-            pContext->Map(events);
+            pContext->Map(m_frameEvents);
         }
     }
 }